@@ -0,0 +1,442 @@
+// FPSAISchedulerSubsystem.cpp
+
+#include "FPSAISchedulerSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "FPS/AI/FPSEnemyAIController.h"
+#include "FPS/AI/FPSSignificanceSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Math/VectorRegister.h"
+
+void UFPSAISchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Significance = Collection.InitializeDependency<UFPSSignificanceSubsystem>();
+
+	Buckets.SetNum(FMath::Max(1, NumBuckets));
+}
+
+void UFPSAISchedulerSubsystem::Deinitialize()
+{
+	Agents.Empty();
+	AgentIndices.Empty();
+	Buckets.Empty();
+	CarryOver.Empty();
+	PendingRemovals.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSAISchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSAISchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSAISchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSAISchedulerSubsystem::RegisterAgent(AFPSEnemyAIController* Controller)
+{
+	if (!Controller || AgentIndices.Contains(Controller))
+	{
+		return;
+	}
+
+	// 가장 적게 찬 버킷에 배정 (같은 프레임에 등록된 에이전트가 서로 다른 버킷으로 나뉨)
+	int32 BestBucket = 0;
+	for (int32 BucketIndex = 1; BucketIndex < Buckets.Num(); ++BucketIndex)
+	{
+		if (Buckets[BucketIndex].Num() < Buckets[BestBucket].Num())
+		{
+			BestBucket = BucketIndex;
+		}
+	}
+
+	FAgentEntry Entry;
+	Entry.Controller = Controller;
+	Entry.Bucket = BestBucket;
+
+	const int32 AgentIndex = Agents.Add(Entry);
+	AgentIndices.Add(Controller, AgentIndex);
+	Buckets[BestBucket].Add(AgentIndex);
+}
+
+void UFPSAISchedulerSubsystem::UnregisterAgent(AFPSEnemyAIController* Controller)
+{
+	int32 AgentIndex = INDEX_NONE;
+	if (!AgentIndices.RemoveAndCopyValue(Controller, AgentIndex))
+	{
+		return;
+	}
+
+	// 업데이트 중일 수 있으므로 실제 제거는 다음 Tick 시작 시
+	Agents[AgentIndex].Controller.Reset();
+	PendingRemovals.Add(AgentIndex);
+}
+
+void UFPSAISchedulerSubsystem::FlushRemovals()
+{
+	for (const int32 AgentIndex : PendingRemovals)
+	{
+		const FAgentEntry& Entry = Agents[AgentIndex];
+		Buckets[Entry.Bucket].RemoveSingleSwap(AgentIndex, EAllowShrinking::No);
+		if (Entry.bCarriedOver)
+		{
+			CarryOver.RemoveSingle(AgentIndex);
+		}
+		Agents.RemoveAt(AgentIndex);
+	}
+	PendingRemovals.Reset();
+}
+
+int32 UFPSAISchedulerSubsystem::GetAgentCountInTier(EFPSAIUpdateTier Tier) const
+{
+	int32 Count = 0;
+	for (const FAgentEntry& Entry : Agents)
+	{
+		if (Entry.Controller.IsValid() && Entry.Tier == Tier)
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+void UFPSAISchedulerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushRemovals();
+
+	if (AgentIndices.Num() == 0)
+	{
+		BucketTimeAccumulator = 0.0;
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+
+	// 등급 계산/시야 판정용 플레이어 위치 (프레임당 한 번)
+	PlayerPawns.Reset();
+	PlayerLocations.Reset();
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (const APawn* PlayerPawn = PC ? PC->GetPawn() : nullptr)
+		{
+			PlayerPawns.Add(PlayerPawn);
+			PlayerLocations.Add(PlayerPawn->GetActorLocation());
+		}
+	}
+
+	RunVisionPass();
+
+	const double Deadline = FPlatformTime::Seconds() + FrameBudgetMs * 0.001;
+	int32 UpdatesThisFrame = 0;
+
+	// 최소 1개는 처리해서 예산이 아주 작아도 이월 목록이 계속 밀리지 않게 함
+	auto IsOverBudget = [&]()
+	{
+		return UpdatesThisFrame > 0 && FPlatformTime::Seconds() >= Deadline;
+	};
+
+	// 1. 지난 프레임에 밀린 에이전트 먼저
+	int32 CarryOverProcessed = 0;
+	while (CarryOverProcessed < CarryOver.Num() && !IsOverBudget())
+	{
+		const int32 AgentIndex = CarryOver[CarryOverProcessed++];
+		Agents[AgentIndex].bCarriedOver = false;
+		UpdateAgent(AgentIndex, Now);
+		UpdatesThisFrame++;
+	}
+	CarryOver.RemoveAt(0, CarryOverProcessed, EAllowShrinking::No);
+
+	// 2. 경과 시간만큼 버킷 방문 (느린 프레임이어도 한 바퀴까지만)
+	const double BucketDuration = CycleSeconds / Buckets.Num();
+	BucketTimeAccumulator += DeltaTime;
+
+	int32 BucketsToVisit = FMath::FloorToInt32(BucketTimeAccumulator / BucketDuration);
+	BucketTimeAccumulator -= BucketsToVisit * BucketDuration;
+	if (BucketsToVisit >= Buckets.Num())
+	{
+		BucketsToVisit = Buckets.Num();
+		BucketTimeAccumulator = 0.0;
+	}
+
+	for (int32 Visit = 0; Visit < BucketsToVisit; ++Visit)
+	{
+		// UpdateAgent 중 해제는 다음 Tick까지 미뤄지고, 등록은 버킷 끝에 붙으므로 인덱스로 순회
+		for (int32 Slot = 0; Slot < Buckets[NextBucket].Num(); ++Slot)
+		{
+			const int32 AgentIndex = Buckets[NextBucket][Slot];
+			FAgentEntry& Entry = Agents[AgentIndex];
+			if (Entry.bCarriedOver || !IsDue(Entry, Now))
+			{
+				continue;
+			}
+
+			if (IsOverBudget())
+			{
+				Entry.bCarriedOver = true;
+				CarryOver.Add(AgentIndex);
+				INC_DWORD_STAT(STAT_FPSAIDeferredUpdates);
+				continue;
+			}
+
+			UpdateAgent(AgentIndex, Now);
+			UpdatesThisFrame++;
+		}
+
+		NextBucket = (NextBucket + 1) % Buckets.Num();
+	}
+
+	INC_DWORD_STAT_BY(STAT_FPSAIUpdates, UpdatesThisFrame);
+}
+
+void UFPSAISchedulerSubsystem::RunVisionPass()
+{
+	VisionBatch.Reset();
+
+	const int32 NumTargets = FMath::Min(PlayerLocations.Num(), FFPSVisionConeBatch::MaxTargets);
+	for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+	{
+		VisionBatch.Targets.Add(FVector3f(PlayerLocations[TargetIndex]));
+	}
+
+	for (FAgentEntry& Entry : Agents)
+	{
+		Entry.VisionSlot = INDEX_NONE;
+
+		const AFPSEnemyAIController* Controller = Entry.Controller.Get();
+		const APawn* AgentPawn = Controller ? Controller->GetPawn() : nullptr;
+		if (AgentPawn)
+		{
+			Entry.VisionSlot = VisionBatch.AddObserver(AgentPawn->GetActorLocation(), AgentPawn->GetActorForwardVector(),
+				Controller->GetSightRange(), Controller->GetSightAngleCos());
+		}
+	}
+
+	VisionBatch.Evaluate();
+	VisionFrame = GFrameCounter;
+}
+
+bool UFPSAISchedulerSubsystem::GetVisionConeResult(const AFPSEnemyAIController* Controller, const APawn* Target, bool& bOutInCone) const
+{
+	if (VisionFrame != GFrameCounter || !Target)
+	{
+		return false;
+	}
+
+	const int32* AgentIndex = AgentIndices.Find(Controller);
+	if (!AgentIndex || Agents[*AgentIndex].VisionSlot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32 TargetIndex = PlayerPawns.IndexOfByKey(Target);
+	if (TargetIndex == INDEX_NONE || TargetIndex >= VisionBatch.Targets.Num())
+	{
+		return false;
+	}
+
+	bOutInCone = (VisionBatch.VisibleMask[Agents[*AgentIndex].VisionSlot] & (1u << TargetIndex)) != 0;
+	return true;
+}
+
+bool UFPSAISchedulerSubsystem::IsDue(const FAgentEntry& Entry, double Now) const
+{
+	const AFPSEnemyAIController* Controller = Entry.Controller.Get();
+	if (!Controller)
+	{
+		return false;
+	}
+
+	float Interval = Controller->GetUpdateInterval();
+	switch (Entry.Tier)
+	{
+	case EFPSAIUpdateTier::High:
+		Interval *= HighTierIntervalScale;
+		break;
+	case EFPSAIUpdateTier::Low:
+		Interval *= LowTierIntervalScale;
+		break;
+	default:
+		break;
+	}
+
+	// 버킷 방문 시각은 최대 버킷 하나만큼 어긋나므로 절반을 허용
+	const double Tolerance = 0.5 * CycleSeconds / Buckets.Num();
+	return Now - Entry.LastUpdateTime + Tolerance >= Interval;
+}
+
+void UFPSAISchedulerSubsystem::UpdateAgent(int32 AgentIndex, double Now)
+{
+	AFPSEnemyAIController* Controller = Agents[AgentIndex].Controller.Get();
+	if (!Controller)
+	{
+		return;
+	}
+
+	Controller->UpdateAI();
+
+	// UpdateAI 중 해제되었을 수 있음
+	FAgentEntry& Entry = Agents[AgentIndex];
+	if (Entry.Controller.IsValid())
+	{
+		Entry.LastUpdateTime = Now;
+		Entry.Tier = ComputeTier(*Controller);
+	}
+}
+
+EFPSAIUpdateTier UFPSAISchedulerSubsystem::ComputeTier(const AFPSEnemyAIController& Controller) const
+{
+	const EAIState State = Controller.GetCurrentState();
+	if (State == EAIState::Attack)
+	{
+		return EFPSAIUpdateTier::High;
+	}
+
+	const APawn* AgentPawn = Controller.GetPawn();
+
+	// 중요도 관리자가 있으면 그 단계 설정을 따름 (거리 + 시야 + 히스테리시스)
+	EFPSAIUpdateTier SignificanceTier;
+	if (Significance && Significance->GetAIUpdateTier(AgentPawn, SignificanceTier))
+	{
+		return SignificanceTier;
+	}
+
+	if (!AgentPawn || PlayerLocations.Num() == 0)
+	{
+		return EFPSAIUpdateTier::Low;
+	}
+
+	const FVector AgentLocation = AgentPawn->GetActorLocation();
+	double NearestDistSq = UE_BIG_NUMBER;
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		NearestDistSq = FMath::Min(NearestDistSq, FVector::DistSquared(AgentLocation, PlayerLocation));
+	}
+
+	const bool bChasing = State == EAIState::Chase;
+	if (NearestDistSq <= FMath::Square(NearPlayerDistance))
+	{
+		return bChasing ? EFPSAIUpdateTier::High : EFPSAIUpdateTier::Normal;
+	}
+	if (NearestDistSq >= FMath::Square(FarPlayerDistance))
+	{
+		return EFPSAIUpdateTier::Low;
+	}
+	return bChasing ? EFPSAIUpdateTier::Normal : EFPSAIUpdateTier::Low;
+}
+
+// ========================================
+// FFPSVisionConeBatch
+// ========================================
+
+int32 FFPSVisionConeBatch::AddObserver(const FVector& Location, const FVector& Forward, float Range, float InCosHalfAngle)
+{
+	PosX.Add(static_cast<float>(Location.X));
+	PosY.Add(static_cast<float>(Location.Y));
+	PosZ.Add(static_cast<float>(Location.Z));
+	FwdX.Add(static_cast<float>(Forward.X));
+	FwdY.Add(static_cast<float>(Forward.Y));
+	FwdZ.Add(static_cast<float>(Forward.Z));
+	RangeSq.Add(FMath::Square(Range));
+	CosHalfAngle.Add(InCosHalfAngle);
+	return VisibleMask.Add(0);
+}
+
+void FFPSVisionConeBatch::Evaluate()
+{
+	const int32 Count = Num();
+	if (Count == 0 || Targets.Num() == 0)
+	{
+		return;
+	}
+
+	const float* RESTRICT PX = PosX.GetData();
+	const float* RESTRICT PY = PosY.GetData();
+	const float* RESTRICT PZ = PosZ.GetData();
+	const float* RESTRICT FX = FwdX.GetData();
+	const float* RESTRICT FY = FwdY.GetData();
+	const float* RESTRICT FZ = FwdZ.GetData();
+	const float* RESTRICT RSq = RangeSq.GetData();
+	const float* RESTRICT Cos = CosHalfAngle.GetData();
+	uint32* RESTRICT Mask = VisibleMask.GetData();
+
+	// 4개씩 SIMD 처리: |D|^2 <= Range^2 && dot(F, D) >= cos * |D| (정규화/Acos 없이 코사인 비교)
+	const int32 SimdCount = Count & ~3;
+
+	for (int32 Index = 0; Index < SimdCount; Index += 4)
+	{
+		const VectorRegister4Float PosXVec = VectorLoad(PX + Index);
+		const VectorRegister4Float PosYVec = VectorLoad(PY + Index);
+		const VectorRegister4Float PosZVec = VectorLoad(PZ + Index);
+		const VectorRegister4Float FwdXVec = VectorLoad(FX + Index);
+		const VectorRegister4Float FwdYVec = VectorLoad(FY + Index);
+		const VectorRegister4Float FwdZVec = VectorLoad(FZ + Index);
+		const VectorRegister4Float RangeSqVec = VectorLoad(RSq + Index);
+		const VectorRegister4Float CosVec = VectorLoad(Cos + Index);
+
+		for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+		{
+			const FVector3f& Target = Targets[TargetIndex];
+			const VectorRegister4Float DX = VectorSubtract(VectorSetFloat1(Target.X), PosXVec);
+			const VectorRegister4Float DY = VectorSubtract(VectorSetFloat1(Target.Y), PosYVec);
+			const VectorRegister4Float DZ = VectorSubtract(VectorSetFloat1(Target.Z), PosZVec);
+
+			const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+			const VectorRegister4Float Dot = VectorMultiplyAdd(FwdXVec, DX, VectorMultiplyAdd(FwdYVec, DY, VectorMultiply(FwdZVec, DZ)));
+
+			const VectorRegister4Float InRange = VectorCompareLE(DistSq, RangeSqVec);
+			const VectorRegister4Float InCone = VectorCompareGE(Dot, VectorMultiply(CosVec, VectorSqrt(DistSq)));
+			const int32 LaneBits = VectorMaskBits(VectorBitwiseAnd(InRange, InCone));
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (LaneBits & (1 << Lane))
+				{
+					Mask[Index + Lane] |= 1u << TargetIndex;
+				}
+			}
+		}
+	}
+
+	// 나머지 (4개 미만)
+	for (int32 Index = SimdCount; Index < Count; ++Index)
+	{
+		for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+		{
+			const FVector3f& Target = Targets[TargetIndex];
+			const float DX = Target.X - PX[Index];
+			const float DY = Target.Y - PY[Index];
+			const float DZ = Target.Z - PZ[Index];
+
+			const float DistSq = DX * DX + DY * DY + DZ * DZ;
+			const float Dot = FX[Index] * DX + FY[Index] * DY + FZ[Index] * DZ;
+			if (DistSq <= RSq[Index] && Dot >= Cos[Index] * FMath::Sqrt(DistSq))
+			{
+				Mask[Index] |= 1u << TargetIndex;
+			}
+		}
+	}
+}
+
+void FFPSVisionConeBatch::Reset()
+{
+	PosX.Reset();
+	PosY.Reset();
+	PosZ.Reset();
+	FwdX.Reset();
+	FwdY.Reset();
+	FwdZ.Reset();
+	RangeSq.Reset();
+	CosHalfAngle.Reset();
+	VisibleMask.Reset();
+	Targets.Reset();
+}
@@ -0,0 +1,208 @@
+// FPSAISchedulerSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FPSAISchedulerSubsystem.generated.h"
+
+class AFPSEnemyAIController;
+class APawn;
+class UFPSSignificanceSubsystem;
+
+/**
+ * AI 업데이트 우선순위 (업데이트 간격 배율)
+ */
+UENUM(BlueprintType)
+enum class EFPSAIUpdateTier : uint8
+{
+	High,    // 공격 중이거나 플레이어 근처에서 추적 중
+	Normal,  // 기본 간격 (컨트롤러 TickInterval)
+	Low      // 플레이어와 멀리 떨어져 대기 중
+};
+
+/**
+ * 시야 판정 일괄 처리 버퍼 (Structure of Arrays)
+ * - 관찰자(에이전트) 위치/전방/시야 범위/시야각 코사인을 성분별로 분리해 4개씩 SIMD로 판정
+ * - 판정은 거리 + 시야각만 (차폐 트레이스는 통과한 쌍에 대해서만 각 컨트롤러가 요청)
+ * - 결과는 관찰자별 타겟 비트마스크 (타겟은 최대 32개)
+ */
+struct FFPSVisionConeBatch
+{
+	static constexpr int32 MaxTargets = 32;
+
+	// 관찰자 위치 / 전방 (단위 벡터)
+	TArray<float> PosX, PosY, PosZ;
+	TArray<float> FwdX, FwdY, FwdZ;
+
+	// 시야 범위 제곱, 시야각 코사인
+	TArray<float> RangeSq;
+	TArray<float> CosHalfAngle;
+
+	// 관찰자별 결과 (시야 안에 있는 타겟 비트)
+	TArray<uint32> VisibleMask;
+
+	// 타겟 위치
+	TArray<FVector3f, TInlineAllocator<4>> Targets;
+
+	int32 Num() const { return PosX.Num(); }
+
+	/** 관찰자 추가, 슬롯 인덱스 반환 */
+	int32 AddObserver(const FVector& Location, const FVector& Forward, float Range, float InCosHalfAngle);
+
+	/** 모든 관찰자 x 모든 타겟 거리/시야각 판정 */
+	void Evaluate();
+
+	void Reset();
+};
+
+/**
+ * AI 업데이트 스케줄러 (월드 단위)
+ * - 컨트롤러마다 반복 타이머를 두지 않고 등록된 에이전트를 버킷에 고르게 나눠 프레임마다 일부만 업데이트
+ *   (같은 프레임에 스폰된 적들도 서로 다른 프레임에 판단)
+ * - CycleSeconds 동안 모든 버킷을 한 바퀴 돌며, 각 에이전트는 자기 간격(TickInterval * 등급 배율)이 지났을 때만 업데이트
+ * - 프레임당 시간 예산(FrameBudgetMs) 초과분은 이월 목록에 넣어 다음 프레임에 가장 먼저 처리
+ * - 등급은 업데이트마다 다시 계산: 공격 중이면 High, 그 외에는 중요도 관리자 단계 설정
+ *   (관리자가 없으면 AI 상태와 가장 가까운 플레이어까지의 거리)
+ * - 업데이트 전에 모든 에이전트 x 모든 플레이어의 거리/시야각을 한 번에 판정 (CanSeePlayer가 결과 재사용)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSAISchedulerSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSAISchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// Registration
+	// ========================================
+
+	/** 에이전트 등록 (가장 적게 찬 버킷에 배정, 첫 방문 때 바로 업데이트) */
+	void RegisterAgent(AFPSEnemyAIController* Controller);
+
+	/** 에이전트 해제 (업데이트 중 호출되어도 안전) */
+	void UnregisterAgent(AFPSEnemyAIController* Controller);
+
+	/** 등록된 에이전트 수 */
+	int32 GetAgentCount() const { return AgentIndices.Num(); }
+
+	/** 예산 초과로 이월된 에이전트 수 */
+	int32 GetCarryOverCount() const { return CarryOver.Num(); }
+
+	/** 등급별 에이전트 수 */
+	int32 GetAgentCountInTier(EFPSAIUpdateTier Tier) const;
+
+	/** 이번 프레임 일괄 시야 판정 결과 (판정하지 않은 에이전트/타겟이면 false) */
+	bool GetVisionConeResult(const AFPSEnemyAIController* Controller, const APawn* Target, bool& bOutInCone) const;
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 버킷 수 (CycleSeconds를 이 수로 나눈 시간마다 버킷 하나 방문) */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 1))
+	int32 NumBuckets = 6;
+
+	/** 모든 버킷을 한 바퀴 도는 시간 (가장 짧은 업데이트 간격, 초) */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 0.01))
+	float CycleSeconds = 0.1f;
+
+	/** 프레임당 AI 업데이트 시간 예산 (ms, 최소 1개는 항상 처리) */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 0.0))
+	float FrameBudgetMs = 1.0f;
+
+	/** 이 거리 안에 플레이어가 있으면 근거리 */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 0.0))
+	float NearPlayerDistance = 1500.0f;
+
+	/** 이 거리 밖에 플레이어만 있으면 원거리 (항상 Low, 공격 중 제외) */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 0.0))
+	float FarPlayerDistance = 4000.0f;
+
+	/** High 등급 간격 배율 (TickInterval 기준) */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 0.1))
+	float HighTierIntervalScale = 0.5f;
+
+	/** Low 등급 간격 배율 (TickInterval 기준) */
+	UPROPERTY(Config, EditAnywhere, Category = "AI Scheduler", meta = (ClampMin = 1.0))
+	float LowTierIntervalScale = 2.5f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 에이전트 항목 */
+	struct FAgentEntry
+	{
+		TWeakObjectPtr<AFPSEnemyAIController> Controller;
+		int32 Bucket = 0;
+		double LastUpdateTime = -UE_BIG_NUMBER;
+		EFPSAIUpdateTier Tier = EFPSAIUpdateTier::Normal;
+
+		/** 이월 목록에 들어 있는지 */
+		bool bCarriedOver = false;
+
+		/** 이번 프레임 시야 판정 슬롯 (판정하지 않았으면 INDEX_NONE) */
+		int32 VisionSlot = INDEX_NONE;
+	};
+
+	/** 업데이트 간격이 지났는지 (버킷 방문 오차 절반 허용) */
+	bool IsDue(const FAgentEntry& Entry, double Now) const;
+
+	/** 업데이트 실행 후 등급 갱신 */
+	void UpdateAgent(int32 AgentIndex, double Now);
+
+	/** AI 상태와 플레이어 거리로 등급 계산 */
+	EFPSAIUpdateTier ComputeTier(const AFPSEnemyAIController& Controller) const;
+
+	/** 해제 대기 항목 정리 (Tick 시작 시) */
+	void FlushRemovals();
+
+	/** 모든 에이전트의 거리/시야각 일괄 판정 (업데이트 전 프레임당 한 번) */
+	void RunVisionPass();
+
+	/** 에이전트 항목 (인덱스 고정) */
+	TSparseArray<FAgentEntry> Agents;
+
+	/** 컨트롤러 -> 항목 인덱스 */
+	TMap<TObjectKey<AFPSEnemyAIController>, int32> AgentIndices;
+
+	/** 버킷별 항목 인덱스 */
+	TArray<TArray<int32>> Buckets;
+
+	/** 예산 초과로 다음 프레임에 먼저 처리할 항목 (밀린 순서) */
+	TArray<int32> CarryOver;
+
+	/** 해제 대기 항목 (업데이트 중 해제 대비) */
+	TArray<int32> PendingRemovals;
+
+	/** 이번 프레임 플레이어 폰 / 위치 (같은 인덱스) */
+	TArray<const APawn*, TInlineAllocator<4>> PlayerPawns;
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+
+	/** 중요도 관리자 (등급 계산) */
+	UPROPERTY(Transient)
+	TObjectPtr<UFPSSignificanceSubsystem> Significance;
+
+	/** 시야 판정 버퍼 */
+	FFPSVisionConeBatch VisionBatch;
+
+	/** 시야 판정을 실행한 프레임 */
+	uint64 VisionFrame = 0;
+
+	/** 다음 방문할 버킷 */
+	int32 NextBucket = 0;
+
+	/** 버킷 방문 시간 누적 */
+	double BucketTimeAccumulator = 0.0;
+};
@@ -0,0 +1,434 @@
+// FPSCrowdSubsystem.cpp
+
+#include "FPSCrowdSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "FPS/CharacterAttributeSet.h"
+#include "FPS/AI/FPSEnemyCharacter.h"
+#include "FPS/AI/FPSFlowFieldSubsystem.h"
+#include "Engine/World.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "AbilitySystemComponent.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+
+void UFPSCrowdSubsystem::Deinitialize()
+{
+	Locations.Empty();
+	Yaws.Empty();
+	Velocities.Empty();
+	Healths.Empty();
+	States.Empty();
+	Teams.Empty();
+	ClassIndices.Empty();
+	NavLocations.Empty();
+	EnemyClasses.Empty();
+	PromotedEnemies.Empty();
+	PlayerPawns.Empty();
+	PlayerLocations.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSCrowdSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSCrowdSubsystem, STATGROUP_Tickables);
+}
+
+UFPSCrowdSubsystem* UFPSCrowdSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSCrowdSubsystem>() : nullptr;
+}
+
+bool UFPSCrowdSubsystem::AddCrowdEnemy(TSubclassOf<AFPSEnemyCharacter> EnemyClass, const FTransform& SpawnTransform, uint8 TeamId, float Health)
+{
+	if (!EnemyClass)
+	{
+		return false;
+	}
+
+	const int32 ClassIndex = FindOrAddClass(EnemyClass);
+	if (ClassIndex == INDEX_NONE)
+	{
+		UE_LOG(LogFPSAI, Warning, TEXT("군중 적 클래스 수 초과 - %s 추가 실패"), *EnemyClass->GetName());
+		return false;
+	}
+
+	if (!AddAgent(static_cast<uint8>(ClassIndex), SpawnTransform.GetLocation(), SpawnTransform.Rotator().Yaw,
+		FVector::ZeroVector, Health, EAIState::Idle, TeamId))
+	{
+		UE_LOG(LogFPSAI, Warning, TEXT("군중 적 위치가 네비메시 밖 - %s 추가 실패 (%s)"), *EnemyClass->GetName(), *SpawnTransform.GetLocation().ToString());
+		return false;
+	}
+
+	return true;
+}
+
+int32 UFPSCrowdSubsystem::FindOrAddClass(TSubclassOf<AFPSEnemyCharacter> EnemyClass)
+{
+	const int32 ExistingIndex = EnemyClasses.IndexOfByKey(EnemyClass);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	// 클래스 인덱스는 uint8로 보관
+	if (EnemyClasses.Num() > MAX_uint8)
+	{
+		return INDEX_NONE;
+	}
+
+	return EnemyClasses.Add(EnemyClass);
+}
+
+bool UFPSCrowdSubsystem::AddAgent(uint8 ClassIndex, const FVector& Location, float Yaw, const FVector& Velocity, float Health, EAIState State, uint8 TeamId)
+{
+	// 군중 위치는 항상 네비메시 위에서 시작 (재투영 실패 시 되돌아갈 위치)
+	const float HalfHeight = GetHalfHeight(ClassIndex);
+	FVector NavLocation = Location - FVector(0.0, 0.0, HalfHeight);
+	if (const ANavigationData* NavData = GetNavData())
+	{
+		if (!ProjectToNavigation(*NavData, Location, HalfHeight, NavLocation))
+		{
+			return false;
+		}
+	}
+
+	Locations.Add(NavLocation + FVector(0.0, 0.0, HalfHeight));
+	Yaws.Add(Yaw);
+	Velocities.Add(Velocity);
+	Healths.Add(Health);
+	States.Add(State);
+	Teams.Add(TeamId);
+	ClassIndices.Add(ClassIndex);
+	NavLocations.Add(NavLocation);
+	return true;
+}
+
+void UFPSCrowdSubsystem::RemoveAgentAt(int32 Index)
+{
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Yaws.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Healths.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	States.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Teams.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ClassIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	NavLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+float UFPSCrowdSubsystem::GetHalfHeight(uint8 ClassIndex) const
+{
+	const UClass* EnemyClass = EnemyClasses.IsValidIndex(ClassIndex) ? EnemyClasses[ClassIndex].Get() : nullptr;
+	const AFPSEnemyCharacter* EnemyCDO = EnemyClass ? EnemyClass->GetDefaultObject<AFPSEnemyCharacter>() : nullptr;
+	const UCapsuleComponent* Capsule = EnemyCDO ? EnemyCDO->GetCapsuleComponent() : nullptr;
+	return Capsule ? Capsule->GetScaledCapsuleHalfHeight() : 0.0f;
+}
+
+const ANavigationData* UFPSCrowdSubsystem::GetNavData() const
+{
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	return NavSys ? NavSys->GetDefaultNavDataInstance() : nullptr;
+}
+
+bool UFPSCrowdSubsystem::ProjectToNavigation(const ANavigationData& NavData, const FVector& Location, float HalfHeight, FVector& OutNavLocation) const
+{
+	// 캡슐 중심이 아니라 발 위치를 투영
+	FNavLocation Projected;
+	if (!NavData.ProjectPoint(Location - FVector(0.0, 0.0, HalfHeight), Projected, NavQueryExtent, NavData.GetDefaultQueryFilter(), this))
+	{
+		return false;
+	}
+
+	OutNavLocation = Projected.Location;
+	return true;
+}
+
+bool UFPSCrowdSubsystem::ReprojectAgent(int32 Index, const ANavigationData& NavData)
+{
+	const float HalfHeight = GetHalfHeight(ClassIndices[Index]);
+
+	FVector NavLocation;
+	const bool bProjected = ProjectToNavigation(NavData, Locations[Index], HalfHeight, NavLocation);
+	if (!bProjected)
+	{
+		// 네비메시 밖으로 벗어남 (낭떠러지/벽 안) -> 마지막 투영 위치로
+		NavLocation = NavLocations[Index];
+	}
+	else
+	{
+		// 충돌 없이 이동했으므로 벽을 통과했으면 막힌 지점까지
+		FVector HitLocation;
+		if (NavData.Raycast(NavLocations[Index], NavLocation, HitLocation, NavData.GetDefaultQueryFilter(), this))
+		{
+			NavLocation = HitLocation;
+		}
+	}
+
+	NavLocations[Index] = NavLocation;
+	Locations[Index] = NavLocation + FVector(0.0, 0.0, HalfHeight);
+	return bProjected;
+}
+
+void UFPSCrowdSubsystem::ReprojectCrowd()
+{
+	const int32 NumAgents = Locations.Num();
+	const ANavigationData* NavData = GetNavData();
+	if (NumAgents == 0 || MaxReprojectionsPerFrame <= 0 || !NavData)
+	{
+		return;
+	}
+
+	const int32 NumChecks = FMath::Min(MaxReprojectionsPerFrame, NumAgents);
+	ReprojectionCursor %= NumAgents;
+
+	for (int32 Check = 0; Check < NumChecks; ++Check)
+	{
+		const int32 Index = (ReprojectionCursor + Check) % NumAgents;
+
+		// 멈춰 있는 적은 마지막 투영 위치 그대로
+		if (Velocities[Index].IsNearlyZero())
+		{
+			continue;
+		}
+
+		ReprojectAgent(Index, *NavData);
+	}
+
+	ReprojectionCursor = (ReprojectionCursor + NumChecks) % NumAgents;
+}
+
+void UFPSCrowdSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	GatherPlayers();
+
+	// 플레이어가 없으면 (사망/리스폰 중) 전환하지 않음
+	int32 Budget = PlayerLocations.Num() > 0 ? MaxTransitionsPerFrame : 0;
+	const double DeactivationRadiusSq = FMath::Square(static_cast<double>(FMath::Max(DeactivationRadius, ActivationRadius)));
+
+	// 1. 승격된 적: 사망/파괴된 적 정리, 멀어진 적 강등
+	for (int32 Index = PromotedEnemies.Num() - 1; Index >= 0; --Index)
+	{
+		AFPSEnemyCharacter* Enemy = PromotedEnemies[Index].Enemy.Get();
+		if (!Enemy || Enemy->IsDead())
+		{
+			PromotedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Budget <= 0)
+		{
+			continue;
+		}
+
+		double DistSq = 0.0;
+		if (FindNearestPlayer(Enemy->GetActorLocation(), DistSq) != INDEX_NONE && DistSq > DeactivationRadiusSq
+			&& Demote(PromotedEnemies[Index], *Enemy))
+		{
+			PromotedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			Budget--;
+		}
+	}
+
+	// 2. 군중 이동 + 승격 (뒤 인덱스부터 처리해야 RemoveAtSwap이 남은 대상 인덱스를 바꾸지 않음)
+	TArray<int32, TInlineAllocator<16>> Promotions;
+	SimulateCrowd(DeltaTime, Promotions, Budget);
+	ReprojectCrowd();
+
+	for (int32 Index = Promotions.Num() - 1; Index >= 0; --Index)
+	{
+		Promote(Promotions[Index]);
+	}
+
+	SET_DWORD_STAT(STAT_FPSCrowdAgents, Locations.Num());
+	SET_DWORD_STAT(STAT_FPSCrowdPromoted, PromotedEnemies.Num());
+}
+
+void UFPSCrowdSubsystem::GatherPlayers()
+{
+	PlayerPawns.Reset();
+	PlayerLocations.Reset();
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!PlayerPawn)
+		{
+			continue;
+		}
+
+		PlayerPawns.Add(PlayerPawn);
+		PlayerLocations.Add(PlayerPawn->GetActorLocation());
+	}
+}
+
+int32 UFPSCrowdSubsystem::FindNearestPlayer(const FVector& Location, double& OutDistSq) const
+{
+	int32 NearestIndex = INDEX_NONE;
+	OutDistSq = TNumericLimits<double>::Max();
+
+	for (int32 PlayerIndex = 0; PlayerIndex < PlayerLocations.Num(); ++PlayerIndex)
+	{
+		const double DistSq = FVector::DistSquared(Location, PlayerLocations[PlayerIndex]);
+		if (DistSq < OutDistSq)
+		{
+			OutDistSq = DistSq;
+			NearestIndex = PlayerIndex;
+		}
+	}
+
+	return NearestIndex;
+}
+
+void UFPSCrowdSubsystem::SimulateCrowd(float DeltaTime, TArray<int32, TInlineAllocator<16>>& OutPromotions, int32 Budget)
+{
+	UFPSFlowFieldSubsystem* FlowField = UFPSFlowFieldSubsystem::Get(this);
+	const bool bUseFlowField = FlowField && FlowField->IsEnabled();
+
+	const double ActivationRadiusSq = FMath::Square(static_cast<double>(ActivationRadius));
+	const double ChaseRadiusSq = FMath::Square(static_cast<double>(ChaseRadius));
+
+	for (int32 Index = 0; Index < Locations.Num(); ++Index)
+	{
+		FVector& Location = Locations[Index];
+
+		double DistSq = 0.0;
+		const int32 PlayerIndex = FindNearestPlayer(Location, DistSq);
+		if (PlayerIndex == INDEX_NONE || DistSq > ChaseRadiusSq)
+		{
+			States[Index] = EAIState::Idle;
+			Velocities[Index] = FVector::ZeroVector;
+			continue;
+		}
+
+		if (DistSq <= ActivationRadiusSq && OutPromotions.Num() < Budget)
+		{
+			OutPromotions.Add(Index);
+			continue;
+		}
+
+		// 플로우 필드 방향 (필드 밖이면 직선)
+		FVector Direction;
+		if (!bUseFlowField || !FlowField->SampleDirection(PlayerPawns[PlayerIndex].Get(), Location, Direction))
+		{
+			Direction = (PlayerLocations[PlayerIndex] - Location).GetSafeNormal2D();
+		}
+
+		States[Index] = EAIState::Chase;
+		Velocities[Index] = Direction * MoveSpeed;
+		Location += Velocities[Index] * DeltaTime;
+
+		if (!Direction.IsNearlyZero())
+		{
+			Yaws[Index] = FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+		}
+	}
+}
+
+bool UFPSCrowdSubsystem::Promote(int32 Index)
+{
+	const uint8 ClassIndex = ClassIndices[Index];
+	UClass* EnemyClass = EnemyClasses.IsValidIndex(ClassIndex) ? EnemyClasses[ClassIndex].Get() : nullptr;
+	if (!EnemyClass)
+	{
+		RemoveAgentAt(Index);
+		return false;
+	}
+
+	// 벽 안/바닥 아래/공중에서 스폰되지 않도록 네비메시에 투영한 위치로 (실패하면 마지막 투영 위치로 되돌리고 다음 프레임에 재시도)
+	if (const ANavigationData* NavData = GetNavData())
+	{
+		if (!ReprojectAgent(Index, *NavData))
+		{
+			UE_LOG(LogFPSAI, Verbose, TEXT("군중 적 %d 승격 보류 - 네비메시 투영 실패"), Index);
+			return false;
+		}
+	}
+
+	const FTransform SpawnTransform(FRotator(0.0f, Yaws[Index], 0.0f), Locations[Index]);
+
+	AFPSEnemyCharacter* Enemy = GetWorld()->SpawnActorDeferred<AFPSEnemyCharacter>(
+		EnemyClass,
+		SpawnTransform,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding
+	);
+
+	if (!Enemy)
+	{
+		return false;
+	}
+
+	// 군중에서 나온 적도 배치된 적처럼 스폰 즉시 AI가 빙의
+	Enemy->AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
+	Enemy->SetTeamId(Teams[Index]);
+	Enemy->FinishSpawning(SpawnTransform);
+
+	// 군중 상태 이어받기 (ASC는 BeginPlay에서 초기화됨)
+	if (Healths[Index] >= 0.0f)
+	{
+		if (UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent())
+		{
+			ASC->SetNumericAttributeBase(UCharacterAttributeSet::GetHealthAttribute(), Healths[Index]);
+		}
+	}
+
+	if (UCharacterMovementComponent* Movement = Enemy->GetCharacterMovement())
+	{
+		Movement->Velocity = Velocities[Index];
+	}
+
+	if (AFPSEnemyAIController* Controller = Cast<AFPSEnemyAIController>(Enemy->GetController()))
+	{
+		double DistSq = 0.0;
+		const int32 PlayerIndex = FindNearestPlayer(Locations[Index], DistSq);
+		Controller->RestoreState(States[Index], PlayerIndex != INDEX_NONE ? PlayerPawns[PlayerIndex].Get() : nullptr);
+	}
+
+	FPromotedEnemy& Promoted = PromotedEnemies.AddDefaulted_GetRef();
+	Promoted.Enemy = Enemy;
+	Promoted.ClassIndex = ClassIndex;
+
+	RemoveAgentAt(Index);
+	INC_DWORD_STAT(STAT_FPSCrowdPromotions);
+	return true;
+}
+
+bool UFPSCrowdSubsystem::Demote(const FPromotedEnemy& Promoted, AFPSEnemyCharacter& Enemy)
+{
+	float Health = -1.0f;
+	if (const UAbilitySystemComponent* ASC = Enemy.GetAbilitySystemComponent())
+	{
+		Health = ASC->GetNumericAttribute(UCharacterAttributeSet::GetHealthAttribute());
+	}
+
+	// 군중은 대기/추적만 구분 (공격 중이던 적은 추적으로)
+	EAIState State = EAIState::Idle;
+	if (const AFPSEnemyAIController* Controller = Cast<AFPSEnemyAIController>(Enemy.GetController()))
+	{
+		State = Controller->GetCurrentState() == EAIState::Idle ? EAIState::Idle : EAIState::Chase;
+	}
+
+	// 네비메시 밖(점프/낙하 중 등)이면 액터로 남겨두고 다음 프레임에 재시도
+	if (!AddAgent(Promoted.ClassIndex, Enemy.GetActorLocation(), Enemy.GetActorRotation().Yaw,
+		Enemy.GetVelocity(), Health, State, Enemy.GetTeamId()))
+	{
+		return false;
+	}
+
+	// 무기들은 OnOwnerDestroyed 델리게이트로 함께 파괴됨 (사망 처리/보상/드롭 없음)
+	Enemy.Destroy();
+	INC_DWORD_STAT(STAT_FPSCrowdDemotions);
+	return true;
+}
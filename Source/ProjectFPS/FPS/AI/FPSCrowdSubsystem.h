@@ -0,0 +1,180 @@
+// FPSCrowdSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPS/AI/FPSEnemyAIController.h"
+#include "FPSCrowdSubsystem.generated.h"
+
+class AFPSEnemyCharacter;
+class ANavigationData;
+
+/**
+ * 원거리 적 군중 (월드 단위)
+ * - 플레이어에게서 먼 적은 액터 없이 위치/방향/속도/체력/상태/팀만 연속 배열(SoA)로 보관하고 단순 이동만 시뮬레이션
+ *   (ASC, AttributeSet, 무기 슬롯, 무기 액터 비용 없음 -> 레벨당 1000명 이상)
+ * - 단순 이동: ChaseRadius 안에 플레이어가 있으면 가장 가까운 플레이어 쪽으로 MoveSpeed로 이동
+ *   (플로우 필드가 켜져 있으면 필드 방향, 아니면 직선)
+ * - 이동은 충돌 없이 적용하고, 프레임당 MaxReprojectionsPerFrame명씩 돌아가며 네비메시에 다시 투영해 지면 높이에 맞춤
+ *   (마지막 투영 위치에서 네비메시 레이캐스트로 막히면 막힌 지점까지, 투영 실패 시 마지막 투영 위치로 되돌림)
+ * - 플레이어 ActivationRadius 안에 들어오면 AFPSEnemyCharacter로 승격, DeactivationRadius 밖으로 나가면 다시 강등
+ *   (체력/속도/AI 상태/팀을 그대로 넘김, 두 반경 차이로 경계에서 반복 전환 방지)
+ * - 승격 위치는 네비메시에 투영한 지점 + 캡슐 반높이 (투영 실패 시 마지막 투영 위치로 되돌리고 다음 프레임에 재시도)
+ * - 스폰/파괴 비용이 한 프레임에 몰리지 않도록 프레임당 전환 수는 MaxTransitionsPerFrame까지
+ * - 승격된 적이 죽으면 군중에서 빠짐 (사망/보상/드롭은 액터가 처리)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSCrowdSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 군중 (없으면 nullptr) */
+	static UFPSCrowdSubsystem* Get(const UObject* WorldContext);
+
+	// ========================================
+	// Crowd API
+	// ========================================
+
+	/**
+	 * 군중 적 추가 (액터 없이 시작, 플레이어가 가까우면 다음 Tick에 승격)
+	 * @param Health 시작 체력 (음수면 승격 시 클래스 기본값)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Crowd")
+	bool AddCrowdEnemy(TSubclassOf<AFPSEnemyCharacter> EnemyClass, const FTransform& SpawnTransform, uint8 TeamId = 0, float Health = -1.0f);
+
+	/** 액터 없이 시뮬레이션 중인 적 수 */
+	UFUNCTION(BlueprintPure, Category = "Crowd")
+	int32 GetCrowdCount() const { return Locations.Num(); }
+
+	/** 승격되어 액터로 있는 적 수 */
+	UFUNCTION(BlueprintPure, Category = "Crowd")
+	int32 GetPromotedCount() const { return PromotedEnemies.Num(); }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 플레이어와 이 거리 안이면 액터로 승격 */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd", meta = (ClampMin = 0.0))
+	float ActivationRadius = 3000.0f;
+
+	/** 플레이어와 이 거리 밖이면 군중으로 강등 (ActivationRadius보다 커야 함) */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd", meta = (ClampMin = 0.0))
+	float DeactivationRadius = 3500.0f;
+
+	/** 플레이어와 이 거리 안이면 군중 상태에서도 추적 이동 */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd", meta = (ClampMin = 0.0))
+	float ChaseRadius = 15000.0f;
+
+	/** 군중 상태 이동 속도 */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd", meta = (ClampMin = 0.0))
+	float MoveSpeed = 300.0f;
+
+	/** 프레임당 승격 + 강등 수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd", meta = (ClampMin = 1))
+	int32 MaxTransitionsPerFrame = 4;
+
+	/** 프레임당 네비메시 재투영 수 (이동 중인 적만, 돌아가며) */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd", meta = (ClampMin = 0))
+	int32 MaxReprojectionsPerFrame = 64;
+
+	/** 네비메시 투영 범위 (발 위치 기준) */
+	UPROPERTY(Config, EditAnywhere, Category = "Crowd")
+	FVector NavQueryExtent = FVector(100.0, 100.0, 250.0);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 승격된 적 (강등 시 같은 클래스로 되돌리기 위해 클래스 인덱스 보관) */
+	struct FPromotedEnemy
+	{
+		TWeakObjectPtr<AFPSEnemyCharacter> Enemy;
+		uint8 ClassIndex = 0;
+	};
+
+	/** 플레이어 폰 위치 갱신 (프레임당 1회) */
+	void GatherPlayers();
+
+	/** 가장 가까운 플레이어 인덱스 (없으면 INDEX_NONE) */
+	int32 FindNearestPlayer(const FVector& Location, double& OutDistSq) const;
+
+	/** 군중 이동 + 승격 대상 수집 */
+	void SimulateCrowd(float DeltaTime, TArray<int32, TInlineAllocator<16>>& OutPromotions, int32 Budget);
+
+	/** 이동한 적을 네비메시에 다시 투영 (MaxReprojectionsPerFrame명씩 돌아가며) */
+	void ReprojectCrowd();
+
+	/**
+	 * 적 하나를 네비메시에 다시 투영 (벽을 통과했으면 막힌 지점까지)
+	 * @return 투영 실패 시 false (마지막 투영 위치로 되돌림)
+	 */
+	bool ReprojectAgent(int32 Index, const ANavigationData& NavData);
+
+	/**
+	 * 군중 위치(캡슐 중심)를 네비메시에 투영
+	 * @param OutNavLocation 투영된 발 위치
+	 */
+	bool ProjectToNavigation(const ANavigationData& NavData, const FVector& Location, float HalfHeight, FVector& OutNavLocation) const;
+
+	/** 기본 네비메시 (없으면 nullptr, 이때는 투영 없이 그대로 이동/스폰) */
+	const ANavigationData* GetNavData() const;
+
+	/** 적 클래스의 캡슐 반높이 */
+	float GetHalfHeight(uint8 ClassIndex) const;
+
+	/** 군중 -> 액터 (성공하면 배열에서 제거, 네비메시 투영/스폰 실패 시 남겨두고 다음 프레임에 재시도) */
+	bool Promote(int32 Index);
+
+	/** 액터 -> 군중 (상태를 배열에 옮기고 액터 파괴, 네비메시 밖이면 액터로 남김) */
+	bool Demote(const FPromotedEnemy& Promoted, AFPSEnemyCharacter& Enemy);
+
+	/** 군중 항목 추가 (네비메시에 투영한 위치로, 투영 실패 시 추가하지 않음) */
+	bool AddAgent(uint8 ClassIndex, const FVector& Location, float Yaw, const FVector& Velocity, float Health, EAIState State, uint8 TeamId);
+
+	/** 군중 항목 제거 (마지막 항목과 교체) */
+	void RemoveAgentAt(int32 Index);
+
+	/** 적 클래스 -> 인덱스 (없으면 추가) */
+	int32 FindOrAddClass(TSubclassOf<AFPSEnemyCharacter> EnemyClass);
+
+	// ========================================
+	// 군중 데이터 (SoA, 같은 인덱스 = 같은 적)
+	// ========================================
+
+	TArray<FVector> Locations;
+	TArray<float> Yaws;
+	TArray<FVector> Velocities;
+	TArray<float> Healths;
+	TArray<EAIState> States;
+	TArray<uint8> Teams;
+	TArray<uint8> ClassIndices;
+
+	/** 마지막으로 네비메시에 투영된 발 위치 (투영 전이면 추가된 위치 기준) */
+	TArray<FVector> NavLocations;
+
+	/** 다음 재투영 시작 인덱스 */
+	int32 ReprojectionCursor = 0;
+
+	/** 군중이 사용하는 적 클래스 */
+	UPROPERTY(Transient)
+	TArray<TSubclassOf<AFPSEnemyCharacter>> EnemyClasses;
+
+	/** 승격된 적 */
+	TArray<FPromotedEnemy> PromotedEnemies;
+
+	/** 이번 프레임 플레이어 폰 / 위치 */
+	TArray<TWeakObjectPtr<APawn>, TInlineAllocator<4>> PlayerPawns;
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+};
@@ -1,11 +1,16 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/AI/FPSEnemyAIController.h"
+#include "FPS/FPSLog.h"
 #include "FPS/AI/FPSEnemyCharacter.h"
+#include "FPS/AI/FPSAISchedulerSubsystem.h"
+#include "FPS/AI/FPSVisibilityCacheSubsystem.h"
+#include "FPS/AI/FPSPathRequestSubsystem.h"
+#include "FPS/AI/FPSFlowFieldSubsystem.h"
+#include "FPS/FPSSpatialHashSubsystem.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Components/WeaponSlotComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "Engine/Engine.h"
 #include "TimerManager.h"
 #include "NavigationSystem.h"
 #include "AITypes.h"
@@ -13,7 +18,8 @@
 
 AFPSEnemyAIController::AFPSEnemyAIController()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// AI 업데이트는 UFPSAISchedulerSubsystem이 프레임에 나눠 호출하므로 Tick 불필요
+	PrimaryActorTick.bCanEverTick = false;
 	
 	// AI 기본 설정
 	bWantsPlayerState = false;
@@ -30,8 +36,16 @@ AFPSEnemyAIController::AFPSEnemyAIController()
 void AFPSEnemyAIController::BeginPlay()
 {
 	Super::BeginPlay();
-	
-	// AI 업데이트 타이머 시작
+
+	SightAngleCos = FMath::Cos(FMath::DegreesToRadians(SightAngle));
+
+	// AI 스케줄러에 등록 (버킷에 나눠 업데이트, 스케줄러가 없는 월드에서는 타이머로 대체)
+	if (UFPSAISchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UFPSAISchedulerSubsystem>())
+	{
+		Scheduler->RegisterAgent(this);
+		return;
+	}
+
 	GetWorld()->GetTimerManager().SetTimer(
 		AIUpdateTimer, 
 		this, 
@@ -41,9 +55,26 @@ void AFPSEnemyAIController::BeginPlay()
 	);
 }
 
-void AFPSEnemyAIController::Tick(float DeltaTime)
+void AFPSEnemyAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	if (UWorld* World = GetWorld())
+	{
+		if (UFPSAISchedulerSubsystem* Scheduler = World->GetSubsystem<UFPSAISchedulerSubsystem>())
+		{
+			Scheduler->UnregisterAgent(this);
+		}
+		World->GetTimerManager().ClearTimer(AIUpdateTimer);
+	}
+
+	if (UFPSPathRequestSubsystem* PathRequests = UFPSPathRequestSubsystem::Get(this))
+	{
+		PathRequests->CancelRequest(this);
+	}
+
+	ResetLineOfSight();
+	ClearCachedWeapon();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AFPSEnemyAIController::OnPossess(APawn* InPawn)
@@ -55,10 +86,46 @@ void AFPSEnemyAIController::OnPossess(APawn* InPawn)
 	
 	if (ControlledEnemy)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AI Controller 빙의 완료"));
+		UE_LOG(LogFPSAI, Log, TEXT("AI Controller 빙의 완료"));
+
+		// 무기 교체 시에만 무기 캐시 갱신 (발사마다 슬롯 조회/델리게이트 바인딩 없음)
+		if (UWeaponSlotComponent* WSC = ControlledEnemy->GetWeaponSlotComponent())
+		{
+			WSC->OnWeaponSlotChanged.AddUniqueDynamic(this, &AFPSEnemyAIController::OnWeaponSlotChanged);
+			WSC->OnWeaponEquipped.AddUniqueDynamic(this, &AFPSEnemyAIController::OnWeaponEquipped);
+			WSC->OnWeaponUnequipped.AddUniqueDynamic(this, &AFPSEnemyAIController::OnWeaponUnequipped);
+		}
+		RefreshCachedWeapon();
 	}
 }
 
+void AFPSEnemyAIController::OnUnPossess()
+{
+	if (ControlledEnemy)
+	{
+		if (UWeaponSlotComponent* WSC = ControlledEnemy->GetWeaponSlotComponent())
+		{
+			WSC->OnWeaponSlotChanged.RemoveDynamic(this, &AFPSEnemyAIController::OnWeaponSlotChanged);
+			WSC->OnWeaponEquipped.RemoveDynamic(this, &AFPSEnemyAIController::OnWeaponEquipped);
+			WSC->OnWeaponUnequipped.RemoveDynamic(this, &AFPSEnemyAIController::OnWeaponUnequipped);
+		}
+	}
+	ClearCachedWeapon();
+
+	Super::OnUnPossess();
+}
+
+void AFPSEnemyAIController::RestoreState(EAIState State, APawn* Target)
+{
+	if (!Target || State == EAIState::Idle)
+	{
+		return;
+	}
+
+	TargetPawn = Target;
+	SetAIState(EAIState::Chase);
+}
+
 // AI 메인 업데이트 함수
 void AFPSEnemyAIController::UpdateAI()
 {
@@ -68,8 +135,8 @@ void AFPSEnemyAIController::UpdateAI()
 		return;
 	}
 
-	// 플레이어 찾기
-	if (!TargetPawn)
+	// 플레이어 찾기 (대기 중에는 매번 다시 찾아 시야 안에 들어온 가장 가까운 플레이어를 잡음)
+	if (!TargetPawn || CurrentState == EAIState::Idle)
 	{
 		TargetPawn = FindPlayerPawn();
 	}
@@ -102,47 +169,131 @@ bool AFPSEnemyAIController::CanSeePlayer()
 	if (!TargetPawn || !ControlledEnemy)
 		return false;
 
-	// 거리 체크
-	if (!IsInSightRange())
+	// 거리/시야각 체크: 스케줄러가 이번 프레임에 일괄 판정한 결과 사용 (없으면 직접 판정)
+	bool bInVisionCone = false;
+	const UFPSAISchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UFPSAISchedulerSubsystem>();
+	if (!Scheduler || !Scheduler->GetVisionConeResult(this, TargetPawn, bInVisionCone))
+	{
+		bInVisionCone = IsInVisionCone();
+	}
+
+	if (!bInVisionCone)
+	{
+		ResetLineOfSight();
 		return false;
+	}
 
-	// 시야각 체크
-	FVector ToTarget = TargetPawn->GetActorLocation() - ControlledEnemy->GetActorLocation();
-	ToTarget.Normalize();
-	
-	FVector Forward = ControlledEnemy->GetActorForwardVector();
-	float DotProduct = FVector::DotProduct(Forward, ToTarget);
-	float AngleRadians = FMath::Acos(DotProduct);
-	float AngleDegrees = FMath::RadiansToDegrees(AngleRadians);
+	// 장애물 체크는 비동기 쿼리 결과 사용
+	return UpdateLineOfSight();
+}
 
-	// 시야각 안에 있는지 체크
-	if (AngleDegrees > SightAngle)
+bool AFPSEnemyAIController::UpdateLineOfSight()
+{
+	UFPSAsyncQuerySubsystem* AsyncQuery = GetWorld()->GetSubsystem<UFPSAsyncQuerySubsystem>();
+	if (!AsyncQuery)
+	{
 		return false;
+	}
 
-	// 라인 트레이스로 장애물 체크 (벽, 바닥 등 모든 Static 물체 감지)
-	FHitResult HitResult;
-	FVector Start = ControlledEnemy->GetActorLocation();
-	FVector End = TargetPawn->GetActorLocation();
-
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(ControlledEnemy);
-
-	// ECC_Camera: WorldStatic, WorldDynamic 모두 차단
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		Start,
-		End,
-		ECC_Camera,  // WorldStatic(벽) + WorldDynamic 모두 감지
-		QueryParams
-	);
+	UFPSVisibilityCacheSubsystem* VisibilityCache = UFPSVisibilityCacheSubsystem::Get(this);
+	const FVector ObserverLocation = ControlledEnemy->GetActorLocation();
+	bool bResolvedThisUpdate = false;
 
-	// 플레이어에게 직접 닿으면 보임
-	return !bHit || HitResult.GetActor() == TargetPawn;
+	// 1. 이전에 요청한 쿼리 결과 반영 (근처 적들이 재사용하도록 공유 캐시에 저장)
+	if (LineOfSightQuery.IsValid())
+	{
+		if (const FFPSAsyncQueryResult* Result = AsyncQuery->GetResult(LineOfSightQuery))
+		{
+			// 플레이어에게 직접 닿으면 보임
+			bHasLineOfSight = !Result->HasBlockingHit() || Result->Hits[0].GetActor() == TargetPawn;
+			AsyncQuery->ReleaseQuery(LineOfSightQuery);
+			bResolvedThisUpdate = true;
+
+			if (VisibilityCache)
+			{
+				VisibilityCache->StoreVisibility(ObserverLocation, TargetPawn, ECC_Camera, bHasLineOfSight);
+			}
+		}
+		else if (AsyncQuery->GetStatus(LineOfSightQuery) == EFPSAsyncQueryStatus::Invalid)
+		{
+			LineOfSightQuery.Reset();
+		}
+	}
+
+	// 2. 캐시에 최근 결과가 있으면 새 트레이스 생략 (방금 받은 결과도 캐시에 막 들어간 최신 결과)
+	if (!LineOfSightQuery.IsValid() && VisibilityCache)
+	{
+		if (bResolvedThisUpdate)
+		{
+			return bHasLineOfSight;
+		}
+
+		bool bCachedVisible = false;
+		if (VisibilityCache->FindVisibility(ObserverLocation, TargetPawn, ECC_Camera, bCachedVisible))
+		{
+			bHasLineOfSight = bCachedVisible;
+			return bHasLineOfSight;
+		}
+	}
+
+	// 3. 다음 쿼리 요청 (진행 중인 쿼리가 있으면 결과를 기다림)
+	if (!LineOfSightQuery.IsValid())
+	{
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(FPSEnemyLineOfSight), false);
+		QueryParams.AddIgnoredActor(ControlledEnemy);
+
+		// ECC_Camera: WorldStatic(벽) + WorldDynamic 모두 차단
+		LineOfSightQuery = AsyncQuery->SubmitLineTrace(
+			this,
+			ObserverLocation,
+			TargetPawn->GetActorLocation(),
+			ECC_Camera,
+			QueryParams
+		);
+
+		if (VisibilityCache)
+		{
+			VisibilityCache->RecordTraces(1);
+		}
+	}
+
+	return bHasLineOfSight;
+}
+
+void AFPSEnemyAIController::ResetLineOfSight()
+{
+	bHasLineOfSight = false;
+
+	if (LineOfSightQuery.IsValid())
+	{
+		if (UFPSAsyncQuerySubsystem* AsyncQuery = GetWorld()->GetSubsystem<UFPSAsyncQuerySubsystem>())
+		{
+			AsyncQuery->ReleaseQuery(LineOfSightQuery);
+		}
+		LineOfSightQuery.Reset();
+	}
 }
 
 APawn* AFPSEnemyAIController::FindPlayerPawn()
 {
-	// 첫 번째 플레이어 컨트롤러 찾기
+	// 공간 해시에서 시야 범위 안의 가장 가까운 플레이어 폰
+	if (const UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+	{
+		if (!ControlledEnemy)
+		{
+			return nullptr;
+		}
+
+		AActor* Nearest = SpatialHash->FindNearest(ControlledEnemy->GetActorLocation(), SightRange, EFPSSpatialCategory::Pawn,
+			[](const AActor* Candidate)
+			{
+				const APawn* CandidatePawn = Cast<APawn>(Candidate);
+				return CandidatePawn && CandidatePawn->IsPlayerControlled();
+			});
+		return Cast<APawn>(Nearest);
+	}
+
+	// 공간 해시가 없는 월드: 첫 번째 플레이어 컨트롤러 찾기
 	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
 	if (PC && PC->GetPawn())
 	{
@@ -160,14 +311,33 @@ float AFPSEnemyAIController::GetDistanceToTarget() const
 	return FVector::Dist(ControlledEnemy->GetActorLocation(), TargetPawn->GetActorLocation());
 }
 
+double AFPSEnemyAIController::GetDistanceSquaredToTarget() const
+{
+	if (!TargetPawn || !ControlledEnemy)
+		return 0.0;
+
+	return FVector::DistSquared(ControlledEnemy->GetActorLocation(), TargetPawn->GetActorLocation());
+}
+
 bool AFPSEnemyAIController::IsInAttackRange() const
 {
-	return GetDistanceToTarget() <= AttackRange;
+	return GetDistanceSquaredToTarget() <= FMath::Square(AttackRange);
 }
 
 bool AFPSEnemyAIController::IsInSightRange() const
 {
-	return GetDistanceToTarget() <= SightRange;
+	return GetDistanceSquaredToTarget() <= FMath::Square(SightRange);
+}
+
+bool AFPSEnemyAIController::IsInVisionCone() const
+{
+	if (!TargetPawn || !ControlledEnemy || !IsInSightRange())
+		return false;
+
+	// dot(Forward, ToTarget) >= cos(SightAngle) * |ToTarget| (정규화/Acos 없이 비교)
+	const FVector ToTarget = TargetPawn->GetActorLocation() - ControlledEnemy->GetActorLocation();
+	const double DotProduct = FVector::DotProduct(ControlledEnemy->GetActorForwardVector(), ToTarget);
+	return DotProduct >= SightAngleCos * ToTarget.Size();
 }
 
 // AI 상태별 행동 함수들
@@ -196,7 +366,7 @@ void AFPSEnemyAIController::HandleChaseState()
 	}
 
 	// 시야에서 벗어났고 너무 멀면 추적 중단
-	if (!CanSeePlayer() && GetDistanceToTarget() > SightRange * 1.5f)
+	if (!CanSeePlayer() && GetDistanceSquaredToTarget() > FMath::Square(SightRange * 1.5f))
 	{
 		SetAIState(EAIState::Idle);
 		return;
@@ -240,10 +410,47 @@ void AFPSEnemyAIController::StartChasing()
 
 	FVector TargetLocation = TargetPawn->GetActorLocation();
 	FVector MyLocation = ControlledEnemy->GetActorLocation();
-	float Distance = FVector::Dist(MyLocation, TargetLocation);
 
+	// 플로우 필드 추적: 대상 필드에서 이동 방향만 읽어 가까운 지점으로 직선 이동 (경로 탐색 없음, 목표 지점은 네비메시 레이캐스트로 벽 앞까지)
+	UFPSFlowFieldSubsystem* FlowField = UFPSFlowFieldSubsystem::Get(this);
+	if (FlowField && FlowField->IsEnabled())
+	{
+		FVector FlowGoal;
+		if (FlowField->SampleMoveGoal(TargetPawn, MyLocation, FlowGoal))
+		{
+			if (UFPSPathRequestSubsystem* PathRequests = UFPSPathRequestSubsystem::Get(this))
+			{
+				PathRequests->CancelRequest(this);
+			}
+
+			FAIMoveRequest MoveRequest;
+			MoveRequest.SetGoalLocation(FlowGoal);
+			MoveRequest.SetAcceptanceRadius(25.0f);
+			MoveRequest.SetCanStrafe(false);
+			MoveRequest.SetUsePathfinding(false);
+
+			MoveTo(MoveRequest);
+			return;
+		}
+	}
 
-	// FAIMoveRequest 방식으로 이동
+	// 경로 요청 관리자: 목표가 허용 거리 안에서만 움직였고 경로를 따라가는 중(또는 결과 대기 중)이면 재탐색 생략
+	if (UFPSPathRequestSubsystem* PathRequests = UFPSPathRequestSubsystem::Get(this))
+	{
+		const bool bHasPath = GetMoveStatus() == EPathFollowingStatus::Moving || PathRequests->HasPendingRequest(this);
+		if (bHasPath && !PathRequests->ShouldRepath(LastChaseGoal, TargetLocation))
+		{
+			return;
+		}
+
+		if (PathRequests->RequestPath(this, MyLocation, TargetLocation))
+		{
+			LastChaseGoal = TargetLocation;
+			return;
+		}
+	}
+
+	// FAIMoveRequest 방식으로 이동 (네비게이션 데이터가 없거나 관리자가 없는 월드)
 	FAIMoveRequest MoveRequest;
 	MoveRequest.SetGoalLocation(TargetLocation);
 	MoveRequest.SetAcceptanceRadius(100.0f);
@@ -253,6 +460,25 @@ void AFPSEnemyAIController::StartChasing()
 	MoveTo(MoveRequest);
 }
 
+void AFPSEnemyAIController::FollowChasePath(FNavPathSharedPtr Corridor)
+{
+	// 결과가 오는 사이 추적을 그만뒀으면 무시
+	if (CurrentState != EAIState::Chase || !ControlledEnemy || !Corridor.IsValid() || !Corridor->IsValid())
+	{
+		return;
+	}
+
+	// 공유 경로를 복사하지 않고 그대로 따라감 (네비메시 변경 시 무효화/재탐색 알림을 받도록)
+	// 다른 에이전트 위치에서 시작한 경로여도 경로 추종 컴포넌트가 내 위치에서 가까운 구간부터 따라감
+	FAIMoveRequest MoveRequest;
+	MoveRequest.SetGoalLocation(LastChaseGoal);
+	MoveRequest.SetAcceptanceRadius(100.0f);
+	MoveRequest.SetCanStrafe(false);
+	MoveRequest.SetAllowPartialPath(true);
+
+	RequestMove(MoveRequest, Corridor);
+}
+
 void AFPSEnemyAIController::StartAttacking()
 {
 	if (!TargetPawn || !ControlledEnemy)
@@ -274,11 +500,13 @@ void AFPSEnemyAIController::StartAttacking()
 
 void AFPSEnemyAIController::StopAttacking()
 {
-	// 발사 타이머 정리
-	if (GetWorld())
+	// 진행 중인 버스트 중지
+	AFPSWeapon* Weapon = CachedWeapon.Get();
+	if (bBurstInProgress && Weapon)
 	{
-		GetWorld()->GetTimerManager().ClearTimer(FireTimer);
+		Weapon->StopFiring();
 	}
+	bBurstInProgress = false;
 }
 
 // 상태 변경
@@ -287,11 +515,13 @@ void AFPSEnemyAIController::SetAIState(EAIState NewState)
 	if (CurrentState == NewState)
 		return;
 
-	// 상태 변경 로그
-	FString StateNames[] = { TEXT("Idle"), TEXT("Patrol"), TEXT("Chase"), TEXT("Attack") };
-	UE_LOG(LogTemp, Log, TEXT("AI 상태 변경: %s -> %s"), 
-		*StateNames[(int32)CurrentState], 
-		*StateNames[(int32)NewState]
+	// 상태 변경 카운터 (상세 로그는 Verbose, 문자열 생성 없음)
+	INC_DWORD_STAT(STAT_FPSAIStateChanges);
+
+	static const TCHAR* StateNames[] = { TEXT("Idle"), TEXT("Patrol"), TEXT("Chase"), TEXT("Attack") };
+	UE_LOG(LogFPSAI, Verbose, TEXT("AI 상태 변경: %s -> %s"),
+		StateNames[(int32)CurrentState],
+		StateNames[(int32)NewState]
 	);
 
 	CurrentState = NewState;
@@ -318,84 +548,88 @@ void AFPSEnemyAIController::SetAIState(EAIState NewState)
 
 void AFPSEnemyAIController::FireWeapon()
 {
-	if (!ControlledEnemy)
+	AFPSWeapon* CurrentWeapon = CachedWeapon.Get();
+	if (!CurrentWeapon)
 	{
+		UE_LOG(LogFPSAI, Warning, TEXT("적이 무기를 가지고 있지 않음!"));
 		return;
 	}
 
-	// 현재 무기가 있는지 확인
-	UWeaponSlotComponent* WSC = ControlledEnemy->GetWeaponSlotComponent();
-	if (!WSC)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("적이 무기 슬롯 컴포넌트를 가지고 있지 않음!"));
-		return;
-	}
-	AFPSWeapon* CurrentWeapon = WSC->GetCurrentWeaponActor();
-	if (!CurrentWeapon)
+	// 짧은 버스트 발사 (종료는 무기가 연사 시계로 직접 처리)
+	if (!CurrentWeapon->StartBurst(0, BurstDuration))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("적이 무기를 가지고 있지 않음!"));
 		return;
 	}
 
-	// 무기 발사
-	CurrentWeapon->StartFiring();
+	bBurstInProgress = CurrentWeapon->IsInBurst();
 
 	// 마지막 발사 시간 업데이트
 	LastFireTime = GetWorld()->GetTimeSeconds();
 
-	// 디버그 메시지
-	if (GEngine)
+	UE_LOG(LogFPSAI, Verbose, TEXT("적 버스트 발사: %s"), *GetNameSafe(ControlledEnemy));
+}
+
+void AFPSEnemyAIController::OnWeaponBurstFinished(AFPSWeapon* Weapon, int32 ShotsFired, bool bCompleted)
+{
+	if (CachedWeapon.Get() == Weapon)
+	{
+		bBurstInProgress = false;
+	}
+}
+
+void AFPSEnemyAIController::RefreshCachedWeapon()
+{
+	UWeaponSlotComponent* WSC = ControlledEnemy ? ControlledEnemy->GetWeaponSlotComponent() : nullptr;
+	AFPSWeapon* NewWeapon = WSC ? WSC->GetCurrentWeaponActor() : nullptr;
+	if (CachedWeapon.Get() == NewWeapon)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::Red, TEXT("적이 발사!"));
+		return;
 	}
 
-	// 연사를 위해 다음 발사 예약 (단발 무기의 경우)
-	// 자동 무기는 FPSWeapon에서 자체적으로 연사 처리
-	if (GetWorld() && FireRate > 0.0f)
+	ClearCachedWeapon();
+
+	CachedWeapon = NewWeapon;
+	if (NewWeapon)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			FireTimer,
-			[this]()
-			{
-				if (ControlledEnemy)
-				{
-					UWeaponSlotComponent* _WSC = ControlledEnemy->GetWeaponSlotComponent();
-					if (!_WSC)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("적이 무기 슬롯 컴포넌트를 가지고 있지 않음!"));
-						return;
-					}
-					AFPSWeapon* _CurrentWeapon = _WSC->GetCurrentWeaponActor();
-					if (!_CurrentWeapon)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("적이 무기를 가지고 있지 않음!"));
-						return;
-					}
-
-					_CurrentWeapon->StopFiring();
-				}
-			},
-			0.1f,  // 짧게 발사하고 중단
-			false
-		);
+		NewWeapon->OnBurstFinished.AddDynamic(this, &AFPSEnemyAIController::OnWeaponBurstFinished);
 	}
 }
 
-bool AFPSEnemyAIController::CanFireWeapon() const
+void AFPSEnemyAIController::ClearCachedWeapon()
 {
-	if (!ControlledEnemy)
+	// 이전 무기의 버스트는 중지하고 바인딩 해제
+	if (AFPSWeapon* OldWeapon = CachedWeapon.Get())
 	{
-		return false;
+		OldWeapon->OnBurstFinished.RemoveDynamic(this, &AFPSEnemyAIController::OnWeaponBurstFinished);
+		if (bBurstInProgress)
+		{
+			OldWeapon->StopFiring();
+		}
 	}
 
+	CachedWeapon.Reset();
+	bBurstInProgress = false;
+}
+
+void AFPSEnemyAIController::OnWeaponSlotChanged(EWeaponSlot OldSlot, EWeaponSlot NewSlot)
+{
+	RefreshCachedWeapon();
+}
+
+void AFPSEnemyAIController::OnWeaponEquipped(EWeaponSlot SlotType, UWeaponItemData* WeaponItem, AFPSWeapon* WeaponActor)
+{
+	RefreshCachedWeapon();
+}
+
+void AFPSEnemyAIController::OnWeaponUnequipped(EWeaponSlot SlotType, UWeaponItemData* WeaponItem)
+{
+	RefreshCachedWeapon();
+}
+
+bool AFPSEnemyAIController::CanFireWeapon() const
+{
 	// 무기가 있는지 확인
-	UWeaponSlotComponent* WSC = ControlledEnemy->GetWeaponSlotComponent();
-	if (!WSC)
-	{
-		return false;
-	}
-	AFPSWeapon* CurrentWeapon = WSC->GetCurrentWeaponActor();
-	if (!CurrentWeapon)
+	if (!ControlledEnemy || !CachedWeapon.IsValid())
 	{
 		return false;
 	}
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "FPS/FPSAsyncQuerySubsystem.h"
+#include "FPS/Components/EWeaponSlot.h"
 #include "FPSEnemyAIController.generated.h"
 
 // AI 행동 상태
@@ -17,6 +19,8 @@ enum class EAIState : uint8
 };
 
 class AFPSEnemyCharacter;
+class AFPSWeapon;
+class UWeaponItemData;
 
 /**
  * 적 AI Controller - 플레이어 탐지, 추적, 공격
@@ -31,10 +35,11 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Pawn을 빙의했을 때 호출
 	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
 
 protected:
 	// AI 설정값들
@@ -48,12 +53,15 @@ protected:
 	float SightAngle = 60.0f; // 시야각 (도 단위)
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI Settings")
-	float TickInterval = 0.2f; // AI 업데이트 간격
+	float TickInterval = 0.2f; // AI 업데이트 기본 간격 (스케줄러가 등급에 따라 조정)
 
 	// 무기 관련 설정
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI Settings")
 	float FireRate = 1.0f; // 발사 간격 (초)
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI Settings")
+	float BurstDuration = 0.1f; // 한 번 발사할 때 버스트 지속 시간 (초)
+
 	// 현재 AI 상태
 	UPROPERTY(BlueprintReadOnly, Category = "AI State")
 	EAIState CurrentState = EAIState::Idle;
@@ -66,26 +74,61 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "AI State")
 	TObjectPtr<AFPSEnemyCharacter> ControlledEnemy;
 
-	// AI 업데이트 타이머
+	// AI 업데이트 타이머 (AI 스케줄러가 없는 월드에서만 사용)
 	FTimerHandle AIUpdateTimer;
 
 	// 무기 발사 관련
-	FTimerHandle FireTimer;
 	float LastFireTime = 0.0f;
 
-protected:
-	// AI 핵심 함수들
+	// 현재 무기 (무기 슬롯 변경 시 갱신, OnBurstFinished는 여기에 한 번만 바인딩)
+	TWeakObjectPtr<AFPSWeapon> CachedWeapon;
+
+	// 내가 시작한 버스트가 진행 중 (공격 중단 시 버스트 중지)
+	bool bBurstInProgress = false;
+
+	// 시야 차폐 비동기 쿼리 (결과는 다음 AI 업데이트에서 반영)
+	FFPSAsyncQueryHandle LineOfSightQuery;
+
+	// 마지막으로 확인된 시야 차폐 결과
+	bool bHasLineOfSight = false;
+
+	// 시야각 코사인 (BeginPlay에서 SightAngle로 계산, 시야각 판정에 Acos 대신 사용)
+	float SightAngleCos = 0.5f;
+
+	// 마지막으로 경로를 요청한 추적 목표 (허용 거리 안에서 움직이면 재탐색하지 않음)
+	FVector LastChaseGoal = FVector::ZeroVector;
+
+public:
+	// AI 업데이트 (AI 스케줄러 또는 대체 타이머에서 호출)
 	UFUNCTION()
 	void UpdateAI();
 
+	// AI 업데이트 기본 간격
+	float GetUpdateInterval() const { return TickInterval; }
+
+	// 경로 요청 관리자가 찾은 추적 코리더를 따라 이동 (공유 경로 그대로, 시작 구간은 경로 추종 컴포넌트가 내 위치 기준으로 결정)
+	void FollowChasePath(FNavPathSharedPtr Corridor);
+
+	// 군중에서 승격된 직후 이전 상태 복원 (추적/공격 중이었으면 대상을 바로 추적, 공격은 다음 업데이트에서 판정)
+	void RestoreState(EAIState State, APawn* Target);
+
+	// 시야 범위 / 시야각 코사인 (스케줄러 일괄 시야 판정용)
+	float GetSightRange() const { return SightRange; }
+	float GetSightAngleCos() const { return SightAngleCos; }
+
+protected:
 	// 플레이어 탐지
 	bool CanSeePlayer();
+	bool UpdateLineOfSight();
+	void ResetLineOfSight();
 	APawn* FindPlayerPawn();
 
 	// 거리 계산
 	float GetDistanceToTarget() const;
+	double GetDistanceSquaredToTarget() const;
 	bool IsInAttackRange() const;
 	bool IsInSightRange() const;
+	bool IsInVisionCone() const;
 
 	// AI 상태별 행동
 	void HandleIdleState();
@@ -104,6 +147,24 @@ protected:
 	void FireWeapon();
 	bool CanFireWeapon() const;
 
+	// 버스트 종료 알림
+	UFUNCTION()
+	void OnWeaponBurstFinished(AFPSWeapon* Weapon, int32 ShotsFired, bool bCompleted);
+
+	// 현재 무기 캐시 갱신 (바뀌었으면 이전 무기 바인딩 해제 후 새 무기에 바인딩)
+	void RefreshCachedWeapon();
+	void ClearCachedWeapon();
+
+	// 무기 슬롯 변경 알림 (캐시 갱신)
+	UFUNCTION()
+	void OnWeaponSlotChanged(EWeaponSlot OldSlot, EWeaponSlot NewSlot);
+
+	UFUNCTION()
+	void OnWeaponEquipped(EWeaponSlot SlotType, UWeaponItemData* WeaponItem, AFPSWeapon* WeaponActor);
+
+	UFUNCTION()
+	void OnWeaponUnequipped(EWeaponSlot SlotType, UWeaponItemData* WeaponItem);
+
 public:
 	// Blueprint에서 사용할 수 있는 함수들
 	UFUNCTION(BlueprintPure, Category = "AI")
@@ -1,7 +1,9 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/AI/FPSEnemyCharacter.h"
+#include "FPS/FPSLog.h"
 #include "FPS/AI/FPSEnemyAIController.h"
+#include "FPS/AI/FPSSignificanceSubsystem.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Components/WeaponSlotComponent.h"
 #include "FPS/Items/WeaponItemData.h"
@@ -20,6 +22,8 @@
 #include "AbilitySystemInterface.h"
 #include "GameplayEffect.h"
 #include "GameplayTagContainer.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/FPSRandomSubsystem.h"
 
 AFPSEnemyCharacter::AFPSEnemyCharacter()
 {
@@ -56,12 +60,28 @@ void AFPSEnemyCharacter::BeginPlay()
 
 	// AI 캐릭터에게 기본 무기 지급
 	GiveDefaultWeapon();
+
+	// 거리/시야에 따른 업데이트 빈도/애니메이션/이동 품질 조절 대상 등록
+	if (UFPSSignificanceSubsystem* Significance = UFPSSignificanceSubsystem::Get(this))
+	{
+		Significance->Register(this);
+	}
+}
+
+void AFPSEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFPSSignificanceSubsystem* Significance = UFPSSignificanceSubsystem::Get(this))
+	{
+		Significance->Unregister(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AFPSEnemyCharacter::OnHealthChanged(const FOnAttributeChangeData& Data)
 {
 	// 적 캐릭터는 HUD가 없으므로 디버그 로그만 출력
-	UE_LOG(LogTemp, VeryVerbose, TEXT("적 체력 변경: %f -> %f"), Data.OldValue, Data.NewValue);
+	UE_LOG(LogFPSAI, VeryVerbose, TEXT("적 체력 변경: %f -> %f"), Data.OldValue, Data.NewValue);
 
 	// ⚠️ Death 체크는 CharacterAttributeSet::PostGameplayEffectExecute에서 처리됨
 	// 여기서는 추가 로직 없음
@@ -75,7 +95,7 @@ void AFPSEnemyCharacter::OnPlayerDeath()
 	// 부모의 bIsAlive = false 설정
 	bIsAlive = false;
 
-	UE_LOG(LogTemp, Warning, TEXT("적 캐릭터 사망!"));
+	UE_LOG(LogFPSAI, Warning, TEXT("적 캐릭터 사망!"));
 
 	// 스킬 포인트 보상 (킬러에게 지급)
 	if (SkillPointGainEffect && AbilitySystemComponent)
@@ -105,14 +125,14 @@ void AFPSEnemyCharacter::OnPlayerDeath()
 				{
 					// SetByCaller로 스킬 포인트 보상량 전달
 					SpecHandle.Data->SetSetByCallerMagnitude(
-						FGameplayTag::RequestGameplayTag(FName("Data.SkillPointGain")),
+						FPSGameplayTags::Data_SkillPointGain,
 						static_cast<float>(SkillPointReward)
 					);
 
 					// 킬러에게 Effect 적용
 					KillerASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 
-					UE_LOG(LogTemp, Log, TEXT("스킬 포인트 %d 지급 (킬러: %s)"), SkillPointReward, *Killer->GetName());
+					UE_LOG(LogFPSAI, Log, TEXT("스킬 포인트 %d 지급 (킬러: %s)"), SkillPointReward, *Killer->GetName());
 				}
 			}
 		}
@@ -164,16 +184,22 @@ void AFPSEnemyCharacter::DropItems()
 	// ItemDropTableAsset이 설정되지 않은 경우 리턴
 	if (!ItemDropTableAsset)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ItemDropTableAsset이 설정되지 않음 - 아이템 드롭 없음"));
+		UE_LOG(LogFPSAI, Log, TEXT("ItemDropTableAsset이 설정되지 않음 - 아이템 드롭 없음"));
 		return;
 	}
 
-	// 드롭 테이블에서 아이템 추첨
-	TArray<UBaseItemData*> DroppedItems = ItemDropTableAsset->RollDrops();
+	// 드롭 테이블에서 아이템 추첨 (적별 드롭 스트림, 사망 시 한 번만 쓰므로 바로 해제)
+	TArray<UBaseItemData*> DroppedItems = ItemDropTableAsset->RollDropsWithStream(
+		UFPSRandomSubsystem::GetStreamFor(this, FPSRandomStreams::Drop));
+
+	if (UFPSRandomSubsystem* RandomSubsystem = GetWorld()->GetSubsystem<UFPSRandomSubsystem>())
+	{
+		RandomSubsystem->ReleaseStreams(this);
+	}
 
 	if (DroppedItems.Num() == 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("적이 아이템을 드롭하지 않음"));
+		UE_LOG(LogFPSAI, Log, TEXT("적이 아이템을 드롭하지 않음"));
 		return;
 	}
 
@@ -211,7 +237,7 @@ void AFPSEnemyCharacter::DropItems()
 				{
 					DroppedWeapon->SetWeaponItemData(WeaponData);
 					DroppedWeapon->SetDropped(true);
-					UE_LOG(LogTemp, Log, TEXT("무기 드롭: %s"), *WeaponData->GetItemName());
+					UE_LOG(LogFPSAI, Log, TEXT("무기 드롭: %s"), *WeaponData->GetItemName());
 				}
 
 				SpawnOffset += 50.0f;
@@ -241,7 +267,7 @@ void AFPSEnemyCharacter::DropItems()
 					// 포션 크기 조정 (기본 크기가 너무 큼)
 					DroppedItem->SetActorScale3D(FVector(0.1f, 0.1f, 0.1f));
 
-					UE_LOG(LogTemp, Log, TEXT("아이템 드롭: %s (개수: %d)"),
+					UE_LOG(LogFPSAI, Log, TEXT("아이템 드롭: %s (개수: %d)"),
 						*ItemData->GetItemName(), ItemData->CurrentStackSize);
 				}
 
@@ -259,7 +285,7 @@ void AFPSEnemyCharacter::Die()
 
 void AFPSEnemyCharacter::OnDeathDestroy()
 {
-	UE_LOG(LogTemp, Warning, TEXT("적 캐릭터 파괴 - 무기들은 OnOwnerDestroyed 델리게이트로 자동 처리됨"));
+	UE_LOG(LogFPSAI, Warning, TEXT("적 캐릭터 파괴 - 무기들은 OnOwnerDestroyed 델리게이트로 자동 처리됨"));
 
 	// 캐릭터 파괴 (무기들은 OnOwnerDestroyed 델리게이트를 통해 자동으로 파괴됨)
 	Destroy();
@@ -376,13 +402,13 @@ void AFPSEnemyCharacter::GiveDefaultWeapon()
 {
 	if (!DefaultWeaponData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("적의 기본 무기 데이터가 설정되지 않음!"));
+		UE_LOG(LogFPSAI, Warning, TEXT("적의 기본 무기 데이터가 설정되지 않음!"));
 		return;
 	}
 
 	if (!WeaponSlotComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("적에게 WeaponSlotComponent가 없음!"));
+		UE_LOG(LogFPSAI, Error, TEXT("적에게 WeaponSlotComponent가 없음!"));
 		return;
 	}
 
@@ -390,7 +416,7 @@ void AFPSEnemyCharacter::GiveDefaultWeapon()
 	UWeaponItemData* WeaponDataInstance = NewObject<UWeaponItemData>(this, DefaultWeaponData);
 	if (!WeaponDataInstance)
 	{
-		UE_LOG(LogTemp, Error, TEXT("WeaponItemData 인스턴스 생성 실패!"));
+		UE_LOG(LogFPSAI, Error, TEXT("WeaponItemData 인스턴스 생성 실패!"));
 		return;
 	}
 
@@ -398,7 +424,7 @@ void AFPSEnemyCharacter::GiveDefaultWeapon()
 	bool bEquipSuccess = WeaponSlotComponent->EquipWeaponToSlot(EWeaponSlot::Primary, WeaponDataInstance);
 	if (!bEquipSuccess)
 	{
-		UE_LOG(LogTemp, Error, TEXT("적의 무기 장착 실패: %s"), *DefaultWeaponData->GetName());
+		UE_LOG(LogFPSAI, Error, TEXT("적의 무기 장착 실패: %s"), *DefaultWeaponData->GetName());
 		return;
 	}
 
@@ -406,11 +432,11 @@ void AFPSEnemyCharacter::GiveDefaultWeapon()
 	bool bSwitchSuccess = WeaponSlotComponent->SwitchToSlot(EWeaponSlot::Primary);
 	if (bSwitchSuccess)
 	{
-		UE_LOG(LogTemp, Log, TEXT("AI 캐릭터에게 무기 지급 및 활성화 완료: %s"), *DefaultWeaponData->GetName());
+		UE_LOG(LogFPSAI, Log, TEXT("AI 캐릭터에게 무기 지급 및 활성화 완료: %s"), *DefaultWeaponData->GetName());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("무기 장착은 성공했지만 활성화 실패"));
+		UE_LOG(LogFPSAI, Warning, TEXT("무기 장착은 성공했지만 활성화 실패"));
 	}
 }
 
@@ -27,6 +27,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// 부모 클래스의 OnHealthChanged 오버라이드
 	virtual void OnHealthChanged(const FOnAttributeChangeData& Data) override;
@@ -60,7 +61,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI Weapon")
 	TSubclassOf<UWeaponItemData> DefaultWeaponData;
 
+	/** 소속 팀 (군중 승격/강등 시 그대로 이어짐) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI")
+	uint8 TeamId = 0;
+
 public:
+	/** AI 기본 무기 데이터 클래스 반환 */
+	TSubclassOf<UWeaponItemData> GetDefaultWeaponData() const { return DefaultWeaponData; }
+
+	/** 소속 팀 */
+	uint8 GetTeamId() const { return TeamId; }
+	void SetTeamId(uint8 NewTeamId) { TeamId = NewTeamId; }
+
 	// IFPSWeaponHolder 인터페이스 구현
 	virtual void AttachWeaponMeshes(AFPSWeapon* Weapon) override;
 	virtual void PlayFiringMontage(UAnimMontage* Montage) override;
@@ -0,0 +1,381 @@
+// FPSFlowFieldSubsystem.cpp
+
+#include "FPSFlowFieldSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+
+void UFPSFlowFieldSubsystem::Deinitialize()
+{
+	Fields.Empty();
+	CellStates.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+UFPSFlowFieldSubsystem* UFPSFlowFieldSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSFlowFieldSubsystem>() : nullptr;
+}
+
+void UFPSFlowFieldSubsystem::SetEnabled(bool bNewEnabled)
+{
+	bEnabled = bNewEnabled;
+	if (!bEnabled)
+	{
+		Fields.Empty();
+	}
+}
+
+FIntPoint UFPSFlowFieldSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize)
+	);
+}
+
+int32 UFPSFlowFieldSubsystem::GetLayer(double Height) const
+{
+	return FMath::FloorToInt32(Height / FMath::Max(2.0 * ProjectionHeight, 1.0));
+}
+
+const ANavigationData* UFPSFlowFieldSubsystem::GetNavData() const
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	return NavSys ? NavSys->GetDefaultNavDataInstance() : nullptr;
+}
+
+bool UFPSFlowFieldSubsystem::SampleDirection(const APawn* Target, const FVector& Location, FVector& OutDirection)
+{
+	if (!bEnabled || !Target)
+	{
+		return false;
+	}
+
+	FField* Field = Fields.Find(Target);
+	if (!Field)
+	{
+		// 처음 요청된 대상: 적분을 시작하고 완성될 때까지는 호출자가 다른 방식으로 이동
+		FField& NewField = Fields.Add(Target);
+		NewField.Target = Target;
+		NewField.LastSampleTime = GetWorld()->GetTimeSeconds();
+		BeginBuild(NewField, Target->GetActorLocation());
+		return false;
+	}
+
+	Field->LastSampleTime = GetWorld()->GetTimeSeconds();
+	if (!Field->bHasCosts)
+	{
+		return false;
+	}
+
+	const int32 Size = GetFieldSize();
+	const FIntPoint Local = GetCell(Location) - Field->Origin;
+	if (Local.X < 0 || Local.Y < 0 || Local.X >= Size || Local.Y >= Size)
+	{
+		return false;
+	}
+
+	const TArray<uint16>& Costs = Field->Costs;
+	const uint16 CurrentCost = Costs[Local.Y * Size + Local.X];
+	if (CurrentCost == UnreachedCost)
+	{
+		return false;
+	}
+
+	// 목표 셀이면 대상에게 직접
+	if (CurrentCost == 0)
+	{
+		OutDirection = (Target->GetActorLocation() - Location).GetSafeNormal2D();
+		return !OutDirection.IsZero();
+	}
+
+	auto GetCost = [&](int32 X, int32 Y)
+	{
+		return (X < 0 || Y < 0 || X >= Size || Y >= Size) ? UnreachedCost : Costs[Y * Size + X];
+	};
+
+	// 주변 8칸 중 비용이 가장 낮은 칸 쪽으로 (대각선은 양옆 직교 칸이 모두 도달 가능할 때만, 모서리 끼임 방지)
+	static const FIntPoint Offsets[] = {
+		{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+		{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+	};
+
+	uint16 BestCost = CurrentCost;
+	FIntPoint BestOffset = FIntPoint::ZeroValue;
+	for (const FIntPoint& Offset : Offsets)
+	{
+		const uint16 NeighborCost = GetCost(Local.X + Offset.X, Local.Y + Offset.Y);
+		if (NeighborCost >= BestCost)
+		{
+			continue;
+		}
+
+		const bool bDiagonal = Offset.X != 0 && Offset.Y != 0;
+		if (bDiagonal && (GetCost(Local.X + Offset.X, Local.Y) == UnreachedCost || GetCost(Local.X, Local.Y + Offset.Y) == UnreachedCost))
+		{
+			continue;
+		}
+
+		BestCost = NeighborCost;
+		BestOffset = Offset;
+	}
+
+	if (BestOffset == FIntPoint::ZeroValue)
+	{
+		return false;
+	}
+
+	OutDirection = FVector(BestOffset.X, BestOffset.Y, 0.0).GetSafeNormal();
+	return true;
+}
+
+bool UFPSFlowFieldSubsystem::SampleMoveGoal(const APawn* Target, const FVector& Location, FVector& OutGoal)
+{
+	FVector Direction;
+	if (!SampleDirection(Target, Location, Direction))
+	{
+		return false;
+	}
+
+	OutGoal = Location + Direction * LookaheadDistance;
+
+	// 경로 탐색 없이 직선으로 가므로, 내다보는 구간이 막혀 있으면 막힌 지점까지만
+	FVector HitLocation;
+	const ANavigationData* NavData = GetNavData();
+	if (NavData && NavData->Raycast(Location, OutGoal, HitLocation, NavData->GetDefaultQueryFilter(), this))
+	{
+		OutGoal = HitLocation;
+	}
+
+	return true;
+}
+
+void UFPSFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bEnabled || Fields.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	int32 Budget = MaxCellsPerFrame;
+
+	for (auto It = Fields.CreateIterator(); It; ++It)
+	{
+		FField& Field = It.Value();
+		const APawn* Target = Field.Target.Get();
+
+		// 대상이 사라졌거나 한동안 아무도 샘플링하지 않은 필드 제거
+		if (!Target || Now - Field.LastSampleTime > FieldIdleLifetime)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// 진행 중인 적분은 대상이 움직여도 끝까지 진행 (다시 시작하면 계속 움직이는 대상의 첫 필드가 완성되지 않음)
+		// 적분이 없을 때 대상이 완성된 필드의 목표 셀에서 RebuildCellDistance칸 이상 옮겼으면 새로 적분 (완성된 필드는 계속 사용)
+		if (!Field.bBuilding)
+		{
+			const FVector TargetLocation = Target->GetActorLocation();
+			const FIntPoint CellDelta = GetCell(TargetLocation) - (Field.Origin + FIntPoint(HalfExtentCells, HalfExtentCells));
+			if (!Field.bHasCosts || FMath::Max(FMath::Abs(CellDelta.X), FMath::Abs(CellDelta.Y)) >= RebuildCellDistance)
+			{
+				BeginBuild(Field, TargetLocation);
+			}
+		}
+
+		if (Field.bBuilding && Budget > 0)
+		{
+			Budget -= StepBuild(Field, Budget);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_FPSFlowFieldCells, MaxCellsPerFrame - FMath::Max(Budget, 0));
+}
+
+void UFPSFlowFieldSubsystem::BeginBuild(FField& Field, const FVector& TargetLocation)
+{
+	const int32 Size = GetFieldSize();
+
+	Field.BuildOrigin = GetCell(TargetLocation) - FIntPoint(HalfExtentCells, HalfExtentCells);
+	Field.BuildHeight = TargetLocation.Z;
+	Field.BuildLayer = GetLayer(TargetLocation.Z);
+
+	// 목표 셀도 캐시에 올려 두어야 목표에서 나가는 연결을 검사할 수 있음
+	bool bProjected = false;
+	Field.bBuildGoalWalkable = IsCellWalkable(Field.BuildOrigin + FIntPoint(HalfExtentCells, HalfExtentCells), Field.BuildLayer, Field.BuildHeight, bProjected);
+
+	Field.BuildCosts.Init(UnreachedCost, Size * Size);
+
+	const int32 GoalIndex = HalfExtentCells * Size + HalfExtentCells;
+	Field.BuildCosts[GoalIndex] = 0;
+	Field.Frontier.Reset();
+	Field.Frontier.Add(GoalIndex);
+	Field.FrontierHead = 0;
+	Field.bBuilding = true;
+}
+
+int32 UFPSFlowFieldSubsystem::StepBuild(FField& Field, int32 Budget)
+{
+	const int32 Size = GetFieldSize();
+	int32 Used = 0;
+
+	static const FIntPoint Offsets[] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+	const int32 GoalIndex = HalfExtentCells * Size + HalfExtentCells;
+
+	// 목표에서 바깥으로 너비 우선 적분 (균일 비용, 직교 이웃)
+	while (Field.FrontierHead < Field.Frontier.Num() && Used < Budget)
+	{
+		const int32 Index = Field.Frontier[Field.FrontierHead++];
+		const int32 X = Index % Size;
+		const int32 Y = Index / Size;
+		const uint16 NextCost = Field.BuildCosts[Index] + 1;
+		Used++;
+
+		for (const FIntPoint& Offset : Offsets)
+		{
+			const int32 NX = X + Offset.X;
+			const int32 NY = Y + Offset.Y;
+			if (NX < 0 || NY < 0 || NX >= Size || NY >= Size)
+			{
+				continue;
+			}
+
+			const int32 NeighborIndex = NY * Size + NX;
+			if (Field.BuildCosts[NeighborIndex] != UnreachedCost)
+			{
+				continue;
+			}
+
+			const FIntPoint NeighborCell = Field.BuildOrigin + FIntPoint(NX, NY);
+
+			bool bProjected = false;
+			const bool bWalkable = IsCellWalkable(NeighborCell, Field.BuildLayer, Field.BuildHeight, bProjected);
+			if (bProjected)
+			{
+				Used++;
+			}
+
+			if (!bWalkable)
+			{
+				continue;
+			}
+
+			// 셀 중심만 네비메시 위여도 사이가 막혀 있을 수 있음 (얇은 벽, 끊긴 네비메시 섬)
+			bool bRaycast = false;
+			const bool bFromUnwalkableGoal = Index == GoalIndex && !Field.bBuildGoalWalkable;
+			const bool bConnected = bFromUnwalkableGoal || IsEdgeOpen(Field.BuildOrigin + FIntPoint(X, Y), NeighborCell, Field.BuildLayer, bRaycast);
+			if (bRaycast)
+			{
+				Used++;
+			}
+
+			if (bConnected)
+			{
+				Field.BuildCosts[NeighborIndex] = NextCost;
+				Field.Frontier.Add(NeighborIndex);
+			}
+		}
+	}
+
+	// 적분 완료: 완성본과 교체
+	if (Field.FrontierHead >= Field.Frontier.Num())
+	{
+		Swap(Field.Costs, Field.BuildCosts);
+		Field.Origin = Field.BuildOrigin;
+		Field.bHasCosts = true;
+		Field.bBuilding = false;
+		Field.Frontier.Reset();
+		Field.FrontierHead = 0;
+	}
+
+	return Used;
+}
+
+bool UFPSFlowFieldSubsystem::IsCellWalkable(const FIntPoint& Cell, int32 Layer, double Height, bool& bProjected)
+{
+	bProjected = false;
+	const FIntVector CacheKey(Cell.X, Cell.Y, Layer);
+	if (const FCellState* CachedState = CellStates.Find(CacheKey))
+	{
+		return CachedState->bWalkable;
+	}
+
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+	{
+		return false;
+	}
+
+	// 셀 중심을 네비메시에 투영 (셀 안쪽 + 높이 범위 안에 네비메시가 있으면 이동 가능)
+	const FVector CellCenter((Cell.X + 0.5) * CellSize, (Cell.Y + 0.5) * CellSize, Height);
+	const FVector QueryExtent(CellSize * 0.5, CellSize * 0.5, ProjectionHeight);
+
+	FNavLocation Projected;
+	const bool bWalkable = NavSys->ProjectPointToNavigation(CellCenter, Projected, QueryExtent);
+
+	FCellState& NewState = CellStates.Add(CacheKey);
+	NewState.bWalkable = bWalkable;
+	NewState.Location = bWalkable ? Projected.Location : CellCenter;
+	bProjected = true;
+	return bWalkable;
+}
+
+bool UFPSFlowFieldSubsystem::IsEdgeOpen(const FIntPoint& From, const FIntPoint& To, int32 Layer, bool& bRaycast)
+{
+	bRaycast = false;
+
+	// 연결 결과는 +X / +Y 쪽 셀 기준으로 작은 좌표 셀에 기록 (양방향 공유)
+	const bool bAlongX = From.Y == To.Y;
+	const FIntPoint Lower = bAlongX ? (From.X < To.X ? From : To) : (From.Y < To.Y ? From : To);
+	const FIntPoint Upper = Lower == From ? To : From;
+	const uint8 EdgeBit = bAlongX ? EdgePlusX : EdgePlusY;
+
+	FCellState* LowerState = CellStates.Find(FIntVector(Lower.X, Lower.Y, Layer));
+	const FCellState* UpperState = CellStates.Find(FIntVector(Upper.X, Upper.Y, Layer));
+	if (!LowerState || !UpperState || !LowerState->bWalkable || !UpperState->bWalkable)
+	{
+		return false;
+	}
+
+	if (LowerState->CheckedEdges & EdgeBit)
+	{
+		return (LowerState->OpenEdges & EdgeBit) != 0;
+	}
+
+	const ANavigationData* NavData = GetNavData();
+	if (!NavData)
+	{
+		return false;
+	}
+
+	// 투영된 두 셀 위치 사이를 네비메시 위로 갈 수 있으면 연결
+	FVector HitLocation;
+	const bool bOpen = !NavData->Raycast(LowerState->Location, UpperState->Location, HitLocation, NavData->GetDefaultQueryFilter(), this);
+
+	LowerState->CheckedEdges |= EdgeBit;
+	if (bOpen)
+	{
+		LowerState->OpenEdges |= EdgeBit;
+	}
+
+	bRaycast = true;
+	return bOpen;
+}
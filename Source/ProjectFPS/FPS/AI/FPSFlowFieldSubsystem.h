@@ -0,0 +1,184 @@
+// FPSFlowFieldSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FPSFlowFieldSubsystem.generated.h"
+
+class APawn;
+class ANavigationData;
+
+/**
+ * 플로우 필드 추적 (월드 단위, 선택 기능)
+ * - 추적 대상(플레이어)마다 대상 주변 격자에 통합 비용 필드를 하나씩 만들고,
+ *   추적 중인 모든 에이전트는 자기 셀 주변 8칸만 보고 이동 방향을 얻음 (O(1), 에이전트별 경로 탐색 없음)
+ * - 격자 셀은 네비메시 투영으로 이동 가능 여부를 판정하고, 이웃 셀로는 두 셀 사이 네비메시 레이캐스트가 통과할 때만 확장
+ *   (얇은 벽이나 끊긴 네비메시 섬을 가로지르지 않음, 셀/연결 결과는 한 번만 계산해 캐시, 정적 네비메시 전제)
+ * - 필드는 대상이 완성된 필드의 목표 셀에서 RebuildCellDistance칸 이상 옮기면 새로 적분하며, 프레임당 MaxCellsPerFrame개 셀까지만 처리
+ *   (적분이 끝날 때까지 에이전트는 직전에 완성된 필드를 사용, 진행 중인 적분은 대상이 움직여도 끝까지 진행해 완성본을 점진적으로 갱신)
+ * - 한동안 샘플링되지 않은 필드는 제거
+ * - 필드 하나는 대상 높이의 XY 평면 한 층 (다층 구조에서는 대상과 같은 층만 유효)
+ *   셀 캐시는 높이 층(2 * ProjectionHeight)별로 따로 두어 다른 층의 투영 결과가 섞이지 않음
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSFlowFieldSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 플로우 필드 (없으면 nullptr) */
+	static UFPSFlowFieldSubsystem* Get(const UObject* WorldContext);
+
+	// ========================================
+	// Flow Field API
+	// ========================================
+
+	/** 플로우 필드 추적 사용 여부 (웨이브 모드 등에서 런타임에 전환) */
+	bool IsEnabled() const { return bEnabled; }
+	void SetEnabled(bool bNewEnabled);
+
+	/**
+	 * 대상 쪽으로 향하는 이동 방향 (XY 단위 벡터)
+	 * - 대상 필드가 없으면 만들기 시작하고 false (다음 적분 완료 후부터 사용 가능)
+	 * - 위치가 필드 밖이거나 대상에 도달할 수 없는 셀이면 false
+	 */
+	bool SampleDirection(const APawn* Target, const FVector& Location, FVector& OutDirection);
+
+	/**
+	 * 경로 탐색 없이 직선 이동할 목표 지점 (SampleDirection 방향으로 LookaheadDistance만큼)
+	 * - 그 구간이 네비메시 레이캐스트에 막히면 막힌 지점까지만
+	 */
+	bool SampleMoveGoal(const APawn* Target, const FVector& Location, FVector& OutGoal);
+
+	/** 활성 필드 수 */
+	int32 GetFieldCount() const { return Fields.Num(); }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 기본 사용 여부 */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field")
+	bool bEnabled = false;
+
+	/** 격자 셀 크기 */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 25.0))
+	float CellSize = 100.0f;
+
+	/** 대상 중심에서 필드 가장자리까지 셀 수 (필드 한 변 = 2 * HalfExtentCells + 1) */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 4, ClampMax = 250))
+	int32 HalfExtentCells = 40;
+
+	/** 프레임당 적분/네비메시 투영할 셀 수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 1))
+	int32 MaxCellsPerFrame = 2000;
+
+	/** 완성된 필드의 목표 셀에서 대상이 이 칸 수(체비쇼프 거리) 이상 옮기면 다시 적분 */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 1))
+	int32 RebuildCellDistance = 2;
+
+	/** 셀 이동 가능 판정 시 네비메시 투영 높이 범위 */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 0.0))
+	float ProjectionHeight = 200.0f;
+
+	/** 이동 목표를 잡을 때 방향으로 내다보는 거리 */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 0.0))
+	float LookaheadDistance = 300.0f;
+
+	/** 이 시간 동안 샘플링되지 않은 필드는 제거 (초) */
+	UPROPERTY(Config, EditAnywhere, Category = "Flow Field", meta = (ClampMin = 0.0))
+	float FieldIdleLifetime = 2.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 도달 불가 비용 */
+	static constexpr uint16 UnreachedCost = MAX_uint16;
+
+	/** 이웃 연결 비트 (셀 -> +X / +Y 이웃, 반대 방향은 이웃 셀 쪽에 기록) */
+	static constexpr uint8 EdgePlusX = 1 << 0;
+	static constexpr uint8 EdgePlusY = 1 << 1;
+
+	/** 셀 캐시 값 */
+	struct FCellState
+	{
+		/** 네비메시에 투영된 셀 위치 (연결 레이캐스트 기준점) */
+		FVector Location = FVector::ZeroVector;
+
+		bool bWalkable = false;
+
+		/** 연결 여부를 확인한 이웃 / 연결된 이웃 (EdgePlusX, EdgePlusY) */
+		uint8 CheckedEdges = 0;
+		uint8 OpenEdges = 0;
+	};
+
+	/** 대상 하나의 필드 (완성본 + 적분 중인 버퍼) */
+	struct FField
+	{
+		TWeakObjectPtr<const APawn> Target;
+
+		/** 완성된 필드 (샘플링용) */
+		TArray<uint16> Costs;
+		FIntPoint Origin = FIntPoint::ZeroValue;
+		bool bHasCosts = false;
+
+		/** 적분 중인 필드 */
+		TArray<uint16> BuildCosts;
+		FIntPoint BuildOrigin = FIntPoint::ZeroValue;
+		TArray<int32> Frontier;
+		int32 FrontierHead = 0;
+		bool bBuilding = false;
+
+		/** 적분 기준 높이 (대상 위치, 네비메시 투영에 사용) / 셀 캐시 높이 층 */
+		double BuildHeight = 0.0;
+		int32 BuildLayer = 0;
+
+		/** 목표 셀 중심이 네비메시 위인지 (아니면 목표 셀에서 나가는 연결은 검사하지 않음, 대상이 네비메시 가장자리에 있는 경우) */
+		bool bBuildGoalWalkable = false;
+
+		/** 마지막 샘플링 시간 */
+		double LastSampleTime = 0.0;
+	};
+
+	/** 위치 -> 셀 */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** 높이 -> 셀 캐시 높이 층 */
+	int32 GetLayer(double Height) const;
+
+	/** 필드 한 변 셀 수 */
+	int32 GetFieldSize() const { return 2 * HalfExtentCells + 1; }
+
+	/** 대상 현재 셀 기준으로 적분 시작 */
+	void BeginBuild(FField& Field, const FVector& TargetLocation);
+
+	/** 예산 안에서 적분 진행, 사용한 셀 수 반환 */
+	int32 StepBuild(FField& Field, int32 Budget);
+
+	/** 셀 이동 가능 여부 (캐시에 없으면 네비메시 투영, bProjected에 투영 여부) */
+	bool IsCellWalkable(const FIntPoint& Cell, int32 Layer, double Height, bool& bProjected);
+
+	/** 이동 가능한 두 직교 이웃 셀이 네비메시로 이어져 있는지 (캐시에 없으면 레이캐스트, bRaycast에 레이캐스트 여부) */
+	bool IsEdgeOpen(const FIntPoint& From, const FIntPoint& To, int32 Layer, bool& bRaycast);
+
+	/** 기본 네비메시 (없으면 nullptr) */
+	const ANavigationData* GetNavData() const;
+
+	/** 대상별 필드 */
+	TMap<TObjectKey<APawn>, FField> Fields;
+
+	/** 셀 캐시 (월드 격자 X, Y + 높이 층, 필드끼리 공유) */
+	TMap<FIntVector, FCellState> CellStates;
+};
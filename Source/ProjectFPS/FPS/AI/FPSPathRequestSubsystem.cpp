@@ -0,0 +1,271 @@
+// FPSPathRequestSubsystem.cpp
+
+#include "FPSPathRequestSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "FPS/AI/FPSEnemyAIController.h"
+#include "Engine/World.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+
+void UFPSPathRequestSubsystem::Deinitialize()
+{
+	Corridors.Empty();
+	QueuedKeys.Empty();
+	InFlightQueries.Empty();
+	PendingRequesters.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSPathRequestSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSPathRequestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSPathRequestSubsystem, STATGROUP_Tickables);
+}
+
+UFPSPathRequestSubsystem* UFPSPathRequestSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSPathRequestSubsystem>() : nullptr;
+}
+
+FIntVector UFPSPathRequestSubsystem::GetShareCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / ShareCellSize),
+		FMath::FloorToInt32(Location.Y / ShareCellSize),
+		FMath::FloorToInt32(Location.Z / ShareCellSize)
+	);
+}
+
+bool UFPSPathRequestSubsystem::ShouldRepath(const FVector& CurrentGoal, const FVector& NewGoal) const
+{
+	return FVector::DistSquared(CurrentGoal, NewGoal) > FMath::Square(RepathGoalTolerance);
+}
+
+bool UFPSPathRequestSubsystem::RequestPath(AFPSEnemyAIController* Requester, const FVector& Start, const FVector& Goal)
+{
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!Requester || !NavSys)
+	{
+		return false;
+	}
+
+	const FNavAgentProperties& AgentProperties = Requester->GetNavAgentPropertiesRef();
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProperties, Start);
+	if (!NavData)
+	{
+		return false;
+	}
+
+	FCorridorKey Key;
+	Key.StartCell = GetShareCell(Start);
+	Key.GoalCell = GetShareCell(Goal);
+	Key.NavData = NavData;
+
+	// 이전 요청은 버림 (목표가 바뀌었으면 다른 코리더)
+	CancelRequest(Requester);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	FCorridor* Corridor = Corridors.Find(Key);
+
+	// 1. 완료된 코리더 재사용 (네비메시 변경으로 무효화된 경로는 새로 탐색)
+	if (Corridor && !Corridor->bPending && Now - Corridor->CompletedTime <= CorridorLifetime
+		&& Corridor->Path.IsValid() && Corridor->Path->IsValid())
+	{
+		WindowReuses++;
+		INC_DWORD_STAT(STAT_FPSPathCorridorReuses);
+		Requester->FollowChasePath(Corridor->Path);
+		return true;
+	}
+
+	// 2. 대기/진행 중인 코리더에 합류
+	if (Corridor && Corridor->bPending)
+	{
+		WindowReuses++;
+		INC_DWORD_STAT(STAT_FPSPathCorridorReuses);
+		Corridor->Waiters.Add(Requester);
+		PendingRequesters.Add(Requester, Key);
+		return true;
+	}
+
+	// 3. 새 탐색 대기열에 추가
+	FCorridor& NewCorridor = Corridors.FindOrAdd(Key);
+	NewCorridor = FCorridor();
+	NewCorridor.Start = Start;
+	NewCorridor.Goal = Goal;
+	NewCorridor.AgentProperties = AgentProperties;
+	NewCorridor.NavData = NavData;
+	NewCorridor.bPending = true;
+	NewCorridor.Waiters.Add(Requester);
+
+	PendingRequesters.Add(Requester, Key);
+	QueuedKeys.Add(Key);
+	return true;
+}
+
+void UFPSPathRequestSubsystem::CancelRequest(AFPSEnemyAIController* Requester)
+{
+	FCorridorKey Key;
+	if (!PendingRequesters.RemoveAndCopyValue(Requester, Key))
+	{
+		return;
+	}
+
+	// 코리더 탐색은 계속 진행 (다른 에이전트가 합류할 수 있음)
+	if (FCorridor* Corridor = Corridors.Find(Key))
+	{
+		Corridor->Waiters.RemoveSingleSwap(Requester, EAllowShrinking::No);
+	}
+}
+
+void UFPSPathRequestSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	DispatchQueued();
+
+	WindowElapsed += DeltaTime;
+	if (WindowElapsed < 1.0)
+	{
+		return;
+	}
+
+	// 1초 구간 마감: 초당 탐색/재사용 수 갱신, 만료 코리더 정리
+	LastQueriesPerSecond = FMath::RoundToInt32(WindowQueries / WindowElapsed);
+	LastReusesPerSecond = FMath::RoundToInt32(WindowReuses / WindowElapsed);
+
+	UE_LOG(LogFPSAI, Verbose, TEXT("경로 요청: 탐색 %d/s, 코리더 재사용 %d/s, 대기 %d, 진행 %d, 코리더 %d"),
+		LastQueriesPerSecond, LastReusesPerSecond, QueuedKeys.Num(), InFlightQueries.Num(), Corridors.Num());
+
+	WindowQueries = 0;
+	WindowReuses = 0;
+	WindowElapsed = 0.0;
+
+	PruneExpired(GetWorld()->GetTimeSeconds());
+}
+
+void UFPSPathRequestSubsystem::DispatchQueued()
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+	{
+		return;
+	}
+
+	int32 Dispatched = 0;
+	while (QueuedKeys.Num() > 0 && Dispatched < MaxQueriesPerFrame)
+	{
+		const FCorridorKey Key = QueuedKeys[0];
+		QueuedKeys.RemoveAt(0, 1, EAllowShrinking::No);
+
+		FCorridor* Corridor = Corridors.Find(Key);
+		if (!Corridor || !Corridor->bPending)
+		{
+			continue;
+		}
+
+		// 기다리는 에이전트가 모두 취소했으면 탐색 생략
+		if (Corridor->Waiters.Num() == 0)
+		{
+			Corridors.Remove(Key);
+			continue;
+		}
+
+		const ANavigationData* NavData = Corridor->NavData.Get();
+		if (!NavData)
+		{
+			Corridor->bFailed = true;
+			CompleteCorridor(Key, *Corridor);
+			continue;
+		}
+
+		FPathFindingQuery Query(this, *NavData, Corridor->Start, Corridor->Goal, NavData->GetDefaultQueryFilter());
+		Query.SetAllowPartialPaths(true);
+
+		const uint32 QueryId = NavSys->FindPathAsync(Corridor->AgentProperties, Query,
+			FNavPathQueryDelegate::CreateUObject(this, &UFPSPathRequestSubsystem::OnPathFound));
+		if (QueryId == INVALID_NAVQUERYID)
+		{
+			Corridor->bFailed = true;
+			CompleteCorridor(Key, *Corridor);
+			continue;
+		}
+
+		InFlightQueries.Add(QueryId, Key);
+		Dispatched++;
+	}
+
+	WindowQueries += Dispatched;
+	INC_DWORD_STAT_BY(STAT_FPSPathQueries, Dispatched);
+}
+
+void UFPSPathRequestSubsystem::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	FCorridorKey Key;
+	if (!InFlightQueries.RemoveAndCopyValue(QueryId, Key))
+	{
+		return;
+	}
+
+	FCorridor* Corridor = Corridors.Find(Key);
+	if (!Corridor)
+	{
+		return;
+	}
+
+	Corridor->bFailed = Result != ENavigationQueryResult::Success || !Path.IsValid() || !Path->IsValid();
+	Corridor->Path = Corridor->bFailed ? nullptr : Path;
+
+	CompleteCorridor(Key, *Corridor);
+}
+
+void UFPSPathRequestSubsystem::CompleteCorridor(const FCorridorKey& Key, FCorridor& Corridor)
+{
+	Corridor.bPending = false;
+	Corridor.CompletedTime = GetWorld()->GetTimeSeconds();
+
+	// FollowChasePath 중 새 요청이 들어와도 안전하도록 대기 목록을 먼저 비움
+	TArray<TWeakObjectPtr<AFPSEnemyAIController>> Waiters = MoveTemp(Corridor.Waiters);
+	Corridor.Waiters.Reset();
+
+	const FNavPathSharedPtr Path = Corridor.Path;
+	const bool bFailed = Corridor.bFailed;
+
+	// 실패한 코리더는 캐시하지 않음 (대기 에이전트는 다음 AI 업데이트에서 다시 요청)
+	if (bFailed)
+	{
+		Corridors.Remove(Key);
+	}
+
+	for (const TWeakObjectPtr<AFPSEnemyAIController>& Waiter : Waiters)
+	{
+		AFPSEnemyAIController* Controller = Waiter.Get();
+		if (!Controller)
+		{
+			continue;
+		}
+
+		PendingRequesters.Remove(Controller);
+		if (!bFailed)
+		{
+			Controller->FollowChasePath(Path);
+		}
+	}
+}
+
+void UFPSPathRequestSubsystem::PruneExpired(double Now)
+{
+	for (auto It = Corridors.CreateIterator(); It; ++It)
+	{
+		const FCorridor& Corridor = It.Value();
+		if (!Corridor.bPending && Now - Corridor.CompletedTime > CorridorLifetime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,171 @@
+// FPSPathRequestSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "NavigationSystemTypes.h"
+#include "FPSPathRequestSubsystem.generated.h"
+
+class AFPSEnemyAIController;
+class ANavigationData;
+
+/**
+ * 추적 경로 요청 관리자 (월드 단위)
+ * - 시작 셀 + 목표 셀이 같은 요청은 경로 하나(코리더)를 공유
+ *   (가까이 모인 적들이 같은 플레이어를 쫓으면 경로 탐색 1번, 각자 자기 위치에서 코리더를 따라감)
+ * - 경로 탐색은 비동기(FindPathAsync)로 요청하며, 프레임당 MaxQueriesPerFrame개까지만 시작하고 나머지는 대기
+ * - 완료된 코리더는 CorridorLifetime 동안 재사용 (네비메시 변경으로 무효화된 경로는 재사용하지 않음)
+ * - 실패한 코리더는 캐시하지 않음 (다음 요청에서 다시 탐색)
+ * - 재탐색 여부(목표 이동 허용 거리)는 ShouldRepath로 판단
+ * - 초당 탐색 수/재사용 수는 1초 구간마다 갱신 (stat FPSGameplay, LogFPSAI Verbose)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSPathRequestSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSPathRequestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 경로 요청 관리자 (없으면 nullptr) */
+	static UFPSPathRequestSubsystem* Get(const UObject* WorldContext);
+
+	// ========================================
+	// Path Request API
+	// ========================================
+
+	/**
+	 * 추적 경로 요청
+	 * - 재사용 가능한 코리더가 있으면 즉시 Requester->FollowChasePath 호출 (공유 경로를 그대로 전달)
+	 * - 없으면 탐색 대기/진행 중인 코리더에 합류, 완료 시 호출 (실패하면 호출하지 않음)
+	 * @return 네비게이션 데이터가 없어 요청할 수 없으면 false
+	 */
+	bool RequestPath(AFPSEnemyAIController* Requester, const FVector& Start, const FVector& Goal);
+
+	/** 요청 취소 (완료 콜백을 받지 않음) */
+	void CancelRequest(AFPSEnemyAIController* Requester);
+
+	/** 결과를 기다리는 요청이 있는지 */
+	bool HasPendingRequest(const AFPSEnemyAIController* Requester) const { return PendingRequesters.Contains(Requester); }
+
+	/** 목표가 허용 거리 이상 움직였는지 */
+	bool ShouldRepath(const FVector& CurrentGoal, const FVector& NewGoal) const;
+
+	/** 직전 1초 구간 경로 탐색 수 */
+	int32 GetQueriesPerSecond() const { return LastQueriesPerSecond; }
+
+	/** 직전 1초 구간 코리더 재사용 수 */
+	int32 GetReusesPerSecond() const { return LastReusesPerSecond; }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 목표가 이 거리 이상 움직여야 재탐색 */
+	UPROPERTY(Config, EditAnywhere, Category = "Path Requests", meta = (ClampMin = 0.0))
+	float RepathGoalTolerance = 150.0f;
+
+	/** 코리더 공유 셀 크기 (시작/목표 위치 양자화) */
+	UPROPERTY(Config, EditAnywhere, Category = "Path Requests", meta = (ClampMin = 50.0))
+	float ShareCellSize = 300.0f;
+
+	/** 완료된 코리더 재사용 시간 (초) */
+	UPROPERTY(Config, EditAnywhere, Category = "Path Requests", meta = (ClampMin = 0.0))
+	float CorridorLifetime = 1.0f;
+
+	/** 프레임당 시작할 수 있는 경로 탐색 수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Path Requests", meta = (ClampMin = 1))
+	int32 MaxQueriesPerFrame = 4;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 코리더 키 */
+	struct FCorridorKey
+	{
+		FIntVector StartCell = FIntVector::ZeroValue;
+		FIntVector GoalCell = FIntVector::ZeroValue;
+		TObjectKey<ANavigationData> NavData;
+
+		bool operator==(const FCorridorKey& Other) const
+		{
+			return StartCell == Other.StartCell && GoalCell == Other.GoalCell && NavData == Other.NavData;
+		}
+
+		friend uint32 GetTypeHash(const FCorridorKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.StartCell), GetTypeHash(Key.GoalCell)), GetTypeHash(Key.NavData));
+		}
+	};
+
+	/** 코리더 (탐색 요청 + 결과) */
+	struct FCorridor
+	{
+		/** 탐색 요청 (처음 요청한 에이전트 기준) */
+		FVector Start = FVector::ZeroVector;
+		FVector Goal = FVector::ZeroVector;
+		FNavAgentProperties AgentProperties;
+		TWeakObjectPtr<const ANavigationData> NavData;
+
+		/** 결과 경로 (네비메시 변경 시 엔진이 무효화 후 재탐색, 따라가는 에이전트 모두 같은 경로를 봄) */
+		FNavPathSharedPtr Path;
+
+		/** 결과 도착 시간 */
+		double CompletedTime = 0.0;
+
+		/** 탐색 대기/진행 중인지 */
+		bool bPending = false;
+
+		/** 탐색 실패 */
+		bool bFailed = false;
+
+		/** 결과를 기다리는 에이전트 */
+		TArray<TWeakObjectPtr<AFPSEnemyAIController>> Waiters;
+	};
+
+	/** 위치 -> 공유 셀 */
+	FIntVector GetShareCell(const FVector& Location) const;
+
+	/** 대기 중인 탐색 시작 (예산만큼) */
+	void DispatchQueued();
+
+	/** 비동기 탐색 완료 콜백 */
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	/** 코리더 완료 처리 + 대기 에이전트에 전달 */
+	void CompleteCorridor(const FCorridorKey& Key, FCorridor& Corridor);
+
+	/** 만료된 코리더 정리 */
+	void PruneExpired(double Now);
+
+	/** 코리더 */
+	TMap<FCorridorKey, FCorridor> Corridors;
+
+	/** 예산 초과로 대기 중인 코리더 (요청 순서) */
+	TArray<FCorridorKey> QueuedKeys;
+
+	/** 진행 중인 탐색 ID -> 코리더 */
+	TMap<uint32, FCorridorKey> InFlightQueries;
+
+	/** 결과를 기다리는 에이전트 -> 코리더 */
+	TMap<TObjectKey<AFPSEnemyAIController>, FCorridorKey> PendingRequesters;
+
+	/** 현재 구간 집계 */
+	int32 WindowQueries = 0;
+	int32 WindowReuses = 0;
+	double WindowElapsed = 0.0;
+
+	/** 직전 구간 결과 */
+	int32 LastQueriesPerSecond = 0;
+	int32 LastReusesPerSecond = 0;
+};
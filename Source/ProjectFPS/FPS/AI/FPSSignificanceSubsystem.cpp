@@ -0,0 +1,319 @@
+// FPSSignificanceSubsystem.cpp
+
+#include "FPSSignificanceSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "FPS/AI/FPSEnemyCharacter.h"
+#include "FPS/Components/WeaponSlotComponent.h"
+#include "FPS/Weapons/FPSWeapon.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SkeletalMeshComponent.h"
+
+UFPSSignificanceSubsystem::UFPSSignificanceSubsystem()
+{
+	// 기본 단계 설정 (DefaultGame.ini에서 덮어씀)
+	HighTier.AIUpdateTier = EFPSAIUpdateTier::High;
+	HighTier.AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+	MediumTier.AIUpdateTier = EFPSAIUpdateTier::Normal;
+	MediumTier.MeshTickInterval = 0.033f;
+	MediumTier.AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+	LowTier.AIUpdateTier = EFPSAIUpdateTier::Low;
+	LowTier.MovementTickInterval = 0.05f;
+	LowTier.MeshTickInterval = 0.1f;
+	LowTier.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	LowTier.bWeaponCosmetics = false;
+
+	DormantTier.AIUpdateTier = EFPSAIUpdateTier::Low;
+	DormantTier.MovementTickInterval = 0.1f;
+	DormantTier.MeshTickInterval = 0.25f;
+	DormantTier.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	DormantTier.bWeaponCosmetics = false;
+}
+
+void UFPSSignificanceSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Viewers.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+UFPSSignificanceSubsystem* UFPSSignificanceSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSSignificanceSubsystem>() : nullptr;
+}
+
+void UFPSSignificanceSubsystem::Register(AFPSEnemyCharacter* Enemy)
+{
+	if (!Enemy || EntryIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.Enemy = Enemy;
+
+	const int32 EntryIndex = Entries.Add(Entry);
+	EntryIndices.Add(Enemy, EntryIndex);
+	TierCounts[static_cast<int32>(Entry.Tier)]++;
+}
+
+void UFPSSignificanceSubsystem::Unregister(AFPSEnemyCharacter* Enemy)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryIndices.RemoveAndCopyValue(Enemy, EntryIndex))
+	{
+		return;
+	}
+
+	TierCounts[static_cast<int32>(Entries[EntryIndex].Tier)]--;
+	Entries.RemoveAt(EntryIndex);
+}
+
+bool UFPSSignificanceSubsystem::GetTier(const APawn* Pawn, EFPSSignificanceTier& OutTier) const
+{
+	const int32* EntryIndex = EntryIndices.Find(Cast<AFPSEnemyCharacter>(Pawn));
+	if (!EntryIndex)
+	{
+		return false;
+	}
+
+	OutTier = Entries[*EntryIndex].Tier;
+	return true;
+}
+
+bool UFPSSignificanceSubsystem::GetAIUpdateTier(const APawn* Pawn, EFPSAIUpdateTier& OutTier) const
+{
+	EFPSSignificanceTier Tier;
+	if (!GetTier(Pawn, Tier))
+	{
+		return false;
+	}
+
+	OutTier = GetTierSettings(Tier).AIUpdateTier;
+	return true;
+}
+
+const FFPSSignificanceTierSettings& UFPSSignificanceSubsystem::GetTierSettings(EFPSSignificanceTier Tier) const
+{
+	switch (Tier)
+	{
+	case EFPSSignificanceTier::High:
+		return HighTier;
+	case EFPSSignificanceTier::Medium:
+		return MediumTier;
+	case EFPSSignificanceTier::Low:
+		return LowTier;
+	default:
+		return DormantTier;
+	}
+}
+
+void UFPSSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ViewConeCos = FMath::Cos(FMath::DegreesToRadians(ViewConeHalfAngle));
+	GatherViewers();
+
+	// EvaluationInterval 동안 전체를 한 바퀴 돌도록 이번 프레임 평가 수 결정
+	const int32 MaxIndex = Entries.GetMaxIndex();
+	if (EntryIndices.Num() > 0)
+	{
+		EvaluationCarry += EntryIndices.Num() * DeltaTime / EvaluationInterval;
+		int32 ToEvaluate = FMath::Min(FMath::FloorToInt32(EvaluationCarry), EntryIndices.Num());
+		EvaluationCarry -= ToEvaluate;
+
+		for (int32 Visited = 0; Visited < MaxIndex && ToEvaluate > 0; ++Visited)
+		{
+			if (EvaluationCursor >= MaxIndex)
+			{
+				EvaluationCursor = 0;
+			}
+
+			const int32 EntryIndex = EvaluationCursor++;
+			if (!Entries.IsAllocated(EntryIndex))
+			{
+				continue;
+			}
+
+			EvaluateEntry(Entries[EntryIndex]);
+			ToEvaluate--;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_FPSSignificanceHigh, TierCounts[static_cast<int32>(EFPSSignificanceTier::High)]);
+	SET_DWORD_STAT(STAT_FPSSignificanceMedium, TierCounts[static_cast<int32>(EFPSSignificanceTier::Medium)]);
+	SET_DWORD_STAT(STAT_FPSSignificanceLow, TierCounts[static_cast<int32>(EFPSSignificanceTier::Low)]);
+	SET_DWORD_STAT(STAT_FPSSignificanceDormant, TierCounts[static_cast<int32>(EFPSSignificanceTier::Dormant)]);
+}
+
+void UFPSSignificanceSubsystem::GatherViewers()
+{
+	Viewers.Reset();
+
+	// 서버에서는 원격 플레이어 시점도 포함 (AI는 서버에서 동작)
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->GetPawn())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		FViewer& Viewer = Viewers.AddDefaulted_GetRef();
+		Viewer.Location = ViewLocation;
+		Viewer.Direction = ViewRotation.Vector();
+	}
+}
+
+float UFPSSignificanceSubsystem::ComputeScore(const AFPSEnemyCharacter& Enemy) const
+{
+	const FVector Location = Enemy.GetActorLocation();
+	float BestScore = 0.0f;
+
+	for (const FViewer& Viewer : Viewers)
+	{
+		const FVector ToEnemy = Location - Viewer.Location;
+		const float Distance = ToEnemy.Size();
+
+		float Score = 1.0f - FMath::Clamp(Distance / MaxDistance, 0.0f, 1.0f);
+		if (FVector::DotProduct(Viewer.Direction, ToEnemy) >= ViewConeCos * Distance)
+		{
+			Score += InViewBonus;
+		}
+
+		BestScore = FMath::Max(BestScore, Score);
+	}
+
+	if (const USkeletalMeshComponent* Mesh = Enemy.GetMesh())
+	{
+		if (Mesh->WasRecentlyRendered(EvaluationInterval))
+		{
+			BestScore += RenderedBonus;
+		}
+	}
+
+	return BestScore;
+}
+
+float UFPSSignificanceSubsystem::GetTierThreshold(EFPSSignificanceTier Tier) const
+{
+	switch (Tier)
+	{
+	case EFPSSignificanceTier::High:
+		return HighScore;
+	case EFPSSignificanceTier::Medium:
+		return MediumScore;
+	case EFPSSignificanceTier::Low:
+		return LowScore;
+	default:
+		return 0.0f;
+	}
+}
+
+EFPSSignificanceTier UFPSSignificanceSubsystem::ScoreToTier(float Score, EFPSSignificanceTier CurrentTier) const
+{
+	const int32 Current = static_cast<int32>(CurrentTier);
+	const int32 Lowest = static_cast<int32>(EFPSSignificanceTier::Dormant);
+
+	// 히스테리시스 없이 점수만으로 정한 단계
+	int32 RawTier = Lowest;
+	for (int32 Tier = 0; Tier < Lowest; ++Tier)
+	{
+		if (Score >= GetTierThreshold(static_cast<EFPSSignificanceTier>(Tier)))
+		{
+			RawTier = Tier;
+			break;
+		}
+	}
+
+	// 올라가기: 목표 단계 경계 + 여유를 넘은 단계까지만
+	if (RawTier < Current)
+	{
+		while (RawTier < Current && Score < GetTierThreshold(static_cast<EFPSSignificanceTier>(RawTier)) + HysteresisMargin)
+		{
+			RawTier++;
+		}
+		return static_cast<EFPSSignificanceTier>(RawTier);
+	}
+
+	// 내려가기: 현재 단계 경계 - 여유 아래로 떨어졌을 때만
+	if (RawTier > Current && Score >= GetTierThreshold(CurrentTier) - HysteresisMargin)
+	{
+		return CurrentTier;
+	}
+
+	return static_cast<EFPSSignificanceTier>(RawTier);
+}
+
+void UFPSSignificanceSubsystem::EvaluateEntry(FEntry& Entry)
+{
+	AFPSEnemyCharacter* Enemy = Entry.Enemy.Get();
+	if (!Enemy)
+	{
+		return;
+	}
+
+	const EFPSSignificanceTier NewTier = ScoreToTier(ComputeScore(*Enemy), Entry.Tier);
+	if (NewTier != Entry.Tier)
+	{
+		TierCounts[static_cast<int32>(Entry.Tier)]--;
+		TierCounts[static_cast<int32>(NewTier)]++;
+		Entry.Tier = NewTier;
+		Entry.AppliedWeapon.Reset();
+
+		ApplyTier(*Enemy, NewTier);
+		INC_DWORD_STAT(STAT_FPSSignificanceTierChanges);
+	}
+
+	ApplyWeaponCosmetics(Entry, *Enemy);
+}
+
+void UFPSSignificanceSubsystem::ApplyTier(AFPSEnemyCharacter& Enemy, EFPSSignificanceTier Tier) const
+{
+	const FFPSSignificanceTierSettings& Settings = GetTierSettings(Tier);
+
+	if (UCharacterMovementComponent* Movement = Enemy.GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	if (USkeletalMeshComponent* Mesh = Enemy.GetMesh())
+	{
+		Mesh->SetComponentTickInterval(Settings.MeshTickInterval);
+		Mesh->VisibilityBasedAnimTickOption = Settings.AnimTickOption;
+	}
+}
+
+void UFPSSignificanceSubsystem::ApplyWeaponCosmetics(FEntry& Entry, AFPSEnemyCharacter& Enemy) const
+{
+	const UWeaponSlotComponent* WeaponSlots = Enemy.GetWeaponSlotComponent();
+	AFPSWeapon* Weapon = WeaponSlots ? WeaponSlots->GetCurrentWeaponActor() : nullptr;
+	if (!Weapon || Entry.AppliedWeapon.Get() == Weapon)
+	{
+		return;
+	}
+
+	Weapon->SetCosmeticsEnabled(GetTierSettings(Entry.Tier).bWeaponCosmetics);
+	Entry.AppliedWeapon = Weapon;
+}
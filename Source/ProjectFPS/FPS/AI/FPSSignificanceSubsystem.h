@@ -0,0 +1,224 @@
+// FPSSignificanceSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "FPS/AI/FPSAISchedulerSubsystem.h"
+#include "FPSSignificanceSubsystem.generated.h"
+
+class AFPSEnemyCharacter;
+class AFPSWeapon;
+
+/**
+ * 적 중요도 단계 (높은 것부터)
+ */
+UENUM(BlueprintType)
+enum class EFPSSignificanceTier : uint8
+{
+	High,     // 플레이어 근처 + 시야 안
+	Medium,   // 중거리 또는 근처지만 시야 밖
+	Low,      // 원거리
+	Dormant,  // 아주 멀고 보이지 않음
+	Count UMETA(Hidden)
+};
+
+/**
+ * 중요도 단계별 적용 설정
+ */
+USTRUCT(BlueprintType)
+struct FFPSSignificanceTierSettings
+{
+	GENERATED_BODY()
+
+	/** AI 업데이트 등급 (스케줄러 간격 배율, 공격 중이면 항상 High) */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	EFPSAIUpdateTier AIUpdateTier = EFPSAIUpdateTier::Normal;
+
+	/** CharacterMovement Tick 간격 (0 = 매 프레임) */
+	UPROPERTY(EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float MovementTickInterval = 0.0f;
+
+	/** 3인칭 메시 Tick 간격 (애니메이션 갱신 주기, 0 = 매 프레임) */
+	UPROPERTY(EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float MeshTickInterval = 0.0f;
+
+	/** 렌더링되지 않을 때 애니메이션 처리 방식 */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+	/** 무기 발사 연출 (총구 이펙트/트레이서/발사 몽타주) 사용 여부 */
+	UPROPERTY(EditAnywhere, Category = "Significance")
+	bool bWeaponCosmetics = true;
+};
+
+/**
+ * 적 중요도(Significance) 관리자 (월드 단위)
+ * - 등록된 적마다 가장 가까운 플레이어 시점까지의 거리 + 시야 원뿔 + 최근 렌더링 여부로 점수 계산
+ * - 점수를 단계로 바꿀 때 경계값 +-HysteresisMargin 을 넘어야 단계가 바뀜 (경계에서 깜빡임 방지)
+ * - 단계가 바뀔 때만 설정 적용: AI 업데이트 등급, CharacterMovement/메시 Tick 간격, 애니메이션 처리 방식, 무기 연출
+ * - 모든 적을 EvaluationInterval마다 한 번씩 나눠서 평가 (프레임당 일부만)
+ * - 단계별 적 수는 stat FPSGameplay 에서 확인
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSSignificanceSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UFPSSignificanceSubsystem();
+
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 중요도 관리자 (없으면 nullptr) */
+	static UFPSSignificanceSubsystem* Get(const UObject* WorldContext);
+
+	// ========================================
+	// Registration
+	// ========================================
+
+	/** 적 등록 (다음 평가 때 단계 결정, 그 전까지 High 설정 유지) */
+	void Register(AFPSEnemyCharacter* Enemy);
+
+	/** 적 해제 */
+	void Unregister(AFPSEnemyCharacter* Enemy);
+
+	// ========================================
+	// Queries
+	// ========================================
+
+	/** 폰의 현재 중요도 단계 (등록되지 않았으면 false) */
+	bool GetTier(const APawn* Pawn, EFPSSignificanceTier& OutTier) const;
+
+	/** 폰의 AI 업데이트 등급 (등록되지 않았으면 false) */
+	bool GetAIUpdateTier(const APawn* Pawn, EFPSAIUpdateTier& OutTier) const;
+
+	/** 단계별 적 수 */
+	int32 GetCountInTier(EFPSSignificanceTier Tier) const { return TierCounts[static_cast<int32>(Tier)]; }
+
+	/** 단계 설정 */
+	const FFPSSignificanceTierSettings& GetTierSettings(EFPSSignificanceTier Tier) const;
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 이 거리에서 거리 점수 0 */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 100.0))
+	float MaxDistance = 6000.0f;
+
+	/** 플레이어 시야 원뿔 반각 (도) */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0, ClampMax = 180.0))
+	float ViewConeHalfAngle = 60.0f;
+
+	/** 시야 원뿔 안에 있을 때 가산점 */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float InViewBonus = 0.2f;
+
+	/** 최근 렌더링되었을 때 가산점 */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float RenderedBonus = 0.1f;
+
+	/** 단계 경계 점수 (이 점수 이상이면 해당 단계) */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float HighScore = 0.75f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float MediumScore = 0.45f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float LowScore = 0.15f;
+
+	/** 단계 변경에 필요한 경계 초과량 (올라갈 때 경계 + 이 값, 내려갈 때 경계 - 이 값) */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.0))
+	float HysteresisMargin = 0.05f;
+
+	/** 모든 적을 한 번씩 평가하는 주기 (초) */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance", meta = (ClampMin = 0.01))
+	float EvaluationInterval = 0.25f;
+
+	/** 단계별 설정 */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	FFPSSignificanceTierSettings HighTier;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	FFPSSignificanceTierSettings MediumTier;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	FFPSSignificanceTierSettings LowTier;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	FFPSSignificanceTierSettings DormantTier;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 등록 항목 */
+	struct FEntry
+	{
+		TWeakObjectPtr<AFPSEnemyCharacter> Enemy;
+		EFPSSignificanceTier Tier = EFPSSignificanceTier::High;
+
+		/** 무기 연출 설정을 적용한 무기 (무기가 바뀌면 다시 적용) */
+		TWeakObjectPtr<AFPSWeapon> AppliedWeapon;
+	};
+
+	/** 플레이어 시점 */
+	struct FViewer
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Direction = FVector::ForwardVector;
+	};
+
+	/** 플레이어 시점 갱신 (프레임당 1회) */
+	void GatherViewers();
+
+	/** 점수 계산 (거리 + 시야 + 렌더링) */
+	float ComputeScore(const AFPSEnemyCharacter& Enemy) const;
+
+	/** 점수 -> 단계 (현재 단계 기준 히스테리시스) */
+	EFPSSignificanceTier ScoreToTier(float Score, EFPSSignificanceTier CurrentTier) const;
+
+	/** 단계 경계 점수 (Tier 이상이 되기 위한 최소 점수) */
+	float GetTierThreshold(EFPSSignificanceTier Tier) const;
+
+	/** 항목 평가 + 변경 시 적용 */
+	void EvaluateEntry(FEntry& Entry);
+
+	/** 단계 설정을 캐릭터에 적용 */
+	void ApplyTier(AFPSEnemyCharacter& Enemy, EFPSSignificanceTier Tier) const;
+
+	/** 무기 연출 설정 적용 (무기가 바뀌었을 때) */
+	void ApplyWeaponCosmetics(FEntry& Entry, AFPSEnemyCharacter& Enemy) const;
+
+	/** 등록 항목 (인덱스 고정) */
+	TSparseArray<FEntry> Entries;
+
+	/** 적 -> 항목 인덱스 */
+	TMap<TObjectKey<AFPSEnemyCharacter>, int32> EntryIndices;
+
+	/** 이번 프레임 플레이어 시점 */
+	TArray<FViewer, TInlineAllocator<4>> Viewers;
+
+	/** 다음 평가 위치 (희소 배열 인덱스) */
+	int32 EvaluationCursor = 0;
+
+	/** 평가 누적 (프레임당 평가할 항목 수의 소수부) */
+	float EvaluationCarry = 0.0f;
+
+	/** 단계별 적 수 */
+	int32 TierCounts[static_cast<int32>(EFPSSignificanceTier::Count)] = {};
+
+	/** cos(ViewConeHalfAngle) 캐시 */
+	float ViewConeCos = 0.5f;
+};
@@ -0,0 +1,126 @@
+// FPSVisibilityCacheSubsystem.cpp
+
+#include "FPSVisibilityCacheSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void UFPSVisibilityCacheSubsystem::Deinitialize()
+{
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSVisibilityCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSVisibilityCacheSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSVisibilityCacheSubsystem, STATGROUP_Tickables);
+}
+
+UFPSVisibilityCacheSubsystem* UFPSVisibilityCacheSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSVisibilityCacheSubsystem>() : nullptr;
+}
+
+UFPSVisibilityCacheSubsystem::FKey UFPSVisibilityCacheSubsystem::MakeKey(const FVector& ObserverLocation, const AActor* Target,
+	ECollisionChannel TraceChannel) const
+{
+	FKey Key;
+	Key.ObserverCell = FIntVector(
+		FMath::FloorToInt32(ObserverLocation.X / CellSize),
+		FMath::FloorToInt32(ObserverLocation.Y / CellSize),
+		FMath::FloorToInt32(ObserverLocation.Z / CellSize)
+	);
+	Key.Target = Target;
+	Key.TraceChannel = TraceChannel;
+	return Key;
+}
+
+bool UFPSVisibilityCacheSubsystem::FindVisibility(const FVector& ObserverLocation, const AActor* Target, ECollisionChannel TraceChannel,
+	bool& bOutVisible)
+{
+	if (!Target)
+	{
+		return false;
+	}
+
+	const FEntry* Entry = Entries.Find(MakeKey(ObserverLocation, Target, TraceChannel));
+	const bool bHit = Entry
+		&& GetWorld()->GetTimeSeconds() - Entry->StoredTime <= TimeToLive
+		&& FVector::DistSquared(Entry->TargetLocation, Target->GetActorLocation()) <= FMath::Square(TargetMoveThreshold);
+
+	if (!bHit)
+	{
+		WindowMisses++;
+		INC_DWORD_STAT(STAT_FPSVisibilityCacheMisses);
+		return false;
+	}
+
+	WindowHits++;
+	INC_DWORD_STAT(STAT_FPSVisibilityCacheHits);
+	bOutVisible = Entry->bVisible;
+	return true;
+}
+
+void UFPSVisibilityCacheSubsystem::StoreVisibility(const FVector& ObserverLocation, const AActor* Target, ECollisionChannel TraceChannel,
+	bool bVisible)
+{
+	if (!Target)
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(MakeKey(ObserverLocation, Target, TraceChannel));
+	Entry.TargetLocation = Target->GetActorLocation();
+	Entry.StoredTime = GetWorld()->GetTimeSeconds();
+	Entry.bVisible = bVisible;
+}
+
+void UFPSVisibilityCacheSubsystem::RecordTraces(int32 NumTraces)
+{
+	WindowTraces += NumTraces;
+	INC_DWORD_STAT_BY(STAT_FPSLineOfSightTraces, NumTraces);
+}
+
+void UFPSVisibilityCacheSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	WindowElapsed += DeltaTime;
+	if (WindowElapsed < 1.0)
+	{
+		return;
+	}
+
+	// 1초 구간 마감: 적중률/초당 트레이스 수 갱신, 만료 항목 정리
+	const int32 Lookups = WindowHits + WindowMisses;
+	LastHitRate = Lookups > 0 ? static_cast<float>(WindowHits) / Lookups : 0.0f;
+	LastTracesPerSecond = FMath::RoundToInt32(WindowTraces / WindowElapsed);
+
+	UE_LOG(LogFPSAI, Verbose, TEXT("시야 캐시: 적중률 %.0f%% (%d/%d), 트레이스 %d/s, 항목 %d"),
+		LastHitRate * 100.0f, WindowHits, Lookups, LastTracesPerSecond, Entries.Num());
+
+	WindowHits = 0;
+	WindowMisses = 0;
+	WindowTraces = 0;
+	WindowElapsed = 0.0;
+
+	PruneExpired(GetWorld()->GetTimeSeconds());
+}
+
+void UFPSVisibilityCacheSubsystem::PruneExpired(double Now)
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().StoredTime > TimeToLive)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,122 @@
+// FPSVisibilityCacheSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineTypes.h"
+#include "FPSVisibilityCacheSubsystem.generated.h"
+
+/**
+ * AI 시야(라인 오브 사이트) 공유 캐시 (월드 단위)
+ * - 키: 관찰자 위치를 CellSize로 양자화한 셀 + 타겟 + 트레이스 채널
+ *   (가까이 모인 적들은 같은 셀에 들어가므로 한 명의 트레이스 결과를 나머지가 재사용)
+ * - 결과는 TimeToLive 동안 유효, 저장 이후 타겟이 TargetMoveThreshold 이상 움직이면 무효
+ * - 적중률/초당 트레이스 수는 1초 구간마다 갱신 (stat FPSGameplay, LogFPSAI Verbose)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSVisibilityCacheSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSVisibilityCacheSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 시야 캐시 (없으면 nullptr) */
+	static UFPSVisibilityCacheSubsystem* Get(const UObject* WorldContext);
+
+	// ========================================
+	// Cache API
+	// ========================================
+
+	/** 유효한 결과가 있으면 bOutVisible에 담고 true (조회마다 적중/실패 집계) */
+	bool FindVisibility(const FVector& ObserverLocation, const AActor* Target, ECollisionChannel TraceChannel, bool& bOutVisible);
+
+	/** 트레이스 결과 저장 (타겟의 현재 위치를 무효화 기준으로 기록) */
+	void StoreVisibility(const FVector& ObserverLocation, const AActor* Target, ECollisionChannel TraceChannel, bool bVisible);
+
+	/** 캐시를 거치지 못해 실제로 요청한 시야 트레이스 수 집계 */
+	void RecordTraces(int32 NumTraces);
+
+	/** 직전 1초 구간 적중률 (0~1, 조회가 없었으면 0) */
+	float GetHitRate() const { return LastHitRate; }
+
+	/** 직전 1초 구간 시야 트레이스 수 */
+	int32 GetTracesPerSecond() const { return LastTracesPerSecond; }
+
+	/** 저장된 항목 수 */
+	int32 GetEntryCount() const { return Entries.Num(); }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 관찰자 위치 양자화 셀 크기 (이 크기 안에 모인 관찰자는 결과 공유) */
+	UPROPERTY(Config, EditAnywhere, Category = "Visibility Cache", meta = (ClampMin = 10.0))
+	float CellSize = 200.0f;
+
+	/** 결과 유효 시간 (초, AI 업데이트 간격보다 약간 길게) */
+	UPROPERTY(Config, EditAnywhere, Category = "Visibility Cache", meta = (ClampMin = 0.0))
+	float TimeToLive = 0.3f;
+
+	/** 저장 이후 타겟이 이 거리 이상 움직이면 무효 */
+	UPROPERTY(Config, EditAnywhere, Category = "Visibility Cache", meta = (ClampMin = 0.0))
+	float TargetMoveThreshold = 50.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 캐시 키 */
+	struct FKey
+	{
+		FIntVector ObserverCell = FIntVector::ZeroValue;
+		TObjectKey<AActor> Target;
+		ECollisionChannel TraceChannel = ECC_Visibility;
+
+		bool operator==(const FKey& Other) const
+		{
+			return ObserverCell == Other.ObserverCell && Target == Other.Target && TraceChannel == Other.TraceChannel;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.ObserverCell), GetTypeHash(Key.Target)), uint32(Key.TraceChannel));
+		}
+	};
+
+	/** 캐시 항목 */
+	struct FEntry
+	{
+		FVector TargetLocation = FVector::ZeroVector;
+		double StoredTime = 0.0;
+		bool bVisible = false;
+	};
+
+	/** 키 생성 */
+	FKey MakeKey(const FVector& ObserverLocation, const AActor* Target, ECollisionChannel TraceChannel) const;
+
+	/** 만료된 항목 정리 */
+	void PruneExpired(double Now);
+
+	/** 캐시 항목 */
+	TMap<FKey, FEntry> Entries;
+
+	/** 현재 구간 집계 */
+	int32 WindowHits = 0;
+	int32 WindowMisses = 0;
+	int32 WindowTraces = 0;
+	double WindowElapsed = 0.0;
+
+	/** 직전 구간 결과 */
+	float LastHitRate = 0.0f;
+	int32 LastTracesPerSecond = 0;
+};
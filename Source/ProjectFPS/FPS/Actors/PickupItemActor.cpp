@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "PickupItemActor.h"
+#include "FPS/FPSLog.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "NiagaraComponent.h"
@@ -9,6 +10,7 @@
 #include "../Components/InventoryComponent.h"
 #include "../Items/BaseItemData.h"
 #include "../FPSPlayerCharacter.h"
+#include "../FPSSpatialHashSubsystem.h"
 
 APickupItemActor::APickupItemActor()
 {
@@ -56,6 +58,15 @@ void APickupItemActor::BeginPlay()
 		PickupEffect->Activate();
 	}
 
+	// 드롭 상태면 픽업 근접 쿼리용 공간 해시 등록
+	if (bIsDropped)
+	{
+		if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+		{
+			SpatialHash->Register(this, EFPSSpatialCategory::Pickupable);
+		}
+	}
+
 	// ItemData에서 메시 설정
 	if (ItemData)
 	{
@@ -78,7 +89,7 @@ void APickupItemActor::BeginPlay()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("PickupItemActor: WorldMesh가 설정되지 않았습니다 - %s"),
+			UE_LOG(LogFPSInventory, Warning, TEXT("PickupItemActor: WorldMesh가 설정되지 않았습니다 - %s"),
 				*ItemData->GetItemName());
 		}
 	}
@@ -125,7 +136,7 @@ bool APickupItemActor::OnPickedUp(AFPSCharacter* Character)
 	AFPSPlayerCharacter* PlayerCharacter = Cast<AFPSPlayerCharacter>(Character);
 	if (!PlayerCharacter)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnPickedUp: FPSPlayerCharacter가 아닙니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("OnPickedUp: FPSPlayerCharacter가 아닙니다"));
 		return false;
 	}
 
@@ -133,7 +144,7 @@ bool APickupItemActor::OnPickedUp(AFPSCharacter* Character)
 	UInventoryComponent* InventoryComp = PlayerCharacter->GetInventoryComponent();
 	if (!InventoryComp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnPickedUp: InventoryComponent가 없습니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("OnPickedUp: InventoryComponent가 없습니다"));
 		return false;
 	}
 
@@ -143,7 +154,7 @@ bool APickupItemActor::OnPickedUp(AFPSCharacter* Character)
 
 	if (bPlaced)
 	{
-		UE_LOG(LogTemp, Log, TEXT("픽업 성공: %s → 인벤토리 (%d, %d)"), *ItemData->GetItemName(), OutX, OutY);
+		UE_LOG(LogFPSInventory, Log, TEXT("픽업 성공: %s → 인벤토리 (%d, %d)"), *ItemData->GetItemName(), OutX, OutY);
 
 		// 픽업 성공 → Actor 파괴
 		Destroy();
@@ -151,7 +162,7 @@ bool APickupItemActor::OnPickedUp(AFPSCharacter* Character)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("픽업 실패: %s - 인벤토리 공간 부족"), *ItemData->GetItemName());
+		UE_LOG(LogFPSInventory, Warning, TEXT("픽업 실패: %s - 인벤토리 공간 부족"), *ItemData->GetItemName());
 		return false;
 	}
 }
@@ -161,10 +172,36 @@ FString APickupItemActor::GetPickupDisplayName() const
 	return ItemData ? ItemData->GetItemName() : TEXT("Unknown Item");
 }
 
+void APickupItemActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->Unregister(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void APickupItemActor::SetDropped(bool bNewDropped)
 {
 	bIsDropped = bNewDropped;
 
+	// 드롭된 아이템만 픽업 쿼리 대상 (BeginPlay 전이면 BeginPlay에서 등록)
+	if (HasActorBegunPlay())
+	{
+		if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+		{
+			if (bIsDropped)
+			{
+				SpatialHash->Register(this, EFPSSpatialCategory::Pickupable);
+			}
+			else
+			{
+				SpatialHash->Unregister(this);
+			}
+		}
+	}
+
 	// 파티클 이펙트 제어
 	if (PickupEffect)
 	{
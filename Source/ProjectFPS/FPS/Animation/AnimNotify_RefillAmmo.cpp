@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/Animation/AnimNotify_RefillAmmo.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Weapons/FPSWeaponHolder.h"
 #include "FPS/Components/WeaponSlotComponent.h"
@@ -21,14 +22,14 @@ void UAnimNotify_RefillAmmo::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 
 	if (!MeshComp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AnimNotify_RefillAmmo: MeshComp가 null입니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("AnimNotify_RefillAmmo: MeshComp가 null입니다"));
 		return;
 	}
 
 	AActor* Owner = MeshComp->GetOwner();
 	if (!Owner)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AnimNotify_RefillAmmo: Owner가 null입니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("AnimNotify_RefillAmmo: Owner가 null입니다"));
 		return;
 	}
 
@@ -44,7 +45,7 @@ void UAnimNotify_RefillAmmo::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 				// 탄약 보충
 				ActiveWeaponItem->RefillAmmo();
 
-				UE_LOG(LogTemp, Log, TEXT("AnimNotify_RefillAmmo: %s 무기 탄약 보충 완료 (%d/%d)"),
+				UE_LOG(LogFPSCombat, Log, TEXT("AnimNotify_RefillAmmo: %s 무기 탄약 보충 완료 (%d/%d)"),
 					*ActiveWeaponItem->GetItemName(),
 					ActiveWeaponItem->CurrentAmmo,
 					ActiveWeaponItem->MagazineSize);
@@ -54,17 +55,17 @@ void UAnimNotify_RefillAmmo::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 			}
 			else
 			{
-				UE_LOG(LogTemp, Warning, TEXT("AnimNotify_RefillAmmo: 활성화된 무기가 없습니다"));
+				UE_LOG(LogFPSCombat, Warning, TEXT("AnimNotify_RefillAmmo: 활성화된 무기가 없습니다"));
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("AnimNotify_RefillAmmo: WeaponSlotComponent를 찾을 수 없습니다"));
+			UE_LOG(LogFPSCombat, Warning, TEXT("AnimNotify_RefillAmmo: WeaponSlotComponent를 찾을 수 없습니다"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AnimNotify_RefillAmmo: Owner가 IFPSWeaponHolder 인터페이스를 구현하지 않습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("AnimNotify_RefillAmmo: Owner가 IFPSWeaponHolder 인터페이스를 구현하지 않습니다"));
 	}
 }
 
@@ -2,6 +2,7 @@
 
 
 #include "FPS/CharacterAttributeSet.h"
+#include "FPS/FPSLog.h"
 #include "FPS/GameplayEffect_StaminaRecover.h"
 #include "FPS/FPSCharacter.h"
 #include "Net/UnrealNetwork.h"
@@ -10,6 +11,7 @@
 #include "UI/DamageNumberWidget.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
+#include "FPS/FPSGameplayTags.h"
 
 // Static 변수 초기화
 TSubclassOf<UDamageNumberWidget> UCharacterAttributeSet::DamageNumberWidgetClass = nullptr;
@@ -125,7 +127,7 @@ void UCharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModC
 {
 	Super::PostGameplayEffectExecute(Data);
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("PostGameplayEffectExecute 호출됨! Attribute: %s"), *Data.EvaluatedData.Attribute.GetName());
+	UE_LOG(LogFPSCombat, VeryVerbose, TEXT("PostGameplayEffectExecute 호출됨! Attribute: %s"), *Data.EvaluatedData.Attribute.GetName());
 
 	// Health 처리 - Shield 우선 소모 + 클램핑 + Death 체크
 	if (Data.EvaluatedData.Attribute == GetHealthAttribute())
@@ -147,7 +149,7 @@ void UCharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModC
 					if (APawn* InstigatorPawn = Cast<APawn>(InstigatorActor))
 					{
 						Character->SetLastAttacker(InstigatorPawn);
-						UE_LOG(LogTemp, VeryVerbose, TEXT("공격자 추적: %s → %s"), *InstigatorPawn->GetName(), *Character->GetName());
+						UE_LOG(LogFPSCombat, VeryVerbose, TEXT("공격자 추적: %s → %s"), *InstigatorPawn->GetName(), *Character->GetName());
 					}
 				}
 			}
@@ -165,7 +167,7 @@ void UCharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModC
 				// Shield가 막은 만큼 Health를 다시 복구
 				SetHealth(GetHealth() + ShieldDamage);
 
-				UE_LOG(LogTemp, Log, TEXT("Shield 데미지 처리: Shield %.1f → %.1f (흡수: %.1f), Health 복구: +%.1f"),
+				UE_LOG(LogFPSCombat, Verbose, TEXT("Shield 데미지 처리: Shield %.1f → %.1f (흡수: %.1f), Health 복구: +%.1f"),
 					CurrentShield, GetShield(), ShieldDamage, ShieldDamage);
 			}
 		}
@@ -191,7 +193,7 @@ void UCharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModC
 					if (Character->bIsAlive)
 					{
 						Character->OnPlayerDeath();
-						UE_LOG(LogTemp, Log, TEXT("PostGameplayEffectExecute: Health 0 도달 → Death 처리 (bIsAlive: true -> false)"));
+						UE_LOG(LogFPSCombat, Log, TEXT("PostGameplayEffectExecute: Health 0 도달 → Death 처리 (bIsAlive: true -> false)"));
 					}
 				}
 			}
@@ -226,7 +228,7 @@ void UCharacterAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModC
 				for (const FActiveGameplayEffectHandle& Handle : ActiveEffects)
 				{
 					ASC->RemoveActiveGameplayEffect(Handle);
-					UE_LOG(LogTemp, VeryVerbose, TEXT("PostGameplayEffectExecute: 스태미나 최대치 도달, StaminaRecover Effect 제거"));
+					UE_LOG(LogFPSCombat, VeryVerbose, TEXT("PostGameplayEffectExecute: 스태미나 최대치 도달, StaminaRecover Effect 제거"));
 				}
 			}
 		}
@@ -265,7 +267,7 @@ void UCharacterAttributeSet::SpawnDamageNumberWidget(const FGameplayEffectModCal
 
 	// 크리티컬 여부 가져오기 (SetByCaller 방식)
 	bool bIsCritical = false;
-	if (Data.EffectSpec.GetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(FName("Data.IsCritical"))) > 0.5f)
+	if (Data.EffectSpec.GetSetByCallerMagnitude(FPSGameplayTags::Data_IsCritical) > 0.5f)
 	{
 		bIsCritical = true;
 	}
@@ -273,7 +275,7 @@ void UCharacterAttributeSet::SpawnDamageNumberWidget(const FGameplayEffectModCal
 	// Static 변수에서 위젯 클래스 가져오기 (FPSCharacter BeginPlay에서 설정됨)
 	if (!DamageNumberWidgetClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DamageNumberWidget 클래스를 찾을 수 없습니다!"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("DamageNumberWidget 클래스를 찾을 수 없습니다!"));
 		return;
 	}
 
@@ -304,7 +306,7 @@ void UCharacterAttributeSet::SpawnDamageNumberWidget(const FGameplayEffectModCal
 		// 위치 설정 (Canvas Panel에 추가하기 위해서는 SetPositionInViewport 사용)
 		DamageWidget->SetPositionInViewport(ScreenPosition);
 
-		UE_LOG(LogTemp, Log, TEXT("데미지 숫자 위젯 생성: %.0f (크리티컬: %s) at (%.0f, %.0f)"),
+		UE_LOG(LogFPSCombat, Verbose, TEXT("데미지 숫자 위젯 생성: %.0f (크리티컬: %s) at (%.0f, %.0f)"),
 			DamageAmount, bIsCritical ? TEXT("예") : TEXT("아니오"), ScreenPosition.X, ScreenPosition.Y);
 	}
 }
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/Components/InventoryComponent.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Items/BaseItemData.h"
 
 UInventoryComponent::UInventoryComponent()
@@ -32,7 +33,7 @@ void UInventoryComponent::InitializeInventory()
 	GridSlots.Empty(TotalSlots);
 	GridSlots.SetNum(TotalSlots);
 
-	UE_LOG(LogTemp, Log, TEXT("InventoryComponent 초기화 완료: %dx%d = %d 슬롯"), GridWidth, GridHeight, TotalSlots);
+	UE_LOG(LogFPSInventory, Log, TEXT("InventoryComponent 초기화 완료: %dx%d = %d 슬롯"), GridWidth, GridHeight, TotalSlots);
 }
 
 // ==================== 핵심 함수 구현 ====================
@@ -41,7 +42,7 @@ bool UInventoryComponent::CanPlaceItemAt(UBaseItemData* Item, int32 GridX, int32
 {
 	if (!Item)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CanPlaceItemAt: Item이 null입니다."));
+		UE_LOG(LogFPSInventory, Warning, TEXT("CanPlaceItemAt: Item이 null입니다."));
 		return false;
 	}
 
@@ -117,7 +118,8 @@ bool UInventoryComponent::PlaceItemAt(UBaseItemData* Item, int32 GridX, int32 Gr
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("아이템 배치 성공: %s x%d at (%d, %d), Size: %dx%d"),
+	INC_DWORD_STAT(STAT_FPSInventoryPlacements);
+	UE_LOG(LogFPSInventory, Verbose, TEXT("아이템 배치 성공: %s x%d at (%d, %d), Size: %dx%d"),
 		*Item->GetItemName(), StackCount, GridX, GridY, Item->GridWidth, Item->GridHeight);
 
 	// 인벤토리 변경 이벤트 발생
@@ -131,7 +133,7 @@ bool UInventoryComponent::RemoveItemAt(int32 GridX, int32 GridY)
 	// 범위 체크
 	if (GridX < 0 || GridX >= GridWidth || GridY < 0 || GridY >= GridHeight)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("RemoveItemAt: 잘못된 좌표 (%d, %d)"), GridX, GridY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("RemoveItemAt: 잘못된 좌표 (%d, %d)"), GridX, GridY);
 		return false;
 	}
 
@@ -139,7 +141,7 @@ bool UInventoryComponent::RemoveItemAt(int32 GridX, int32 GridY)
 	int32 OriginX, OriginY;
 	if (!FindItemOrigin(GridX, GridY, OriginX, OriginY))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("RemoveItemAt: Origin을 찾을 수 없습니다. (%d, %d)"), GridX, GridY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("RemoveItemAt: Origin을 찾을 수 없습니다. (%d, %d)"), GridX, GridY);
 		return false;
 	}
 
@@ -148,7 +150,7 @@ bool UInventoryComponent::RemoveItemAt(int32 GridX, int32 GridY)
 
 	if (!Item)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("RemoveItemAt: ItemData가 없습니다. (%d, %d)"), OriginX, OriginY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("RemoveItemAt: ItemData가 없습니다. (%d, %d)"), OriginX, OriginY);
 		return false;
 	}
 
@@ -165,7 +167,7 @@ bool UInventoryComponent::RemoveItemAt(int32 GridX, int32 GridY)
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("아이템 제거 성공: %s at (%d, %d)"), *Item->GetItemName(), OriginX, OriginY);
+	UE_LOG(LogFPSInventory, Log, TEXT("아이템 제거 성공: %s at (%d, %d)"), *Item->GetItemName(), OriginX, OriginY);
 
 	// 인벤토리 변경 이벤트 발생
 	OnInventoryChanged.Broadcast();
@@ -177,7 +179,7 @@ bool UInventoryComponent::AutoPlaceItem(UBaseItemData* Item, int32& OutX, int32&
 {
 	if (!Item)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AutoPlaceItem: Item이 null입니다."));
+		UE_LOG(LogFPSInventory, Warning, TEXT("AutoPlaceItem: Item이 null입니다."));
 		return false;
 	}
 
@@ -202,7 +204,8 @@ bool UInventoryComponent::AutoPlaceItem(UBaseItemData* Item, int32& OutX, int32&
 					Slot.ItemData->CurrentStackSize += StackCount;
 					OutX = X;
 					OutY = Y;
-					UE_LOG(LogTemp, Log, TEXT("AutoPlaceItem 스택 추가: %s x%d (총 %d개) at (%d, %d)"),
+					INC_DWORD_STAT(STAT_FPSInventoryPlacements);
+					UE_LOG(LogFPSInventory, Verbose, TEXT("AutoPlaceItem 스택 추가: %s x%d (총 %d개) at (%d, %d)"),
 						*Item->GetItemName(), StackCount, Slot.ItemData->CurrentStackSize, X, Y);
 
 					// 인벤토리 변경 이벤트
@@ -224,7 +227,7 @@ bool UInventoryComponent::AutoPlaceItem(UBaseItemData* Item, int32& OutX, int32&
 				{
 					OutX = X;
 					OutY = Y;
-					UE_LOG(LogTemp, Log, TEXT("AutoPlaceItem 새 슬롯: %s x%d at (%d, %d)"),
+					UE_LOG(LogFPSInventory, Verbose, TEXT("AutoPlaceItem 새 슬롯: %s x%d at (%d, %d)"),
 						*Item->GetItemName(), StackCount, X, Y);
 					return true;
 				}
@@ -233,7 +236,7 @@ bool UInventoryComponent::AutoPlaceItem(UBaseItemData* Item, int32& OutX, int32&
 	}
 
 	// 빈 공간 없음
-	UE_LOG(LogTemp, Warning, TEXT("AutoPlaceItem 실패: 인벤토리 공간 부족! (%s)"), *Item->GetItemName());
+	UE_LOG(LogFPSInventory, Warning, TEXT("AutoPlaceItem 실패: 인벤토리 공간 부족! (%s)"), *Item->GetItemName());
 	return false;
 }
 
@@ -243,7 +246,7 @@ bool UInventoryComponent::MoveItem(int32 FromX, int32 FromY, int32 ToX, int32 To
 	int32 OriginX, OriginY;
 	if (!FindItemOrigin(FromX, FromY, OriginX, OriginY))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveItem: From 위치에 아이템이 없습니다. (%d, %d)"), FromX, FromY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("MoveItem: From 위치에 아이템이 없습니다. (%d, %d)"), FromX, FromY);
 		return false;
 	}
 
@@ -252,14 +255,14 @@ bool UInventoryComponent::MoveItem(int32 FromX, int32 FromY, int32 ToX, int32 To
 
 	if (!Item)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveItem: ItemData가 없습니다. (%d, %d)"), OriginX, OriginY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("MoveItem: ItemData가 없습니다. (%d, %d)"), OriginX, OriginY);
 		return false;
 	}
 
 	// 새 위치에 배치 가능한지 체크
 	if (!CanPlaceItemAt(Item, ToX, ToY))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveItem: To 위치에 배치할 수 없습니다. (%d, %d)"), ToX, ToY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("MoveItem: To 위치에 배치할 수 없습니다. (%d, %d)"), ToX, ToY);
 		return false;
 	}
 
@@ -279,7 +282,7 @@ bool UInventoryComponent::MoveItem(int32 FromX, int32 FromY, int32 ToX, int32 To
 	// 새 위치에 배치
 	PlaceItemAt(Item, ToX, ToY, Item->CurrentStackSize);
 
-	UE_LOG(LogTemp, Log, TEXT("아이템 이동 성공: %s (%d, %d) -> (%d, %d)"),
+	UE_LOG(LogFPSInventory, Verbose, TEXT("아이템 이동 성공: %s (%d, %d) -> (%d, %d)"),
 		*Item->GetItemName(), OriginX, OriginY, ToX, ToY);
 
 	return true;
@@ -328,7 +331,7 @@ bool UInventoryComponent::FindItemOrigin(int32 GridX, int32 GridY, int32& OutOri
 	// 유효한 Origin인지 확인
 	if (OriginPos.X < 0 || OriginPos.Y < 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FindItemOrigin: 유효하지 않은 OriginPos (%d, %d) at (%d, %d)"),
+		UE_LOG(LogFPSInventory, Warning, TEXT("FindItemOrigin: 유효하지 않은 OriginPos (%d, %d) at (%d, %d)"),
 			OriginPos.X, OriginPos.Y, GridX, GridY);
 		return false;
 	}
@@ -365,7 +368,7 @@ bool UInventoryComponent::DecreaseStackAt(int32 GridX, int32 GridY, int32 Amount
 	int32 OriginX, OriginY;
 	if (!FindItemOrigin(GridX, GridY, OriginX, OriginY))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DecreaseStackAt: Origin을 찾을 수 없습니다. (%d, %d)"), GridX, GridY);
+		UE_LOG(LogFPSInventory, Warning, TEXT("DecreaseStackAt: Origin을 찾을 수 없습니다. (%d, %d)"), GridX, GridY);
 		return false;
 	}
 
@@ -374,14 +377,14 @@ bool UInventoryComponent::DecreaseStackAt(int32 GridX, int32 GridY, int32 Amount
 
 	if (!Slot.ItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DecreaseStackAt: ItemData가 없습니다."));
+		UE_LOG(LogFPSInventory, Warning, TEXT("DecreaseStackAt: ItemData가 없습니다."));
 		return false;
 	}
 
 	// 스택 개수 체크
 	if (Slot.ItemData->CurrentStackSize < Amount)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DecreaseStackAt: 스택 개수 부족. 현재: %d, 요청: %d"),
+		UE_LOG(LogFPSInventory, Warning, TEXT("DecreaseStackAt: 스택 개수 부족. 현재: %d, 요청: %d"),
 			Slot.ItemData->CurrentStackSize, Amount);
 		return false;
 	}
@@ -392,11 +395,11 @@ bool UInventoryComponent::DecreaseStackAt(int32 GridX, int32 GridY, int32 Amount
 	// 스택이 0이 되면 아이템 제거
 	if (Slot.ItemData->CurrentStackSize <= 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("DecreaseStackAt: 스택이 0이 되어 아이템 제거"));
+		UE_LOG(LogFPSInventory, Log, TEXT("DecreaseStackAt: 스택이 0이 되어 아이템 제거"));
 		return RemoveItemAt(OriginX, OriginY);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("DecreaseStackAt: %d개 감소, 남은 스택: %d"), Amount, Slot.ItemData->CurrentStackSize);
+	UE_LOG(LogFPSInventory, Verbose, TEXT("DecreaseStackAt: %d개 감소, 남은 스택: %d"), Amount, Slot.ItemData->CurrentStackSize);
 
 	// 인벤토리 변경 이벤트
 	OnInventoryChanged.Broadcast();
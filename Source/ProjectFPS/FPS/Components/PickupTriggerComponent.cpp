@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "PickupTriggerComponent.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Interfaces/Pickupable.h"
 #include "FPS/FPSCharacter.h"
 #include "FPS/FPSPlayerCharacter.h"
@@ -36,7 +37,7 @@ void UPickupTriggerComponent::BeginPlay()
 	// 소유자가 IPickupable을 구현하는지 확인
 	if (!GetPickupableOwner())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("PickupTriggerComponent: 소유자가 IPickupable 인터페이스를 구현하지 않습니다! %s"),
+		UE_LOG(LogFPSInventory, Warning, TEXT("PickupTriggerComponent: 소유자가 IPickupable 인터페이스를 구현하지 않습니다! %s"),
 			GetOwner() ? *GetOwner()->GetName() : TEXT("Unknown"));
 	}
 }
@@ -57,7 +58,7 @@ void UPickupTriggerComponent::OnSphereBeginOverlap(UPrimitiveComponent* Overlapp
 				FString Message = FString::Printf(TEXT("[E] %s"), *PickupableOwner->GetPickupDisplayName());
 				ToastManager->ShowToast(Message, 0.0f); // 무한 표시 (Overlap 중)
 			}
-			UE_LOG(LogTemp, Log, TEXT("픽업 UI 표시: %s"), *PickupableOwner->GetPickupDisplayName());
+			UE_LOG(LogFPSInventory, Log, TEXT("픽업 UI 표시: %s"), *PickupableOwner->GetPickupDisplayName());
 		}
 	}
 }
@@ -73,7 +74,7 @@ void UPickupTriggerComponent::OnSphereEndOverlap(UPrimitiveComponent* Overlapped
 		{
 			ToastManager->HideToast();
 		}
-		UE_LOG(LogTemp, Log, TEXT("픽업 UI 숨김"));
+		UE_LOG(LogFPSInventory, Log, TEXT("픽업 UI 숨김"));
 	}
 }
 
@@ -96,21 +97,21 @@ bool UPickupTriggerComponent::TryPickup(AFPSCharacter* Character)
 	IPickupable* PickupableOwner = GetPickupableOwner();
 	if (!PickupableOwner)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("TryPickup: 소유자가 IPickupable을 구현하지 않습니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("TryPickup: 소유자가 IPickupable을 구현하지 않습니다"));
 		return false;
 	}
 
 	// 드롭 상태인지 확인
 	if (!PickupableOwner->IsDropped())
 	{
-		UE_LOG(LogTemp, Log, TEXT("TryPickup: 아이템이 드롭 상태가 아닙니다"));
+		UE_LOG(LogFPSInventory, Log, TEXT("TryPickup: 아이템이 드롭 상태가 아닙니다"));
 		return false;
 	}
 
 	// 픽업 가능한지 확인
 	if (!PickupableOwner->CanBePickedUp(Character))
 	{
-		UE_LOG(LogTemp, Log, TEXT("TryPickup: 픽업 불가능 상태"));
+		UE_LOG(LogFPSInventory, Log, TEXT("TryPickup: 픽업 불가능 상태"));
 		return false;
 	}
 
@@ -125,12 +126,12 @@ bool UPickupTriggerComponent::TryPickup(AFPSCharacter* Character)
 				FString::Printf(TEXT("%s 픽업 완료!"), *DisplayName));
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("픽업 성공: %s"), *PickupableOwner->GetPickupDisplayName());
+		UE_LOG(LogFPSInventory, Log, TEXT("픽업 성공: %s"), *PickupableOwner->GetPickupDisplayName());
 		return true;
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("픽업 실패: %s"), *PickupableOwner->GetPickupDisplayName());
+		UE_LOG(LogFPSInventory, Log, TEXT("픽업 실패: %s"), *PickupableOwner->GetPickupDisplayName());
 		return false;
 	}
 }
@@ -154,7 +155,7 @@ bool UPickupTriggerComponent::CanPickup(AFPSCharacter* Character) const
 void UPickupTriggerComponent::SetPickupRange(float NewRadius)
 {
 	SetSphereRadius(NewRadius);
-	UE_LOG(LogTemp, Log, TEXT("픽업 범위 설정: %.1f"), NewRadius);
+	UE_LOG(LogFPSInventory, Log, TEXT("픽업 범위 설정: %.1f"), NewRadius);
 }
 
 IPickupable* UPickupTriggerComponent::GetPickupableOwner() const
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/Components/SkillComponent.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Skills/BaseSkillData.h"
 #include "FPS/PlayerAttributeSet.h"
 #include "AbilitySystemComponent.h"
@@ -21,15 +22,15 @@ void USkillComponent::BeginPlay()
 		if (SkillData && SkillData->SkillID.IsValid())
 		{
 			SkillDataMap.Add(SkillData->SkillID, SkillData);
-			UE_LOG(LogTemp, Log, TEXT("스킬 등록: %s"), *SkillData->SkillID.ToString());
+			UE_LOG(LogFPS, Log, TEXT("스킬 등록: %s"), *SkillData->SkillID.ToString());
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("유효하지 않은 스킬 데이터 발견"));
+			UE_LOG(LogFPS, Warning, TEXT("유효하지 않은 스킬 데이터 발견"));
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("SkillComponent 초기화 완료: %d개 스킬 등록"), SkillDataMap.Num());
+	UE_LOG(LogFPS, Log, TEXT("SkillComponent 초기화 완료: %d개 스킬 등록"), SkillDataMap.Num());
 
 	// AbilitySystemComponent 캐싱
 	if (AActor* Owner = GetOwner())
@@ -47,42 +48,42 @@ ESkillAcquireResult USkillComponent::TryAcquireSkill(const FGameplayTag& SkillID
 	UBaseSkillData* SkillData = FindSkillData(SkillID);
 	if (!SkillData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("스킬을 찾을 수 없음: %s"), *SkillID.ToString());
+		UE_LOG(LogFPS, Warning, TEXT("스킬을 찾을 수 없음: %s"), *SkillID.ToString());
 		return ESkillAcquireResult::InvalidSkill;
 	}
 
 	// 2. 이미 습득했는지 확인
 	if (HasSkill(SkillID))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("이미 습득한 스킬: %s"), *SkillData->SkillName.ToString());
+		UE_LOG(LogFPS, Warning, TEXT("이미 습득한 스킬: %s"), *SkillData->SkillName.ToString());
 		return ESkillAcquireResult::AlreadyAcquired;
 	}
 
 	// 3. 습득 가능 여부 확인 (선행 스킬, 스킬 포인트)
 	if (!CanAcquireSkill(SkillID))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("스킬 습득 조건 미충족: %s"), *SkillData->SkillName.ToString());
+		UE_LOG(LogFPS, Warning, TEXT("스킬 습득 조건 미충족: %s"), *SkillData->SkillName.ToString());
 		return ESkillAcquireResult::PrerequisiteNotMet;
 	}
 
 	// 4. 스킬 포인트 확인 및 소모
 	if (!CachedASC.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("AbilitySystemComponent를 찾을 수 없음"));
+		UE_LOG(LogFPS, Error, TEXT("AbilitySystemComponent를 찾을 수 없음"));
 		return ESkillAcquireResult::InvalidSkill;
 	}
 
 	const UPlayerAttributeSet* PlayerAttrSet = CachedASC->GetSet<UPlayerAttributeSet>();
 	if (!PlayerAttrSet)
 	{
-		UE_LOG(LogTemp, Error, TEXT("PlayerAttributeSet를 찾을 수 없음"));
+		UE_LOG(LogFPS, Error, TEXT("PlayerAttributeSet를 찾을 수 없음"));
 		return ESkillAcquireResult::InvalidSkill;
 	}
 
 	float CurrentSkillPoints = PlayerAttrSet->GetSkillPoint();
 	if (CurrentSkillPoints < SkillData->RequiredSkillPoints)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("스킬 포인트 부족: 필요 %d, 보유 %.0f"),
+		UE_LOG(LogFPS, Warning, TEXT("스킬 포인트 부족: 필요 %d, 보유 %.0f"),
 			SkillData->RequiredSkillPoints, CurrentSkillPoints);
 		return ESkillAcquireResult::InsufficientPoints;
 	}
@@ -98,7 +99,7 @@ ESkillAcquireResult USkillComponent::TryAcquireSkill(const FGameplayTag& SkillID
 	// 7. 습득한 스킬 목록에 추가
 	AcquiredSkills.Add(SkillID);
 
-	UE_LOG(LogTemp, Log, TEXT("스킬 습득 성공: %s (남은 포인트: %.0f)"),
+	UE_LOG(LogFPS, Log, TEXT("스킬 습득 성공: %s (남은 포인트: %.0f)"),
 		*SkillData->SkillName.ToString(), MutableAttrSet->GetSkillPoint());
 
 	return ESkillAcquireResult::Success;
@@ -132,7 +133,7 @@ bool USkillComponent::CanAcquireSkill(const FGameplayTag& SkillID) const
 
 		if (!bHasAnyPrerequisite)
 		{
-			UE_LOG(LogTemp, VeryVerbose, TEXT("선행 스킬 조건 미충족"));
+			UE_LOG(LogFPS, VeryVerbose, TEXT("선행 스킬 조건 미충족"));
 			return false;
 		}
 	}
@@ -142,7 +143,7 @@ bool USkillComponent::CanAcquireSkill(const FGameplayTag& SkillID) const
 	{
 		if (HasSkill(ExclusiveSkill))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("상호배타적 스킬 이미 습득됨: %s"), *ExclusiveSkill.ToString());
+			UE_LOG(LogFPS, Warning, TEXT("상호배타적 스킬 이미 습득됨: %s"), *ExclusiveSkill.ToString());
 			return false;
 		}
 	}
@@ -153,7 +154,7 @@ bool USkillComponent::CanAcquireSkill(const FGameplayTag& SkillID) const
 		UBaseSkillData* AcquiredSkillData = FindSkillData(AcquiredSkillID);
 		if (AcquiredSkillData && AcquiredSkillData->MutuallyExclusiveSkills.Contains(SkillID))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("이미 습득한 스킬이 이 스킬을 막음: %s"), *AcquiredSkillID.ToString());
+			UE_LOG(LogFPS, Warning, TEXT("이미 습득한 스킬이 이 스킬을 막음: %s"), *AcquiredSkillID.ToString());
 			return false;
 		}
 	}
@@ -205,7 +206,7 @@ void USkillComponent::ApplySkillEffects(UBaseSkillData* SkillData)
 			if (SpecHandle.IsValid())
 			{
 				CachedASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-				UE_LOG(LogTemp, Log, TEXT("GameplayEffect 적용: %s"), *EffectClass->GetName());
+				UE_LOG(LogFPS, Log, TEXT("GameplayEffect 적용: %s"), *EffectClass->GetName());
 			}
 		}
 	}
@@ -217,7 +218,7 @@ void USkillComponent::ApplySkillEffects(UBaseSkillData* SkillData)
 		{
 			FGameplayAbilitySpec AbilitySpec(AbilityClass, 1, INDEX_NONE, GetOwner());
 			CachedASC->GiveAbility(AbilitySpec);
-			UE_LOG(LogTemp, Log, TEXT("GameplayAbility 부여: %s"), *AbilityClass->GetName());
+			UE_LOG(LogFPS, Log, TEXT("GameplayAbility 부여: %s"), *AbilityClass->GetName());
 
 			// 액티브 스킬인 경우 AbilityTag + SkillData 저장 (Q키 + UI용)
 			if (SkillData->SkillType == ESkillType::Active && AbilityClass.GetDefaultObject())
@@ -231,7 +232,7 @@ void USkillComponent::ApplySkillEffects(UBaseSkillData* SkillData)
 					// SkillData 저장 (UI용 - 아이콘, 이름 등)
 					ActiveSkillData = SkillData;
 
-					UE_LOG(LogTemp, Log, TEXT("액티브 스킬 저장: %s (태그: %s)"),
+					UE_LOG(LogFPS, Log, TEXT("액티브 스킬 저장: %s (태그: %s)"),
 						*SkillData->SkillName.ToString(), *ActiveSkillAbilityTag.ToString());
 
 					// UI 업데이트 델리게이트 호출 - SkillData 전달!
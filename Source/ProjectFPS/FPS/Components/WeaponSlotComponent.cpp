@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/Components/WeaponSlotComponent.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Items/WeaponItemData.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Weapons/FPSWeaponHolder.h"
@@ -51,11 +52,11 @@ void UWeaponSlotComponent::InitializeWeaponHolder()
 		if (Owner->Implements<UFPSWeaponHolder>())
 		{
 			WeaponHolder = Cast<IFPSWeaponHolder>(Owner);
-			UE_LOG(LogTemp, Log, TEXT("WeaponSlotComponent: WeaponHolder 인터페이스 초기화 완료"));
+			UE_LOG(LogFPSInventory, Log, TEXT("WeaponSlotComponent: WeaponHolder 인터페이스 초기화 완료"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("WeaponSlotComponent: 소유자가 IFPSWeaponHolder 인터페이스를 구현하지 않습니다!"));
+			UE_LOG(LogFPSInventory, Warning, TEXT("WeaponSlotComponent: 소유자가 IFPSWeaponHolder 인터페이스를 구현하지 않습니다!"));
 		}
 	}
 }
@@ -68,21 +69,21 @@ bool UWeaponSlotComponent::EquipWeaponToSlot(EWeaponSlot SlotType, UWeaponItemDa
 {
 	if (!WeaponItem)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: WeaponItem이 null입니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: WeaponItem이 null입니다"));
 		return false;
 	}
 
 	int32 SlotIndex = SlotTypeToIndex(SlotType);
 	if (!IsValidSlotIndex(SlotIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: 잘못된 슬롯 타입입니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: 잘못된 슬롯 타입입니다"));
 		return false;
 	}
 
 	// 슬롯이 이미 차있는지 확인
 	if (!IsSlotEmpty(SlotType))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: 슬롯이 이미 차있습니다. 먼저 비워주세요."));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: 슬롯이 이미 차있습니다. 먼저 비워주세요."));
 		return false;
 	}
 
@@ -90,7 +91,7 @@ bool UWeaponSlotComponent::EquipWeaponToSlot(EWeaponSlot SlotType, UWeaponItemDa
 	AFPSWeapon* NewWeapon = SpawnWeaponActor(WeaponItem);
 	if (!NewWeapon)
 	{
-		UE_LOG(LogTemp, Error, TEXT("EquipWeaponToSlot: 무기 스폰에 실패했습니다"));
+		UE_LOG(LogFPSInventory, Error, TEXT("EquipWeaponToSlot: 무기 스폰에 실패했습니다"));
 		return false;
 	}
 
@@ -102,7 +103,7 @@ bool UWeaponSlotComponent::EquipWeaponToSlot(EWeaponSlot SlotType, UWeaponItemDa
 	if (UPickupTriggerComponent* PickupTrigger = NewWeapon->FindComponentByClass<UPickupTriggerComponent>())
 	{
 		PickupTrigger->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		UE_LOG(LogTemp, Log, TEXT("무기 장착 - 픽업 트리거 비활성화: %s"), *NewWeapon->GetName());
+		UE_LOG(LogFPSInventory, Log, TEXT("무기 장착 - 픽업 트리거 비활성화: %s"), *NewWeapon->GetName());
 	}
 
 	// 활성 슬롯이 아니어도 무기 메시는 부착 (픽업한 무기와 동일하게 처리)
@@ -123,7 +124,7 @@ bool UWeaponSlotComponent::EquipWeaponToSlot(EWeaponSlot SlotType, UWeaponItemDa
 		NewWeapon->ActivateWeapon();
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("무기 장착 완료: %s를 %d번 슬롯에"),
+	UE_LOG(LogFPSInventory, Log, TEXT("무기 장착 완료: %s를 %d번 슬롯에"),
 		*WeaponItem->GetItemName(), SlotIndex);
 
 	// 델리게이트 호출
@@ -139,7 +140,7 @@ bool UWeaponSlotComponent::EquipExistingWeaponToSlot(EWeaponSlot SlotType, AFPSW
 {
 	if (!ExistingWeapon)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: ExistingWeapon이 null입니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: ExistingWeapon이 null입니다"));
 		return false;
 	}
 
@@ -147,21 +148,21 @@ bool UWeaponSlotComponent::EquipExistingWeaponToSlot(EWeaponSlot SlotType, AFPSW
 	UWeaponItemData* WeaponItemData = ExistingWeapon->GetWeaponItemData();
 	if (!WeaponItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: 무기에 WeaponItemData가 없습니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: 무기에 WeaponItemData가 없습니다"));
 		return false;
 	}
 
 	int32 SlotIndex = SlotTypeToIndex(SlotType);
 	if (!IsValidSlotIndex(SlotIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: 잘못된 슬롯 타입입니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: 잘못된 슬롯 타입입니다"));
 		return false;
 	}
 
 	// 슬롯이 이미 차있는지 확인
 	if (!IsSlotEmpty(SlotType))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EquipWeaponToSlot: 슬롯이 이미 차있습니다. 먼저 비워주세요."));
+		UE_LOG(LogFPSInventory, Warning, TEXT("EquipWeaponToSlot: 슬롯이 이미 차있습니다. 먼저 비워주세요."));
 		return false;
 	}
 
@@ -192,7 +193,7 @@ bool UWeaponSlotComponent::EquipExistingWeaponToSlot(EWeaponSlot SlotType, AFPSW
 		ExistingWeapon->ActivateWeapon();
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("기존 무기 장착 완료: %s를 %d번 슬롯에"),
+	UE_LOG(LogFPSInventory, Log, TEXT("기존 무기 장착 완료: %s를 %d번 슬롯에"),
 		*WeaponItemData->GetItemName(), SlotIndex);
 
 	// 델리게이트 호출
@@ -209,13 +210,13 @@ UWeaponItemData* UWeaponSlotComponent::UnequipWeaponFromSlot(EWeaponSlot SlotTyp
 	int32 SlotIndex = SlotTypeToIndex(SlotType);
 	if (!IsValidSlotIndex(SlotIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UnequipWeaponFromSlot: 잘못된 슬롯 타입입니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("UnequipWeaponFromSlot: 잘못된 슬롯 타입입니다"));
 		return nullptr;
 	}
 
 	if (IsSlotEmpty(SlotType))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UnequipWeaponFromSlot: 슬롯이 이미 비어있습니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("UnequipWeaponFromSlot: 슬롯이 이미 비어있습니다"));
 		return nullptr;
 	}
 
@@ -234,10 +235,10 @@ UWeaponItemData* UWeaponSlotComponent::UnequipWeaponFromSlot(EWeaponSlot SlotTyp
 	// 활성 슬롯이 비워진 경우 빈 손 상태 유지 (자동 전환하지 않음)
 	if (SlotIndex == ActiveSlotIndex)
 	{
-		UE_LOG(LogTemp, Log, TEXT("활성 슬롯이 비워짐 - 빈 손 상태 유지"));
+		UE_LOG(LogFPSInventory, Log, TEXT("활성 슬롯이 비워짐 - 빈 손 상태 유지"));
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("무기 해제 완료: %s"), *WeaponItem->GetItemName());
+	UE_LOG(LogFPSInventory, Log, TEXT("무기 해제 완료: %s"), *WeaponItem->GetItemName());
 
 	// 델리게이트 호출
 	OnWeaponUnequipped.Broadcast(SlotType, WeaponItem);
@@ -286,10 +287,10 @@ void UWeaponSlotComponent::DropWeaponFromSlot(EWeaponSlot SlotType)
 	// 활성 슬롯이 비워진 경우 빈 손 상태 유지
 	if (SlotIndex == ActiveSlotIndex)
 	{
-		UE_LOG(LogTemp, Log, TEXT("활성 슬롯 드롭 - 빈 손 상태 유지"));
+		UE_LOG(LogFPSInventory, Log, TEXT("활성 슬롯 드롭 - 빈 손 상태 유지"));
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("무기 드롭: %s"), *WeaponItem->GetItemName());
+	UE_LOG(LogFPSInventory, Log, TEXT("무기 드롭: %s"), *WeaponItem->GetItemName());
 
 	// 델리게이트 호출
 	OnWeaponDropped.Broadcast(SlotType, WeaponItem, DropLocation);
@@ -349,12 +350,12 @@ bool UWeaponSlotComponent::SwitchToSlot(EWeaponSlot SlotType)
 			WeaponHolder->OnWeaponActivated(SpawnedWeapons[ActiveSlotIndex]);
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("슬롯 전환: %s"),
+		UE_LOG(LogFPSInventory, Log, TEXT("슬롯 전환: %s"),
 			*WeaponSlots[ActiveSlotIndex]->GetItemName());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("빈 슬롯으로 전환"));
+		UE_LOG(LogFPSInventory, Log, TEXT("빈 슬롯으로 전환"));
 	}
 
 	// 델리게이트 호출
@@ -446,7 +447,7 @@ void UWeaponSlotComponent::ShowCurrentWeapon(bool bMakeVisible)
 	AFPSWeapon* CurrentWeapon = GetCurrentWeaponActor();
 	if (!CurrentWeapon)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("무기를 가지고 있지 않음!"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("무기를 가지고 있지 않음!"));
 		return;
 	}
 
@@ -478,14 +479,14 @@ AFPSWeapon* UWeaponSlotComponent::SpawnWeaponActor(UWeaponItemData* WeaponItem)
 {
 	if (!WeaponItem || !WeaponItem->IsValidWeapon())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SpawnWeaponActor: 잘못된 WeaponItem입니다"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("SpawnWeaponActor: 잘못된 WeaponItem입니다"));
 		return nullptr;
 	}
 
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		UE_LOG(LogTemp, Error, TEXT("SpawnWeaponActor: World가 null입니다"));
+		UE_LOG(LogFPSInventory, Error, TEXT("SpawnWeaponActor: World가 null입니다"));
 		return nullptr;
 	}
 
@@ -513,11 +514,11 @@ AFPSWeapon* UWeaponSlotComponent::SpawnWeaponActor(UWeaponItemData* WeaponItem)
 			WeaponHolder->AttachWeaponMeshes(NewWeapon);
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("무기 스폰 완료: %s"), *WeaponItem->GetItemName());
+		UE_LOG(LogFPSInventory, Log, TEXT("무기 스폰 완료: %s"), *WeaponItem->GetItemName());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("무기 스폰 실패: %s"), *WeaponItem->GetItemName());
+		UE_LOG(LogFPSInventory, Error, TEXT("무기 스폰 실패: %s"), *WeaponItem->GetItemName());
 	}
 
 	return NewWeapon;
@@ -554,7 +555,7 @@ void UWeaponSlotComponent::DetachWeaponFromSlot(int32 SlotIndex, bool bMakeVisib
 		if (UPickupTriggerComponent* PickupTrigger = Weapon->FindComponentByClass<UPickupTriggerComponent>())
 		{
 			PickupTrigger->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-			UE_LOG(LogTemp, Log, TEXT("무기 드롭 - 픽업 트리거 활성화: %s"), *Weapon->GetName());
+			UE_LOG(LogFPSInventory, Log, TEXT("무기 드롭 - 픽업 트리거 활성화: %s"), *Weapon->GetName());
 		}
 	}
 }
@@ -598,7 +599,7 @@ void UWeaponSlotComponent::ClearAllWeapons()
 		ClearWeaponInSlot(i);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("모든 무기 정리 완료"));
+	UE_LOG(LogFPSInventory, Log, TEXT("모든 무기 정리 완료"));
 }
 
 void UWeaponSlotComponent::DropWeaponToWorld(UWeaponItemData* WeaponItem, const FVector& DropLocation)
@@ -616,7 +617,7 @@ void UWeaponSlotComponent::DropWeaponToWorld(UWeaponItemData* WeaponItem, const
 
 	// TODO: 나중에 PickupActor 시스템 구현 시 여기서 드롭 처리
 	// 지금은 로그만 출력
-	UE_LOG(LogTemp, Log, TEXT("무기를 월드에 드롭: %s at %s"),
+	UE_LOG(LogFPSInventory, Log, TEXT("무기를 월드에 드롭: %s at %s"),
 		*WeaponItem->GetItemName(), *DropLocation.ToString());
 
 	// 임시: 간단한 StaticMesh로 드롭 표시 (나중에 PickupActor로 대체)
@@ -640,7 +641,7 @@ bool UWeaponSlotComponent::SwapWeaponSlots(EWeaponSlot SlotA, EWeaponSlot SlotB)
 	// 유효성 체크
 	if (SlotA == SlotB || SlotA == EWeaponSlot::None || SlotB == EWeaponSlot::None)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SwapWeaponSlots: 잘못된 슬롯 타입"));
+		UE_LOG(LogFPSInventory, Warning, TEXT("SwapWeaponSlots: 잘못된 슬롯 타입"));
 		return false;
 	}
 
@@ -695,7 +696,7 @@ bool UWeaponSlotComponent::SwapWeaponSlots(EWeaponSlot SlotA, EWeaponSlot SlotB)
 		UpdateWeaponHUD();
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("SwapWeaponSlots: %s <-> %s 교환 완료 (활성 슬롯: %s 유지)"),
+	UE_LOG(LogFPSInventory, Log, TEXT("SwapWeaponSlots: %s <-> %s 교환 완료 (활성 슬롯: %s 유지)"),
 		SlotA == EWeaponSlot::Primary ? TEXT("Primary") : TEXT("Secondary"),
 		SlotB == EWeaponSlot::Primary ? TEXT("Primary") : TEXT("Secondary"),
 		GetActiveSlot() == EWeaponSlot::Primary ? TEXT("Primary") : TEXT("Secondary"));
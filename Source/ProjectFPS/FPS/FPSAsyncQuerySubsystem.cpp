@@ -0,0 +1,184 @@
+// FPSAsyncQuerySubsystem.cpp
+
+#include "FPSAsyncQuerySubsystem.h"
+#include "Engine/World.h"
+
+void UFPSAsyncQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &UFPSAsyncQuerySubsystem::OnTraceCompleted);
+}
+
+void UFPSAsyncQuerySubsystem::Deinitialize()
+{
+	TraceDelegate.Unbind();
+	Queries.Empty();
+	QueuedIds.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSAsyncQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSAsyncQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSAsyncQuerySubsystem, STATGROUP_Tickables);
+}
+
+void UFPSAsyncQuerySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 프레임 경계: 예산 초기화 후 대기열부터 처리
+	DispatchedThisFrame = 0;
+
+	int32 NumDispatched = 0;
+	while (NumDispatched < QueuedIds.Num() && DispatchedThisFrame < MaxQueriesPerFrame)
+	{
+		const uint32 QueryId = QueuedIds[NumDispatched++];
+		if (FQueryEntry* Entry = Queries.Find(QueryId))
+		{
+			DispatchQuery(QueryId, *Entry);
+		}
+	}
+
+	if (NumDispatched > 0)
+	{
+		QueuedIds.RemoveAt(0, NumDispatched, EAllowShrinking::No);
+	}
+
+	// 요청자가 사라진 쿼리 폐기 (결과는 요청자가 ReleaseQuery할 때까지 유지, 조회 간격과 무관)
+	for (auto It = Queries.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Owner.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+FFPSAsyncQueryHandle UFPSAsyncQuerySubsystem::SubmitLineTrace(const UObject* Owner, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel,
+	const FCollisionQueryParams& Params)
+{
+	FQueryEntry Entry;
+	Entry.Type = EQueryType::LineTraceByChannel;
+	Entry.Start = Start;
+	Entry.End = End;
+	Entry.TraceChannel = TraceChannel;
+	Entry.Params = Params;
+	Entry.Owner = Owner;
+
+	return AddQuery(MoveTemp(Entry));
+}
+
+FFPSAsyncQueryHandle UFPSAsyncQuerySubsystem::SubmitSweepByObjectType(const UObject* Owner, const FVector& Start, const FVector& End, const FCollisionShape& Shape,
+	const FCollisionObjectQueryParams& ObjectParams, const FCollisionQueryParams& Params)
+{
+	FQueryEntry Entry;
+	Entry.Type = EQueryType::SweepByObjectType;
+	Entry.Start = Start;
+	Entry.End = End;
+	Entry.Shape = Shape;
+	Entry.ObjectParams = ObjectParams;
+	Entry.Params = Params;
+	Entry.Owner = Owner;
+
+	return AddQuery(MoveTemp(Entry));
+}
+
+EFPSAsyncQueryStatus UFPSAsyncQuerySubsystem::GetStatus(const FFPSAsyncQueryHandle& Handle) const
+{
+	const FQueryEntry* Entry = Queries.Find(Handle.Id);
+	return Entry ? Entry->Status : EFPSAsyncQueryStatus::Invalid;
+}
+
+const FFPSAsyncQueryResult* UFPSAsyncQuerySubsystem::GetResult(const FFPSAsyncQueryHandle& Handle) const
+{
+	const FQueryEntry* Entry = Queries.Find(Handle.Id);
+	if (!Entry || Entry->Status != EFPSAsyncQueryStatus::Ready)
+	{
+		return nullptr;
+	}
+
+	return &Entry->Result;
+}
+
+int32 UFPSAsyncQuerySubsystem::GetResultAgeFrames(const FFPSAsyncQueryHandle& Handle) const
+{
+	const FFPSAsyncQueryResult* Result = GetResult(Handle);
+	return Result ? (int32)(GFrameCounter - Result->CompletedFrame) : INDEX_NONE;
+}
+
+void UFPSAsyncQuerySubsystem::ReleaseQuery(FFPSAsyncQueryHandle& Handle)
+{
+	// 대기열의 ID는 Tick에서 항목이 없으면 건너뜀
+	Queries.Remove(Handle.Id);
+	Handle.Reset();
+}
+
+FFPSAsyncQueryHandle UFPSAsyncQuerySubsystem::AddQuery(FQueryEntry&& Entry)
+{
+	FFPSAsyncQueryHandle Handle;
+	Handle.Id = NextQueryId++;
+
+	// 0은 무효 핸들이므로 wrap-around 시 건너뜀
+	if (NextQueryId == 0)
+	{
+		NextQueryId = 1;
+	}
+
+	Entry.Result.SubmitFrame = GFrameCounter;
+	FQueryEntry& NewEntry = Queries.Add(Handle.Id, MoveTemp(Entry));
+
+	if (DispatchedThisFrame < MaxQueriesPerFrame)
+	{
+		DispatchQuery(Handle.Id, NewEntry);
+	}
+	else
+	{
+		NewEntry.Status = EFPSAsyncQueryStatus::Queued;
+		QueuedIds.Add(Handle.Id);
+	}
+
+	return Handle;
+}
+
+void UFPSAsyncQuerySubsystem::DispatchQuery(uint32 QueryId, FQueryEntry& Entry)
+{
+	UWorld* World = GetWorld();
+
+	switch (Entry.Type)
+	{
+	case EQueryType::LineTraceByChannel:
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Entry.Start, Entry.End, Entry.TraceChannel,
+			Entry.Params, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, QueryId);
+		break;
+
+	case EQueryType::SweepByObjectType:
+		World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Entry.Start, Entry.End, FQuat::Identity, Entry.ObjectParams,
+			Entry.Shape, Entry.Params, &TraceDelegate, QueryId);
+		break;
+	}
+
+	Entry.Status = EFPSAsyncQueryStatus::InFlight;
+	DispatchedThisFrame++;
+}
+
+void UFPSAsyncQuerySubsystem::OnTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	// 해제된 쿼리의 결과는 버림
+	FQueryEntry* Entry = Queries.Find(TraceDatum.UserData);
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->Result.Hits = MoveTemp(TraceDatum.OutHits);
+	Entry->Result.CompletedFrame = GFrameCounter;
+	Entry->Result.CompletedTime = GetWorld()->GetTimeSeconds();
+	Entry->Status = EFPSAsyncQueryStatus::Ready;
+}
@@ -0,0 +1,171 @@
+// FPSAsyncQuerySubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "FPSAsyncQuerySubsystem.generated.h"
+
+/**
+ * 비동기 충돌 쿼리 핸들
+ * - Submit 시 발급, 결과 조회/해제에 사용
+ */
+struct FFPSAsyncQueryHandle
+{
+	uint32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+	void Reset() { Id = 0; }
+
+	bool operator==(const FFPSAsyncQueryHandle& Other) const { return Id == Other.Id; }
+};
+
+/**
+ * 비동기 쿼리 상태
+ */
+enum class EFPSAsyncQueryStatus : uint8
+{
+	Invalid,   // 없는 핸들 (해제됨/만료됨)
+	Queued,    // 예산 초과로 대기 중 (아직 물리 쿼리 요청 전)
+	InFlight,  // 물리 쿼리 요청됨 (다음 프레임에 결과)
+	Ready      // 결과 도착
+};
+
+/**
+ * 비동기 쿼리 결과
+ */
+struct FFPSAsyncQueryResult
+{
+	/** 충돌 결과 (Single 쿼리는 최대 1개, Multi 쿼리는 거리순 전체) */
+	TArray<FHitResult> Hits;
+
+	/** 요청 프레임 */
+	uint64 SubmitFrame = 0;
+
+	/** 결과 도착 프레임 */
+	uint64 CompletedFrame = 0;
+
+	/** 결과 도착 시간 (월드 시간) */
+	double CompletedTime = 0.0;
+
+	/** 블로킹 충돌이 있는지 */
+	bool HasBlockingHit() const { return Hits.Num() > 0 && Hits[0].bBlockingHit; }
+
+	/** 요청 -> 결과까지 걸린 프레임 수 */
+	uint64 GetLatencyFrames() const { return CompletedFrame - SubmitFrame; }
+};
+
+/**
+ * 비동기 충돌 쿼리 서비스 (월드 단위)
+ * - 엔진의 AsyncLineTrace / AsyncSweep API 위에서 동작
+ * - 요청은 핸들로 반환되고, 결과는 다음 프레임에 핸들로 조회
+ * - 프레임당 쿼리 예산 초과분은 대기열에 남아 다음 프레임으로 이월
+ * - 결과 나이(요청/도착 프레임) 추적, 결과는 요청자가 ReleaseQuery할 때까지 유지
+ *   (AI처럼 시간 간격으로 조회하는 요청자도 결과를 놓치지 않음, 요청자가 사라진 쿼리만 자동 폐기)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSAsyncQuerySubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSAsyncQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// Query API
+	// ========================================
+
+	/** 채널 기준 라인 트레이스 요청 (Single, Owner가 사라지면 결과 자동 폐기) */
+	FFPSAsyncQueryHandle SubmitLineTrace(const UObject* Owner, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel,
+		const FCollisionQueryParams& Params);
+
+	/** 오브젝트 타입 기준 스윕 요청 (Multi: 경로상의 모든 충돌을 거리순으로, Owner가 사라지면 결과 자동 폐기) */
+	FFPSAsyncQueryHandle SubmitSweepByObjectType(const UObject* Owner, const FVector& Start, const FVector& End, const FCollisionShape& Shape,
+		const FCollisionObjectQueryParams& ObjectParams, const FCollisionQueryParams& Params);
+
+	/** 쿼리 상태 조회 */
+	EFPSAsyncQueryStatus GetStatus(const FFPSAsyncQueryHandle& Handle) const;
+
+	/** 결과 조회 (Ready일 때만 true, 결과는 ReleaseQuery 전까지 유지) */
+	const FFPSAsyncQueryResult* GetResult(const FFPSAsyncQueryHandle& Handle) const;
+
+	/** 결과 나이 (도착 후 지난 프레임 수, 결과가 없으면 INDEX_NONE) */
+	int32 GetResultAgeFrames(const FFPSAsyncQueryHandle& Handle) const;
+
+	/** 쿼리 해제 (대기/진행 중이면 결과를 버림) */
+	void ReleaseQuery(FFPSAsyncQueryHandle& Handle);
+
+	/** 대기열에 남은 쿼리 수 */
+	int32 GetQueuedCount() const { return QueuedIds.Num(); }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 프레임당 물리 쿼리 요청 예산 */
+	UPROPERTY(Config, EditAnywhere, Category = "Async Query", meta = (ClampMin = 1))
+	int32 MaxQueriesPerFrame = 256;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 쿼리 종류 */
+	enum class EQueryType : uint8
+	{
+		LineTraceByChannel,
+		SweepByObjectType
+	};
+
+	/** 쿼리 항목 (요청 + 결과) */
+	struct FQueryEntry
+	{
+		EQueryType Type = EQueryType::LineTraceByChannel;
+		EFPSAsyncQueryStatus Status = EFPSAsyncQueryStatus::Queued;
+
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		ECollisionChannel TraceChannel = ECC_Visibility;
+		FCollisionShape Shape;
+		FCollisionObjectQueryParams ObjectParams;
+		FCollisionQueryParams Params;
+
+		FFPSAsyncQueryResult Result;
+
+		/** 요청자 (사라지면 ReleaseQuery 없이도 폐기) */
+		TWeakObjectPtr<const UObject> Owner;
+	};
+
+	/** 새 쿼리 등록 (예산이 남아 있으면 즉시 요청, 아니면 대기열) */
+	FFPSAsyncQueryHandle AddQuery(FQueryEntry&& Entry);
+
+	/** 물리 쿼리 요청 */
+	void DispatchQuery(uint32 QueryId, FQueryEntry& Entry);
+
+	/** 엔진 비동기 트레이스 완료 콜백 (다음 프레임 시작 시 호출) */
+	void OnTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	/** 쿼리 항목 */
+	TMap<uint32, FQueryEntry> Queries;
+
+	/** 예산 초과로 대기 중인 쿼리 (요청 순서) */
+	TArray<uint32> QueuedIds;
+
+	/** 이번 프레임에 요청한 쿼리 수 */
+	int32 DispatchedThisFrame = 0;
+
+	/** 다음 발급 ID */
+	uint32 NextQueryId = 1;
+
+	/** 엔진 콜백 델리게이트 (한 번만 바인딩) */
+	FTraceDelegate TraceDelegate;
+};
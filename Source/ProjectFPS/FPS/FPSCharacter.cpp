@@ -1,10 +1,12 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/FPSCharacter.h"
+#include "FPS/FPSLog.h"
 #include "FPS/CharacterAttributeSet.h"
 #include "FPS/GameplayEffect_Heal.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Components/WeaponSlotComponent.h"
+#include "FPS/FPSSpatialHashSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
 #include "EnhancedInputComponent.h"
@@ -124,11 +126,27 @@ void AFPSCharacter::BeginPlay()
 				{
 					FGameplayAbilitySpec AbilitySpec(AbilityClass, 1, INDEX_NONE, this);
 					AbilitySystemComponent->GiveAbility(AbilitySpec);
-					UE_LOG(LogTemp, Log, TEXT("어빌리티 부여: %s"), *AbilityClass->GetName());
+					UE_LOG(LogFPS, Log, TEXT("어빌리티 부여: %s"), *AbilityClass->GetName());
 				}
 			}
 		}
 	}
+
+	// 근접 쿼리용 공간 해시 등록 (AI 타겟 선택 등)
+	if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->Register(this, EFPSSpatialCategory::Pawn);
+	}
+}
+
+void AFPSCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->Unregister(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // 매 프레임 호출
@@ -172,7 +190,7 @@ void AFPSCharacter::ServerNotifyPlayerDeath_Implementation()
 
 void AFPSCharacter::OnPlayerDeath()
 {
-	UE_LOG(LogTemp, Warning, TEXT("캐릭터 사망!"));
+	UE_LOG(LogFPS, Warning, TEXT("캐릭터 사망!"));
 
 	// 사망 상태 설정 (발사체 Blueprint에서 체크 가능)
 	bIsAlive = false;
@@ -209,7 +227,7 @@ void AFPSCharacter::OnPlayerDeath()
 
 void AFPSCharacter::OnPlayerRespawn()
 {
-	UE_LOG(LogTemp, Warning, TEXT("플레이어 리스폰 상태 복구 시작"));
+	UE_LOG(LogFPS, Warning, TEXT("플레이어 리스폰 상태 복구 시작"));
 
 	// 먼저 체력부터 회복 (bIsAlive가 false인 상태에서)
 	if (AbilitySystemComponent && AttributeSet)
@@ -217,7 +235,7 @@ void AFPSCharacter::OnPlayerRespawn()
 		// 체력 회복 전 상태 로깅
 		float CurrentHealth = AttributeSet->GetHealth();
 		float MaxHealthValue = AttributeSet->GetMaxHealth();
-		UE_LOG(LogTemp, Warning, TEXT("체력 회복 시작: 현재=%f, 최대=%f, bIsAlive=%s"),
+		UE_LOG(LogFPS, Warning, TEXT("체력 회복 시작: 현재=%f, 최대=%f, bIsAlive=%s"),
 			CurrentHealth, MaxHealthValue, bIsAlive ? TEXT("true") : TEXT("false"));
 
 		// GameplayEffect_Heal을 사용하여 체력 회복
@@ -231,30 +249,30 @@ void AFPSCharacter::OnPlayerRespawn()
 			{
 				// GameplayEffect를 적용하여 Health를 MaxHealth로 설정
 				AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-				UE_LOG(LogTemp, Warning, TEXT("GameplayEffect_Heal 적용: %f -> MaxHealth"), CurrentHealth);
+				UE_LOG(LogFPS, Warning, TEXT("GameplayEffect_Heal 적용: %f -> MaxHealth"), CurrentHealth);
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("HealEffect가 없거나 MaxHealth가 0 이하입니다. HealEffect=%s, MaxHealth=%f"),
+			UE_LOG(LogFPS, Error, TEXT("HealEffect가 없거나 MaxHealth가 0 이하입니다. HealEffect=%s, MaxHealth=%f"),
 				HealEffect ? TEXT("유효함") : TEXT("없음"), MaxHealthValue);
 		}
 	}
 
 	// 체력 회복 후에 생존 상태 복구 (이제 안전함)
 	bIsAlive = true;
-	UE_LOG(LogTemp, Warning, TEXT("bIsAlive = true로 설정"));
+	UE_LOG(LogFPS, Warning, TEXT("bIsAlive = true로 설정"));
 
 	// 입력 재활성화
 	if (APlayerController* PC = Cast<APlayerController>(GetController()))
 	{
 		EnableInput(PC);
-		UE_LOG(LogTemp, Warning, TEXT("입력 재활성화 완료"));
+		UE_LOG(LogFPS, Warning, TEXT("입력 재활성화 완료"));
 	}
 
 	// 움직임 재활성화
 	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-	UE_LOG(LogTemp, Warning, TEXT("움직임 재활성화 완료"));
+	UE_LOG(LogFPS, Warning, TEXT("움직임 재활성화 완료"));
 
 	// 메시 다시 표시
 	GetMesh()->SetVisibility(true);
@@ -262,9 +280,9 @@ void AFPSCharacter::OnPlayerRespawn()
 	{
 		FirstPersonMesh->SetVisibility(true);
 	}
-	UE_LOG(LogTemp, Warning, TEXT("메시 표시 완료"));
+	UE_LOG(LogFPS, Warning, TEXT("메시 표시 완료"));
 
-	UE_LOG(LogTemp, Warning, TEXT("플레이어 리스폰 상태 복구 완료"));
+	UE_LOG(LogFPS, Warning, TEXT("플레이어 리스폰 상태 복구 완료"));
 }
 
 // ========================================
@@ -323,32 +341,32 @@ void AFPSCharacter::PlayReloadMontage(UAnimMontage* Montage)
 {
 	if (!Montage)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AFPSCharacter::PlayReloadMontage: 몽타주가 null입니다"));
+		UE_LOG(LogFPS, Warning, TEXT("AFPSCharacter::PlayReloadMontage: 몽타주가 null입니다"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("AFPSCharacter::PlayReloadMontage: 리로드 몽타주 재생 시작 - %s"), *Montage->GetName());
+	UE_LOG(LogFPS, Warning, TEXT("AFPSCharacter::PlayReloadMontage: 리로드 몽타주 재생 시작 - %s"), *Montage->GetName());
 
 	// 1인칭 메시에서 몽타주 재생
 	if (FirstPersonMesh && FirstPersonMesh->GetAnimInstance())
 	{
 		FirstPersonMesh->GetAnimInstance()->Montage_Play(Montage);
-		UE_LOG(LogTemp, Warning, TEXT("AFPSCharacter::PlayReloadMontage: FirstPersonMesh에서 재생"));
+		UE_LOG(LogFPS, Warning, TEXT("AFPSCharacter::PlayReloadMontage: FirstPersonMesh에서 재생"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("AFPSCharacter::PlayReloadMontage: FirstPersonMesh 또는 AnimInstance가 null"));
+		UE_LOG(LogFPS, Error, TEXT("AFPSCharacter::PlayReloadMontage: FirstPersonMesh 또는 AnimInstance가 null"));
 	}
 
 	// 3인칭 메시에서 몽타주 재생 (멀티플레이어용)
 	if (GetMesh() && GetMesh()->GetAnimInstance())
 	{
 		GetMesh()->GetAnimInstance()->Montage_Play(Montage);
-		UE_LOG(LogTemp, Warning, TEXT("AFPSCharacter::PlayReloadMontage: ThirdPersonMesh에서 재생"));
+		UE_LOG(LogFPS, Warning, TEXT("AFPSCharacter::PlayReloadMontage: ThirdPersonMesh에서 재생"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("AFPSCharacter::PlayReloadMontage: ThirdPersonMesh 또는 AnimInstance가 null"));
+		UE_LOG(LogFPS, Error, TEXT("AFPSCharacter::PlayReloadMontage: ThirdPersonMesh 또는 AnimInstance가 null"));
 	}
 }
 
@@ -410,5 +428,5 @@ void AFPSCharacter::AddWeaponClass(const TSubclassOf<AFPSWeapon>& WeaponClass)
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("AddWeaponClass: WeaponSlotComponent 시스템으로 교체 필요"));
+	UE_LOG(LogFPS, Warning, TEXT("AddWeaponClass: WeaponSlotComponent 시스템으로 교체 필요"));
 }
\ No newline at end of file
@@ -39,6 +39,9 @@ protected:
 	// 게임 시작 시 또는 스폰될 때 호출
 	virtual void BeginPlay() override;
 
+	// 제거될 때 호출 (공간 해시 해제)
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Health 속성 변경 시 호출 (자식 클래스에서 override)
 	virtual void OnHealthChanged(const FOnAttributeChangeData& Data) {}
 
@@ -0,0 +1,204 @@
+// FPSCosmeticLODSubsystem.cpp
+
+#include "FPSCosmeticLODSubsystem.h"
+#include "FPS/Weapons/FPSProjectile.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+bool UFPSCosmeticLODSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// 데디케이티드 서버는 연출이 없으므로 서브시스템 자체를 만들지 않음
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UFPSCosmeticLODSubsystem::Deinitialize()
+{
+	Projectiles.Empty();
+	Viewers.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSCosmeticLODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSCosmeticLODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSCosmeticLODSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSCosmeticLODSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 프레임 경계: 명중 연출 상한 초기화
+	ImpactEffectsThisFrame = 0;
+	ViewConeCos = FMath::Cos(FMath::DegreesToRadians(ViewConeHalfAngle));
+
+	GatherViewers();
+	UpdateProjectileMeshes();
+}
+
+void UFPSCosmeticLODSubsystem::GatherViewers()
+{
+	Viewers.Reset();
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		FViewer& Viewer = Viewers.AddDefaulted_GetRef();
+		Viewer.Location = ViewLocation;
+		Viewer.Direction = ViewRotation.Vector();
+	}
+}
+
+EFPSCosmeticLOD UFPSCosmeticLODSubsystem::GetLODForLocation(const FVector& Location) const
+{
+	// 로컬 시점이 없으면 볼 사람이 없음
+	int32 BestTier = static_cast<int32>(EFPSCosmeticLOD::Culled);
+
+	for (const FViewer& Viewer : Viewers)
+	{
+		const FVector ToLocation = Location - Viewer.Location;
+		const float DistanceSq = ToLocation.SizeSquared();
+
+		int32 Tier;
+		if (DistanceSq <= FMath::Square(FullDistance))
+		{
+			Tier = static_cast<int32>(EFPSCosmeticLOD::Full);
+		}
+		else if (DistanceSq <= FMath::Square(ReducedDistance))
+		{
+			Tier = static_cast<int32>(EFPSCosmeticLOD::Reduced);
+		}
+		else if (DistanceSq <= FMath::Square(MinimalDistance))
+		{
+			Tier = static_cast<int32>(EFPSCosmeticLOD::Minimal);
+		}
+		else
+		{
+			Tier = static_cast<int32>(EFPSCosmeticLOD::Culled);
+		}
+
+		// 시야 원뿔 밖: 단계 낮춤
+		const float Distance = FMath::Sqrt(DistanceSq);
+		const bool bInViewCone = Distance <= KINDA_SMALL_NUMBER
+			|| FVector::DotProduct(ToLocation, Viewer.Direction) >= ViewConeCos * Distance;
+
+		if (!bInViewCone)
+		{
+			Tier += OffscreenTierPenalty;
+		}
+
+		BestTier = FMath::Min(BestTier, Tier);
+	}
+
+	return static_cast<EFPSCosmeticLOD>(FMath::Min(BestTier, static_cast<int32>(EFPSCosmeticLOD::Culled)));
+}
+
+FFPSImpactCosmetics UFPSCosmeticLODSubsystem::RequestImpactCosmetics(const FVector& Location)
+{
+	FFPSImpactCosmetics Result;
+
+	// 프레임 상한 초과
+	if (ImpactEffectsThisFrame >= MaxImpactEffectsPerFrame)
+	{
+		return Result;
+	}
+
+	switch (GetLODForLocation(Location))
+	{
+	case EFPSCosmeticLOD::Full:
+		Result.bSpawnParticle = true;
+		Result.bPlaySound = true;
+		break;
+
+	case EFPSCosmeticLOD::Reduced:
+		Result.bSpawnParticle = (ReducedEmitterCounter++ % ReducedEmitterInterval) == 0;
+		Result.bPlaySound = true;
+		break;
+
+	case EFPSCosmeticLOD::Minimal:
+		Result.bPlaySound = true;
+		break;
+
+	case EFPSCosmeticLOD::Culled:
+		break;
+	}
+
+	if (Result.bSpawnParticle || Result.bPlaySound)
+	{
+		ImpactEffectsThisFrame++;
+	}
+
+	return Result;
+}
+
+void UFPSCosmeticLODSubsystem::RegisterProjectile(AFPSProjectile* Projectile)
+{
+	if (Projectile && Projectile->ProjectileMesh)
+	{
+		Projectiles.AddUnique(Projectile);
+		UpdateProjectileMesh(Projectile);
+	}
+}
+
+void UFPSCosmeticLODSubsystem::UnregisterProjectile(AFPSProjectile* Projectile)
+{
+	const int32 Index = Projectiles.IndexOfByKey(Projectile);
+	if (Index != INDEX_NONE)
+	{
+		Projectiles.RemoveAtSwap(Index, EAllowShrinking::No);
+	}
+}
+
+void UFPSCosmeticLODSubsystem::UpdateProjectileMeshes()
+{
+	const int32 NumToUpdate = FMath::Min(MeshUpdatesPerFrame, Projectiles.Num());
+
+	for (int32 Step = 0; Step < NumToUpdate && Projectiles.Num() > 0; ++Step)
+	{
+		if (MeshUpdateCursor >= Projectiles.Num())
+		{
+			MeshUpdateCursor = 0;
+		}
+
+		AFPSProjectile* Projectile = Projectiles[MeshUpdateCursor].Get();
+		if (!Projectile)
+		{
+			Projectiles.RemoveAtSwap(MeshUpdateCursor, EAllowShrinking::No);
+			continue;
+		}
+
+		MeshUpdateCursor++;
+
+		UpdateProjectileMesh(Projectile);
+	}
+}
+
+void UFPSCosmeticLODSubsystem::UpdateProjectileMesh(AFPSProjectile* Projectile) const
+{
+	// 풀 대기 중인 발사체는 건너뜀
+	if (!Projectile || !Projectile->ProjectileMesh || Projectile->IsHidden())
+	{
+		return;
+	}
+
+	const bool bShowMesh = GetLODForLocation(Projectile->GetActorLocation()) <= EFPSCosmeticLOD::Reduced;
+	if (Projectile->ProjectileMesh->IsVisible() != bShowMesh)
+	{
+		Projectile->ProjectileMesh->SetVisibility(bShowMesh);
+	}
+}
@@ -0,0 +1,143 @@
+// FPSCosmeticLODSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSCosmeticLODSubsystem.generated.h"
+
+class AFPSProjectile;
+
+/**
+ * 연출 LOD 단계 (가까운/보이는 것부터)
+ */
+UENUM(BlueprintType)
+enum class EFPSCosmeticLOD : uint8
+{
+	Full,     // 발사체 메시 + 명중 파티클 + 사운드
+	Reduced,  // 발사체 메시 + 명중 파티클 일부(ReducedEmitterInterval마다) + 사운드
+	Minimal,  // 메시 숨김, 명중 사운드만
+	Culled    // 연출 없음
+};
+
+/**
+ * 명중 연출 판정 결과
+ */
+struct FFPSImpactCosmetics
+{
+	/** 명중 파티클 스폰 여부 */
+	bool bSpawnParticle = false;
+
+	/** 명중 사운드 재생 여부 */
+	bool bPlaySound = false;
+};
+
+/**
+ * 연출 LOD 서브시스템 (월드 단위, 데디케이티드 서버에서는 생성하지 않음)
+ * - 로컬 플레이어 시점 기준 거리 + 시야 원뿔로 연출 단계 결정 (시야 밖이면 OffscreenTierPenalty만큼 낮춤)
+ * - 명중 연출: 단계별로 파티클/사운드를 줄이고, 프레임당 MaxImpactEffectsPerFrame개로 제한
+ * - 발사체 메시: 등록된 발사체를 프레임당 MeshUpdatesPerFrame개씩 돌아가며 갱신 (Minimal 이하면 숨김)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSCosmeticLODSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSCosmeticLODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 위치의 연출 단계 (이번 프레임 시점 기준) */
+	EFPSCosmeticLOD GetLODForLocation(const FVector& Location) const;
+
+	/** 명중 연출 요청 (단계/솎아내기/프레임 상한 반영, 스폰할 항목만 true) */
+	FFPSImpactCosmetics RequestImpactCosmetics(const FVector& Location);
+
+	/** 발사체 메시 LOD 대상 등록/해제 (발사체 BeginPlay/EndPlay) */
+	void RegisterProjectile(AFPSProjectile* Projectile);
+	void UnregisterProjectile(AFPSProjectile* Projectile);
+
+	/** 발사체 메시 표시 즉시 갱신 (풀에서 꺼낼 때 등) */
+	void UpdateProjectileMesh(AFPSProjectile* Projectile) const;
+
+	/** 이번 프레임에 스폰을 허용한 명중 연출 수 */
+	int32 GetImpactEffectsThisFrame() const { return ImpactEffectsThisFrame; }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 이 거리 이내는 Full */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 0.0))
+	float FullDistance = 2000.0f;
+
+	/** 이 거리 이내는 Reduced */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 0.0))
+	float ReducedDistance = 5000.0f;
+
+	/** 이 거리 이내는 Minimal, 밖은 Culled */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 0.0))
+	float MinimalDistance = 10000.0f;
+
+	/** 시야 원뿔 반각 (도 단위) */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 0.0, ClampMax = 180.0))
+	float ViewConeHalfAngle = 75.0f;
+
+	/** 시야 밖일 때 낮출 단계 수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 0, ClampMax = 3))
+	int32 OffscreenTierPenalty = 1;
+
+	/** Reduced 단계에서 명중 파티클을 N번에 한 번만 스폰 */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 1))
+	int32 ReducedEmitterInterval = 2;
+
+	/** 프레임당 명중 연출 상한 (전역) */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 0))
+	int32 MaxImpactEffectsPerFrame = 24;
+
+	/** 프레임당 메시 LOD를 갱신할 발사체 수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Cosmetic LOD", meta = (ClampMin = 1))
+	int32 MeshUpdatesPerFrame = 64;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 로컬 플레이어 시점 */
+	struct FViewer
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Direction = FVector::ForwardVector;
+	};
+
+	/** 로컬 플레이어 시점 갱신 (프레임당 1회) */
+	void GatherViewers();
+
+	/** 등록된 발사체 메시 표시 갱신 (라운드 로빈) */
+	void UpdateProjectileMeshes();
+
+	/** 이번 프레임 로컬 플레이어 시점 */
+	TArray<FViewer, TInlineAllocator<2>> Viewers;
+
+	/** 메시 LOD 대상 발사체 */
+	TArray<TWeakObjectPtr<AFPSProjectile>> Projectiles;
+
+	/** 다음 메시 갱신 위치 */
+	int32 MeshUpdateCursor = 0;
+
+	/** 이번 프레임 명중 연출 수 */
+	int32 ImpactEffectsThisFrame = 0;
+
+	/** Reduced 단계 솎아내기 카운터 */
+	int32 ReducedEmitterCounter = 0;
+
+	/** cos(ViewConeHalfAngle) 캐시 */
+	float ViewConeCos = 0.0f;
+};
@@ -0,0 +1,338 @@
+// FPSEffectPoolSubsystem.cpp
+
+#include "FPSEffectPoolSubsystem.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Sound/SoundBase.h"
+#include "Components/AudioComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/World.h"
+
+bool UFPSEffectPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// 데디케이티드 서버는 연출이 없으므로 서브시스템 자체를 만들지 않음
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UFPSEffectPoolSubsystem::Deinitialize()
+{
+	// 컴포넌트는 WorldSettings 소유이므로 월드와 함께 정리됨
+	Pools.Empty();
+	NumActive = 0;
+
+	Super::Deinitialize();
+}
+
+bool UFPSEffectPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSEffectPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSEffectPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSEffectPoolSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 프레임 경계: 스폰 예산 초기화
+	SpawnsThisFrame = 0;
+	DroppedThisFrame = 0;
+
+	// 재생이 끝났거나 수명을 넘긴 컴포넌트 회수
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	for (TPair<TObjectPtr<UObject>, FFPSEffectAssetPool>& Pair : Pools)
+	{
+		FFPSEffectAssetPool& Pool = Pair.Value;
+		for (int32 Index = Pool.Active.Num() - 1; Index >= 0; --Index)
+		{
+			const USceneComponent* Component = Pool.Active[Index];
+			if (!IsValid(Component) || IsEffectFinished(Component) || CurrentTime - Pool.ActiveStartTimes[Index] > MaxEffectLifetime)
+			{
+				RecycleComponent(Pool, Index);
+			}
+		}
+	}
+}
+
+UFPSEffectPoolSubsystem* UFPSEffectPoolSubsystem::Get(const UObject* WorldContext)
+{
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSEffectPoolSubsystem>() : nullptr;
+}
+
+USceneComponent* UFPSEffectPoolSubsystem::AcquireComponent(UObject* Asset, UClass* ComponentClass, EFPSEffectPriority Priority)
+{
+	// 우선순위별 프레임 예산 (High는 전체, 나머지는 일부만 사용 -> 모자라면 낮은 것부터 버려짐)
+	float BudgetFraction = 1.0f;
+	switch (Priority)
+	{
+	case EFPSEffectPriority::Low:    BudgetFraction = LowPriorityBudgetFraction; break;
+	case EFPSEffectPriority::Normal: BudgetFraction = NormalPriorityBudgetFraction; break;
+	case EFPSEffectPriority::High:   BudgetFraction = 1.0f; break;
+	}
+
+	if (SpawnsThisFrame >= FMath::FloorToInt(MaxSpawnsPerFrame * BudgetFraction))
+	{
+		DroppedThisFrame++;
+		return nullptr;
+	}
+
+	FFPSEffectAssetPool& Pool = Pools.FindOrAdd(Asset);
+
+	// 동시 재생 상한: High는 같은 에셋의 가장 오래된 연출을 회수해 사용
+	if (Pool.Active.Num() >= MaxConcurrentPerAsset || NumActive >= MaxConcurrentTotal)
+	{
+		if (Priority != EFPSEffectPriority::High || Pool.Active.Num() == 0)
+		{
+			DroppedThisFrame++;
+			return nullptr;
+		}
+
+		RecycleComponent(Pool, 0);
+	}
+
+	USceneComponent* Component = nullptr;
+	while (!Component && Pool.Free.Num() > 0)
+	{
+		Component = Pool.Free.Pop(EAllowShrinking::No);
+		if (!IsValid(Component))
+		{
+			Component = nullptr;
+		}
+	}
+
+	if (!Component)
+	{
+		// UGameplayStatics와 같이 WorldSettings를 Outer로 사용
+		UWorld* World = GetWorld();
+		Component = NewObject<USceneComponent>(World->GetWorldSettings(), ComponentClass);
+		Component->bAutoActivate = false;
+		Component->RegisterComponentWithWorld(World);
+	}
+
+	Pool.Active.Add(Component);
+	Pool.ActiveStartTimes.Add(GetWorld()->GetTimeSeconds());
+	NumActive++;
+	SpawnsThisFrame++;
+
+	return Component;
+}
+
+void UFPSEffectPoolSubsystem::RecycleComponent(FFPSEffectAssetPool& Pool, int32 ActiveIndex)
+{
+	USceneComponent* Component = Pool.Active[ActiveIndex];
+	Pool.Active.RemoveAt(ActiveIndex, EAllowShrinking::No);
+	Pool.ActiveStartTimes.RemoveAt(ActiveIndex, EAllowShrinking::No);
+	NumActive--;
+
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	if (UParticleSystemComponent* ParticleComponent = Cast<UParticleSystemComponent>(Component))
+	{
+		ParticleComponent->DeactivateImmediate();
+	}
+	else if (UNiagaraComponent* NiagaraComponent = Cast<UNiagaraComponent>(Component))
+	{
+		NiagaraComponent->DeactivateImmediate();
+	}
+	else if (UAudioComponent* AudioComponent = Cast<UAudioComponent>(Component))
+	{
+		AudioComponent->Stop();
+	}
+
+	if (Component->GetAttachParent())
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	Pool.Free.Add(Component);
+}
+
+void UFPSEffectPoolSubsystem::PlaceComponent(USceneComponent* Component, USceneComponent* AttachTo, FName SocketName,
+	const FVector& Location, const FRotator& Rotation)
+{
+	if (AttachTo)
+	{
+		Component->AttachToComponent(AttachTo, FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
+	}
+	else
+	{
+		Component->SetWorldLocationAndRotation(Location, Rotation);
+	}
+}
+
+bool UFPSEffectPoolSubsystem::IsEffectFinished(const USceneComponent* Component)
+{
+	if (const UAudioComponent* AudioComponent = Cast<UAudioComponent>(Component))
+	{
+		return !AudioComponent->IsPlaying();
+	}
+
+	return !Component->IsActive();
+}
+
+// ========================================
+// Spawn API
+// ========================================
+
+UParticleSystemComponent* UFPSEffectPoolSubsystem::SpawnParticleAtLocation(const UObject* WorldContext, UParticleSystem* Template,
+	const FVector& Location, const FRotator& Rotation, EFPSEffectPriority Priority)
+{
+	if (!Template)
+	{
+		return nullptr;
+	}
+
+	UFPSEffectPoolSubsystem* EffectPool = Get(WorldContext);
+	if (!EffectPool)
+	{
+		UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+		return (World && World->GetNetMode() != NM_DedicatedServer)
+			? UGameplayStatics::SpawnEmitterAtLocation(World, Template, Location, Rotation)
+			: nullptr;
+	}
+
+	UParticleSystemComponent* Component = Cast<UParticleSystemComponent>(
+		EffectPool->AcquireComponent(Template, UParticleSystemComponent::StaticClass(), Priority));
+	if (Component)
+	{
+		PlaceComponent(Component, nullptr, NAME_None, Location, Rotation);
+		Component->SetTemplate(Template);
+		Component->ActivateSystem(true);
+	}
+
+	return Component;
+}
+
+UParticleSystemComponent* UFPSEffectPoolSubsystem::SpawnParticleAttached(UParticleSystem* Template, USceneComponent* AttachTo,
+	FName SocketName, EFPSEffectPriority Priority)
+{
+	if (!Template || !AttachTo)
+	{
+		return nullptr;
+	}
+
+	UFPSEffectPoolSubsystem* EffectPool = Get(AttachTo);
+	if (!EffectPool)
+	{
+		return AttachTo->GetNetMode() != NM_DedicatedServer
+			? UGameplayStatics::SpawnEmitterAttached(Template, AttachTo, SocketName)
+			: nullptr;
+	}
+
+	UParticleSystemComponent* Component = Cast<UParticleSystemComponent>(
+		EffectPool->AcquireComponent(Template, UParticleSystemComponent::StaticClass(), Priority));
+	if (Component)
+	{
+		PlaceComponent(Component, AttachTo, SocketName, FVector::ZeroVector, FRotator::ZeroRotator);
+		Component->SetTemplate(Template);
+		Component->ActivateSystem(true);
+	}
+
+	return Component;
+}
+
+UNiagaraComponent* UFPSEffectPoolSubsystem::SpawnNiagaraAtLocation(const UObject* WorldContext, UNiagaraSystem* System,
+	const FVector& Location, const FRotator& Rotation, EFPSEffectPriority Priority)
+{
+	if (!System)
+	{
+		return nullptr;
+	}
+
+	UFPSEffectPoolSubsystem* EffectPool = Get(WorldContext);
+	if (!EffectPool)
+	{
+		UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+		return (World && World->GetNetMode() != NM_DedicatedServer)
+			? UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, System, Location, Rotation)
+			: nullptr;
+	}
+
+	UNiagaraComponent* Component = Cast<UNiagaraComponent>(
+		EffectPool->AcquireComponent(System, UNiagaraComponent::StaticClass(), Priority));
+	if (Component)
+	{
+		PlaceComponent(Component, nullptr, NAME_None, Location, Rotation);
+		if (Component->GetAsset() != System)
+		{
+			Component->SetAsset(System);
+		}
+		Component->Activate(true);
+	}
+
+	return Component;
+}
+
+UNiagaraComponent* UFPSEffectPoolSubsystem::SpawnNiagaraAttached(UNiagaraSystem* System, USceneComponent* AttachTo, FName SocketName,
+	EFPSEffectPriority Priority)
+{
+	if (!System || !AttachTo)
+	{
+		return nullptr;
+	}
+
+	UFPSEffectPoolSubsystem* EffectPool = Get(AttachTo);
+	if (!EffectPool)
+	{
+		return AttachTo->GetNetMode() != NM_DedicatedServer
+			? UNiagaraFunctionLibrary::SpawnSystemAttached(System, AttachTo, SocketName, FVector::ZeroVector, FRotator::ZeroRotator,
+				EAttachLocation::SnapToTarget, true)
+			: nullptr;
+	}
+
+	UNiagaraComponent* Component = Cast<UNiagaraComponent>(
+		EffectPool->AcquireComponent(System, UNiagaraComponent::StaticClass(), Priority));
+	if (Component)
+	{
+		PlaceComponent(Component, AttachTo, SocketName, FVector::ZeroVector, FRotator::ZeroRotator);
+		if (Component->GetAsset() != System)
+		{
+			Component->SetAsset(System);
+		}
+		Component->Activate(true);
+	}
+
+	return Component;
+}
+
+UAudioComponent* UFPSEffectPoolSubsystem::PlaySoundAtLocation(const UObject* WorldContext, USoundBase* Sound, const FVector& Location,
+	EFPSEffectPriority Priority)
+{
+	if (!Sound)
+	{
+		return nullptr;
+	}
+
+	UFPSEffectPoolSubsystem* EffectPool = Get(WorldContext);
+	if (!EffectPool)
+	{
+		UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+		if (World && World->GetNetMode() != NM_DedicatedServer)
+		{
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, Location);
+		}
+		return nullptr;
+	}
+
+	UAudioComponent* Component = Cast<UAudioComponent>(
+		EffectPool->AcquireComponent(Sound, UAudioComponent::StaticClass(), Priority));
+	if (Component)
+	{
+		PlaceComponent(Component, nullptr, NAME_None, Location, FRotator::ZeroRotator);
+		Component->SetSound(Sound);
+		Component->Play();
+	}
+
+	return Component;
+}
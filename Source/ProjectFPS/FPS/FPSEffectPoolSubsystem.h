@@ -0,0 +1,161 @@
+// FPSEffectPoolSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSEffectPoolSubsystem.generated.h"
+
+class UParticleSystem;
+class UParticleSystemComponent;
+class UNiagaraSystem;
+class UNiagaraComponent;
+class USoundBase;
+class UAudioComponent;
+class USceneComponent;
+
+/**
+ * 연출 요청 우선순위 (예산 초과 시 낮은 것부터 버림)
+ */
+UENUM(BlueprintType)
+enum class EFPSEffectPriority : uint8
+{
+	Low,     // 트레이서 등 빠져도 티가 나지 않는 연출
+	Normal,  // 명중 이펙트/사운드
+	High     // 총구 화염/발사음 등 플레이어가 직접 보는 연출
+};
+
+/**
+ * 에셋별 컴포넌트 풀
+ */
+USTRUCT()
+struct FFPSEffectAssetPool
+{
+	GENERATED_BODY()
+
+	/** 재생 중 (오래된 순서) */
+	UPROPERTY()
+	TArray<TObjectPtr<USceneComponent>> Active;
+
+	/** 재생 시작 시간 (Active와 같은 순서) */
+	TArray<double> ActiveStartTimes;
+
+	/** 재사용 대기 */
+	UPROPERTY()
+	TArray<TObjectPtr<USceneComponent>> Free;
+};
+
+/**
+ * 연출 컴포넌트 풀 서브시스템 (월드 단위, 데디케이티드 서버에서는 생성하지 않음)
+ * - 파티클 / Niagara / 오디오 컴포넌트를 에셋별로 재사용 (요청마다 컴포넌트 생성하지 않음)
+ * - 프레임당 스폰 예산: 우선순위별로 쓸 수 있는 비율이 달라 예산이 모자라면 Low -> Normal 순으로 버림
+ * - 에셋별/전체 동시 재생 상한: 초과 시 High는 가장 오래된 컴포넌트를 회수해 사용, 나머지는 버림
+ * - 재생 완료는 Tick에서 확인 (MaxEffectLifetime을 넘긴 반복 연출도 회수)
+ * - 정적 Spawn 함수는 서브시스템이 없으면 UGameplayStatics / UNiagaraFunctionLibrary로 대체
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSEffectPoolSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSEffectPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// Spawn API (예산 초과로 버려지면 nullptr)
+	// ========================================
+
+	/** 위치에 파티클 재생 */
+	static UParticleSystemComponent* SpawnParticleAtLocation(const UObject* WorldContext, UParticleSystem* Template,
+		const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator, EFPSEffectPriority Priority = EFPSEffectPriority::Normal);
+
+	/** 컴포넌트 소켓에 붙여 파티클 재생 */
+	static UParticleSystemComponent* SpawnParticleAttached(UParticleSystem* Template, USceneComponent* AttachTo, FName SocketName,
+		EFPSEffectPriority Priority = EFPSEffectPriority::Normal);
+
+	/** 위치에 Niagara 재생 */
+	static UNiagaraComponent* SpawnNiagaraAtLocation(const UObject* WorldContext, UNiagaraSystem* System,
+		const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator, EFPSEffectPriority Priority = EFPSEffectPriority::Normal);
+
+	/** 컴포넌트 소켓에 붙여 Niagara 재생 */
+	static UNiagaraComponent* SpawnNiagaraAttached(UNiagaraSystem* System, USceneComponent* AttachTo, FName SocketName,
+		EFPSEffectPriority Priority = EFPSEffectPriority::Normal);
+
+	/** 위치에 사운드 재생 */
+	static UAudioComponent* PlaySoundAtLocation(const UObject* WorldContext, USoundBase* Sound, const FVector& Location,
+		EFPSEffectPriority Priority = EFPSEffectPriority::Normal);
+
+	/** 현재 재생 중인 풀 컴포넌트 수 */
+	int32 GetActiveEffectCount() const { return NumActive; }
+
+	/** 이번 프레임 스폰 수 / 버린 요청 수 */
+	int32 GetSpawnsThisFrame() const { return SpawnsThisFrame; }
+	int32 GetDroppedThisFrame() const { return DroppedThisFrame; }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 프레임당 스폰 예산 */
+	UPROPERTY(Config, EditAnywhere, Category = "Effect Pool", meta = (ClampMin = 1))
+	int32 MaxSpawnsPerFrame = 32;
+
+	/** Low 우선순위가 쓸 수 있는 예산 비율 */
+	UPROPERTY(Config, EditAnywhere, Category = "Effect Pool", meta = (ClampMin = 0.0, ClampMax = 1.0))
+	float LowPriorityBudgetFraction = 0.5f;
+
+	/** Normal 우선순위가 쓸 수 있는 예산 비율 (High는 항상 전체) */
+	UPROPERTY(Config, EditAnywhere, Category = "Effect Pool", meta = (ClampMin = 0.0, ClampMax = 1.0))
+	float NormalPriorityBudgetFraction = 0.85f;
+
+	/** 에셋별 동시 재생 상한 */
+	UPROPERTY(Config, EditAnywhere, Category = "Effect Pool", meta = (ClampMin = 1))
+	int32 MaxConcurrentPerAsset = 16;
+
+	/** 전체 동시 재생 상한 */
+	UPROPERTY(Config, EditAnywhere, Category = "Effect Pool", meta = (ClampMin = 1))
+	int32 MaxConcurrentTotal = 128;
+
+	/** 이 시간이 지나면 재생 중이어도 회수 (반복 연출 누수 방지, 초) */
+	UPROPERTY(Config, EditAnywhere, Category = "Effect Pool", meta = (ClampMin = 0.1))
+	float MaxEffectLifetime = 5.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 월드 컨텍스트의 풀 (없으면 nullptr) */
+	static UFPSEffectPoolSubsystem* Get(const UObject* WorldContext);
+
+	/** 예산/상한 확인 후 재사용 가능한 컴포넌트 확보 (버려지면 nullptr) */
+	USceneComponent* AcquireComponent(UObject* Asset, UClass* ComponentClass, EFPSEffectPriority Priority);
+
+	/** 컴포넌트를 정지하고 Free로 이동 */
+	void RecycleComponent(FFPSEffectAssetPool& Pool, int32 ActiveIndex);
+
+	/** 위치 배치 또는 소켓 부착 */
+	static void PlaceComponent(USceneComponent* Component, USceneComponent* AttachTo, FName SocketName,
+		const FVector& Location, const FRotator& Rotation);
+
+	/** 재생이 끝났는지 */
+	static bool IsEffectFinished(const USceneComponent* Component);
+
+	/** 에셋 -> 풀 */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UObject>, FFPSEffectAssetPool> Pools;
+
+	/** 전체 재생 중 수 */
+	int32 NumActive = 0;
+
+	/** 이번 프레임 스폰 / 버림 수 */
+	int32 SpawnsThisFrame = 0;
+	int32 DroppedThisFrame = 0;
+};
@@ -2,6 +2,7 @@
 
 
 #include "FPS/FPSGameModeBase.h"
+#include "FPS/FPSLog.h"
 #include "FPS/FPSCharacter.h"
 #include "GameFramework/Controller.h" // For AController
 #include "GameFramework/PlayerController.h" // For APlayerController
@@ -14,7 +15,7 @@ void AFPSGameModeBase::PlayerDied(AController* PlayerController)
 {
 	if (PlayerController)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("플레이어 사망 - 리스폰 시작"));
+		UE_LOG(LogFPS, Warning, TEXT("플레이어 사망 - 리스폰 시작"));
 
 		// 기존 플레이어를 랜덤 PlayerStart 위치로 이동
 		if (APawn* ExistingPawn = PlayerController->GetPawn())
@@ -27,22 +28,22 @@ void AFPSGameModeBase::PlayerDied(AController* PlayerController)
 				FVector NewLocation = PlayerStart->GetActorLocation();
 				FRotator NewRotation = PlayerStart->GetActorRotation();
 				ExistingPawn->SetActorLocationAndRotation(NewLocation, NewRotation);
-				UE_LOG(LogTemp, Warning, TEXT("플레이어를 새로운 위치로 이동: %s"), *NewLocation.ToString());
+				UE_LOG(LogFPS, Warning, TEXT("플레이어를 새로운 위치로 이동: %s"), *NewLocation.ToString());
 			}
 
 			// 플레이어 상태 복구
 			if (AFPSCharacter* FPSChar = Cast<AFPSCharacter>(ExistingPawn))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("기존 FPS 캐릭터 상태 복구 호출"));
+				UE_LOG(LogFPS, Warning, TEXT("기존 FPS 캐릭터 상태 복구 호출"));
 				FPSChar->OnPlayerRespawn();
 			}
 		}
 
-		UE_LOG(LogTemp, Warning, TEXT("플레이어 리스폰 완료"));
+		UE_LOG(LogFPS, Warning, TEXT("플레이어 리스폰 완료"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PlayerController가 null입니다!"));
+		UE_LOG(LogFPS, Error, TEXT("PlayerController가 null입니다!"));
 	}
 }
 
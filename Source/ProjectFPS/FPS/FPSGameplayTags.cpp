@@ -0,0 +1,49 @@
+// FPSGameplayTags.cpp
+
+#include "FPSGameplayTags.h"
+
+namespace FPSGameplayTags
+{
+	// ========================================
+	// Ability
+	// ========================================
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Ability_Fire, "Ability.Fire", "탄환 발사");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Ability_Reload, "Ability.Reload", "무기 로드 어빌리티");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Ability_Sprint, "Ability.Sprint", "이동 속도 증가");
+	UE_DEFINE_GAMEPLAY_TAG(Ability_UseConsumable, "Ability.UseConsumable");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Ability_Berserker, "Ability.Berserker", "버서커 스킬");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Ability_ShieldBarrier, "Ability.ShieldBarrier", "방어막 스킬");
+
+	// ========================================
+	// Cooldown
+	// ========================================
+
+	UE_DEFINE_GAMEPLAY_TAG(Cooldown_ActiveSkill, "Cooldown.ActiveSkill");
+
+	// ========================================
+	// Data (SetByCaller)
+	// ========================================
+
+	UE_DEFINE_GAMEPLAY_TAG(Data_Damage, "Data.Damage");
+	UE_DEFINE_GAMEPLAY_TAG(Data_IsCritical, "Data.IsCritical");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_HitCount, "Data.HitCount", "프레임 내 합쳐진 명중 수");
+	UE_DEFINE_GAMEPLAY_TAG(Data_Cooldown, "Data.Cooldown");
+	UE_DEFINE_GAMEPLAY_TAG(Data_HealAmount, "Data.HealAmount");
+	UE_DEFINE_GAMEPLAY_TAG(Data_SprintSpeed, "Data.SprintSpeed");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_SkillPointGain, "Data.SkillPointGain", "스킬 포인트 보상량");
+
+	// ========================================
+	// State
+	// ========================================
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Reloading, "State.Reloading", "리로드 중");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Sprinting, "State.Sprinting", "질주 중");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_ShieldBarrier, "State.ShieldBarrier", "방어막 유지 중");
+
+	// ========================================
+	// Skill
+	// ========================================
+
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Skill_Common_MaxHealth, "Skill.Common.MaxHealth", "최대체력+50");
+}
@@ -0,0 +1,59 @@
+// FPSGameplayTags.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * 네이티브 GameplayTag 목록
+ * - 모듈 로드 시 한 번만 등록되므로 사용처에서 문자열 조회(RequestGameplayTag)가 필요 없음
+ * - 코드에서 등록되므로 설정 누락으로 무효 태그가 되는 일이 없고, 오타는 컴파일 에러
+ * - 에디터 표시용 설명은 DefaultGameplayTags.ini 항목과 동일하게 유지
+ * - 새 태그는 여기와 DefaultGameplayTags.ini에 함께 추가
+ */
+namespace FPSGameplayTags
+{
+	// ========================================
+	// Ability
+	// ========================================
+
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Fire);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Reload);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Sprint);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_UseConsumable);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Berserker);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_ShieldBarrier);
+
+	// ========================================
+	// Cooldown
+	// ========================================
+
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_ActiveSkill);
+
+	// ========================================
+	// Data (SetByCaller)
+	// ========================================
+
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Damage);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_IsCritical);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_HitCount);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Cooldown);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_HealAmount);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_SprintSpeed);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_SkillPointGain);
+
+	// ========================================
+	// State (어빌리티 활성 중 부여되는 상태, FPSStateGate 참고)
+	// ========================================
+
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Reloading);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Sprinting);
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_ShieldBarrier);
+
+	// ========================================
+	// Skill
+	// ========================================
+
+	PROJECTFPS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Skill_Common_MaxHealth);
+}
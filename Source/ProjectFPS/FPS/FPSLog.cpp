@@ -0,0 +1,38 @@
+// FPSLog.cpp
+
+#include "FPSLog.h"
+
+DEFINE_LOG_CATEGORY(LogFPS);
+DEFINE_LOG_CATEGORY(LogFPSCombat);
+DEFINE_LOG_CATEGORY(LogFPSAI);
+DEFINE_LOG_CATEGORY(LogFPSInventory);
+DEFINE_LOG_CATEGORY(LogFPSUI);
+
+DEFINE_STAT(STAT_FPSShotsFired);
+DEFINE_STAT(STAT_FPSCriticalHits);
+DEFINE_STAT(STAT_FPSProjectileOverlaps);
+DEFINE_STAT(STAT_FPSDamageApplications);
+DEFINE_STAT(STAT_FPSDamageExecutions);
+DEFINE_STAT(STAT_FPSAIStateChanges);
+DEFINE_STAT(STAT_FPSAIUpdates);
+DEFINE_STAT(STAT_FPSAIDeferredUpdates);
+DEFINE_STAT(STAT_FPSVisibilityCacheHits);
+DEFINE_STAT(STAT_FPSVisibilityCacheMisses);
+DEFINE_STAT(STAT_FPSLineOfSightTraces);
+DEFINE_STAT(STAT_FPSPathQueries);
+DEFINE_STAT(STAT_FPSPathCorridorReuses);
+DEFINE_STAT(STAT_FPSFlowFieldCells);
+DEFINE_STAT(STAT_FPSSignificanceHigh);
+DEFINE_STAT(STAT_FPSSignificanceMedium);
+DEFINE_STAT(STAT_FPSSignificanceLow);
+DEFINE_STAT(STAT_FPSSignificanceDormant);
+DEFINE_STAT(STAT_FPSSignificanceTierChanges);
+DEFINE_STAT(STAT_FPSCrowdAgents);
+DEFINE_STAT(STAT_FPSCrowdPromoted);
+DEFINE_STAT(STAT_FPSCrowdPromotions);
+DEFINE_STAT(STAT_FPSCrowdDemotions);
+DEFINE_STAT(STAT_FPSInventoryPlacements);
+
+#if !UE_BUILD_SHIPPING
+FFPSCombatCounters GFPSCombatCounters;
+#endif
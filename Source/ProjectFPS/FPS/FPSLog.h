@@ -0,0 +1,110 @@
+// FPSLog.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * FPS 로그 카테고리
+ * - 빌드 구성별 컴파일 타임 최대 Verbosity
+ *   Debug/DebugGame: All, Development: Log (Verbose 이하 컴파일 제외), Test/Shipping: Warning
+ * - 매 발사/명중/상태 변경마다 찍히는 로그는 Verbose로 두고 아래 Stat 카운터로 대체
+ *   (stat FPSCombat / stat FPSGameplay 로 확인, STATS가 꺼진 빌드에서는 비용 없음)
+ */
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+	#define FPS_LOG_COMPILE_VERBOSITY Warning
+#elif UE_BUILD_DEVELOPMENT
+	#define FPS_LOG_COMPILE_VERBOSITY Log
+#else
+	#define FPS_LOG_COMPILE_VERBOSITY All
+#endif
+
+/** 일반 (캐릭터/게임 모드/스킬/서브시스템) */
+PROJECTFPS_API DECLARE_LOG_CATEGORY_EXTERN(LogFPS, Log, FPS_LOG_COMPILE_VERBOSITY);
+
+/** 전투 (무기/발사체/데미지/어빌리티/AttributeSet) */
+PROJECTFPS_API DECLARE_LOG_CATEGORY_EXTERN(LogFPSCombat, Log, FPS_LOG_COMPILE_VERBOSITY);
+
+/** AI (적 캐릭터/AI 컨트롤러) */
+PROJECTFPS_API DECLARE_LOG_CATEGORY_EXTERN(LogFPSAI, Log, FPS_LOG_COMPILE_VERBOSITY);
+
+/** 인벤토리 (인벤토리/무기 슬롯/픽업/아이템) */
+PROJECTFPS_API DECLARE_LOG_CATEGORY_EXTERN(LogFPSInventory, Log, FPS_LOG_COMPILE_VERBOSITY);
+
+/** UI (HUD/위젯) */
+PROJECTFPS_API DECLARE_LOG_CATEGORY_EXTERN(LogFPSUI, Log, FPS_LOG_COMPILE_VERBOSITY);
+
+// ========================================
+// Stat 카운터 (프레임마다 초기화)
+// ========================================
+
+DECLARE_STATS_GROUP(TEXT("FPS Combat"), STATGROUP_FPSCombat, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("FPS Gameplay"), STATGROUP_FPSGameplay, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shots Fired"), STAT_FPSShotsFired, STATGROUP_FPSCombat, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Critical Hits"), STAT_FPSCriticalHits, STATGROUP_FPSCombat, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projectile Overlaps"), STAT_FPSProjectileOverlaps, STATGROUP_FPSCombat, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Applications"), STAT_FPSDamageApplications, STATGROUP_FPSCombat, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Executions"), STAT_FPSDamageExecutions, STATGROUP_FPSCombat, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI State Changes"), STAT_FPSAIStateChanges, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Updates"), STAT_FPSAIUpdates, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Deferred Updates"), STAT_FPSAIDeferredUpdates, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visibility Cache Hits"), STAT_FPSVisibilityCacheHits, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visibility Cache Misses"), STAT_FPSVisibilityCacheMisses, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Line Of Sight Traces"), STAT_FPSLineOfSightTraces, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Queries"), STAT_FPSPathQueries, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Corridor Reuses"), STAT_FPSPathCorridorReuses, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Flow Field Cells"), STAT_FPSFlowFieldCells, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significance High"), STAT_FPSSignificanceHigh, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significance Medium"), STAT_FPSSignificanceMedium, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significance Low"), STAT_FPSSignificanceLow, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significance Dormant"), STAT_FPSSignificanceDormant, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Significance Tier Changes"), STAT_FPSSignificanceTierChanges, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Crowd Agents"), STAT_FPSCrowdAgents, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Crowd Promoted"), STAT_FPSCrowdPromoted, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Crowd Promotions"), STAT_FPSCrowdPromotions, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Crowd Demotions"), STAT_FPSCrowdDemotions, STATGROUP_FPSGameplay, PROJECTFPS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Inventory Placements"), STAT_FPSInventoryPlacements, STATGROUP_FPSGameplay, PROJECTFPS_API);
+
+// ========================================
+// 누적 전투 카운터
+// ========================================
+
+/**
+ * 세션 누적 전투 카운터
+ * - Stat 카운터는 프레임마다 초기화되므로 벤치마크/자동화에서 구간 합계를 구할 때 사용
+ * - 게임 스레드에서만 증가 (스냅샷 차이로 구간 값 계산), Shipping에서는 집계하지 않음
+ */
+struct FFPSCombatCounters
+{
+	/** 발사 수 (산탄 묶음은 1발) */
+	int64 ShotsFired = 0;
+
+	/** 발사체 발사 수 (발사체 액터 + 시뮬레이션 발사체) */
+	int64 ProjectilesLaunched = 0;
+
+	/** 발사체 액터 실제 스폰 수 (풀 생성 + 풀 밖 스폰) */
+	int64 ProjectileActorSpawns = 0;
+
+	/** 데미지 요청 수 (큐 합치기 이전) */
+	int64 DamageApplications = 0;
+
+	/** GameplayEffect 적용 수 (큐 합치기 이후) */
+	int64 DamageExecutions = 0;
+
+	/** 크리티컬 수 */
+	int64 CriticalHits = 0;
+};
+
+#if !UE_BUILD_SHIPPING
+
+extern PROJECTFPS_API FFPSCombatCounters GFPSCombatCounters;
+
+#define FPS_INC_COMBAT_COUNTER(Counter) (++GFPSCombatCounters.Counter)
+
+#else
+
+#define FPS_INC_COMBAT_COUNTER(Counter)
+
+#endif
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/FPSPlayerCharacter.h"
+#include "FPS/FPSLog.h"
 #include "FPS/CharacterAttributeSet.h"
 #include "FPS/PlayerAttributeSet.h"
 #include "FPS/UI/PlayerHUD.h"
@@ -19,9 +20,10 @@
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "Blueprint/UserWidget.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Abilities/GameplayAbility.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/FPSSpatialHashSubsystem.h"
 
 AFPSPlayerCharacter::AFPSPlayerCharacter()
 {
@@ -83,11 +85,11 @@ void AFPSPlayerCharacter::BeginPlay()
 			if (PlayerHUDWidget)
 			{
 				PlayerHUDWidget->AddToViewport();
-				UE_LOG(LogTemp, Log, TEXT("PlayerHUD 위젯 생성 완료"));
+				UE_LOG(LogFPS, Log, TEXT("PlayerHUD 위젯 생성 완료"));
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("PlayerHUD 생성 실패"));
+				UE_LOG(LogFPS, Error, TEXT("PlayerHUD 생성 실패"));
 			}
 		}
 
@@ -98,7 +100,7 @@ void AFPSPlayerCharacter::BeginPlay()
 			if (ToastManagerWidget)
 			{
 				ToastManagerWidget->AddToViewport(10); // 높은 ZOrder로 최상단 표시
-				UE_LOG(LogTemp, Log, TEXT("ToastManager 위젯 생성 완료"));
+				UE_LOG(LogFPS, Log, TEXT("ToastManager 위젯 생성 완료"));
 			}
 		}
 
@@ -109,13 +111,13 @@ void AFPSPlayerCharacter::BeginPlay()
 			if (ActiveSkillWidget)
 			{
 				ActiveSkillWidget->AddToViewport(5); // ZOrder 5 (HUD보다 위, Toast보다 아래)
-				UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget 생성 완료"));
+				UE_LOG(LogFPS, Log, TEXT("ActiveSkillWidget 생성 완료"));
 
 				// SkillComponent 델리게이트 바인딩
 				if (SkillComponent)
 				{
 					SkillComponent->OnActiveSkillChanged.AddDynamic(ActiveSkillWidget, &UActiveSkillWidget::UpdateActiveSkill);
-					UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget 델리게이트 바인딩 완료"));
+					UE_LOG(LogFPS, Log, TEXT("ActiveSkillWidget 델리게이트 바인딩 완료"));
 				}
 			}
 		}
@@ -267,12 +269,12 @@ void AFPSPlayerCharacter::OnStaminaChanged(const FOnAttributeChangeData& Data)
 		PlayerHUDWidget->UpdateStaminaBar(Data.NewValue, AttributeSet->GetMaxStamina());
 	}
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("스태미나 변경: %.1f / %.1f"), Data.NewValue, AttributeSet ? AttributeSet->GetMaxStamina() : 0.0f);
+	UE_LOG(LogFPS, VeryVerbose, TEXT("스태미나 변경: %.1f / %.1f"), Data.NewValue, AttributeSet ? AttributeSet->GetMaxStamina() : 0.0f);
 
 	// 스태미나가 0 이하가 되면 Sprint Ability 자동 종료
 	if (Data.NewValue <= 0.0f && AbilitySystemComponent)
 	{
-		FGameplayTag SprintTag = FGameplayTag::RequestGameplayTag(FName("Ability.Sprint"));
+		FGameplayTag SprintTag = FPSGameplayTags::Ability_Sprint;
 		TArray<FGameplayAbilitySpec*> ActiveAbilities;
 		AbilitySystemComponent->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
 			FGameplayTagContainer(SprintTag),
@@ -284,7 +286,7 @@ void AFPSPlayerCharacter::OnStaminaChanged(const FOnAttributeChangeData& Data)
 			if (Spec && Spec->IsActive())
 			{
 				AbilitySystemComponent->CancelAbilityHandle(Spec->Handle);
-				UE_LOG(LogTemp, Warning, TEXT("스태미나 고갈: Sprint Ability 자동 종료"));
+				UE_LOG(LogFPS, Warning, TEXT("스태미나 고갈: Sprint Ability 자동 종료"));
 			}
 		}
 	}
@@ -298,13 +300,13 @@ void AFPSPlayerCharacter::OnShieldChanged(const FOnAttributeChangeData& Data)
 		PlayerHUDWidget->UpdateShieldBar(Data.NewValue, AttributeSet->GetMaxShield());
 	}
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("쉴드 변경: %.1f / %.1f"), Data.NewValue, AttributeSet ? AttributeSet->GetMaxShield() : 0.0f);
+	UE_LOG(LogFPS, VeryVerbose, TEXT("쉴드 변경: %.1f / %.1f"), Data.NewValue, AttributeSet ? AttributeSet->GetMaxShield() : 0.0f);
 }
 
 void AFPSPlayerCharacter::OnSkillPointChanged(const FOnAttributeChangeData& Data)
 {
 	// 스킬 포인트 변경 시 로그 출력 (나중에 UI 업데이트 추가)
-	UE_LOG(LogTemp, Log, TEXT("SkillPoint 변경: %.0f"), Data.NewValue);
+	UE_LOG(LogFPS, Log, TEXT("SkillPoint 변경: %.0f"), Data.NewValue);
 
 	// TODO: 스킬트리 UI가 있다면 여기서 업데이트
 }
@@ -319,7 +321,7 @@ void AFPSPlayerCharacter::OnMoveSpeedMultiplierChanged(const FOnAttributeChangeD
 
 		GetCharacterMovement()->MaxWalkSpeed = NewMaxWalkSpeed;
 
-		UE_LOG(LogTemp, Warning, TEXT("🏃 MoveSpeedMultiplier 변경: %.2fx → MaxWalkSpeed: %.0f"),
+		UE_LOG(LogFPS, Warning, TEXT("🏃 MoveSpeedMultiplier 변경: %.2fx → MaxWalkSpeed: %.0f"),
 			Data.NewValue, NewMaxWalkSpeed);
 	}
 }
@@ -369,12 +371,12 @@ void AFPSPlayerCharacter::FireAbilityPressed(const FInputActionValue& Value)
 		else if (AbilitySystemComponent)
 		{
 			bool bSuccess = AbilitySystemComponent->TryActivateAbilitiesByTag(
-				FGameplayTagContainer(FGameplayTag::RequestGameplayTag(FName("Ability.Fire")))
+				FGameplayTagContainer(FPSGameplayTags::Ability_Fire)
 			);
 
 			if (!bSuccess)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("FireAbilityPressed: 발사 어빌리티 활성화 실패"));
+				UE_LOG(LogFPS, Warning, TEXT("FireAbilityPressed: 발사 어빌리티 활성화 실패"));
 			}
 		}
 	}
@@ -424,71 +426,37 @@ void AFPSPlayerCharacter::TryPickupItem(const FInputActionValue& Value)
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("E키 픽업 시도"));
+	UE_LOG(LogFPS, Log, TEXT("E키 픽업 시도"));
 
-	// 플레이어 위치에서 SphereTrace 수행
+	// 공간 해시에서 드롭된 Pickupable 중 가장 가까운 것 검색 (물리 씬 오버랩 없이)
 	FVector PlayerLocation = GetActorLocation();
 	float PickupRange = 200.0f; // 픽업 범위
 
-	// 오브젝트 타입 필터
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_WorldDynamic));
-
-	// 충돌 무시 액터 설정
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(this);
-
-	// 오버랩 결과
-	TArray<AActor*> OutActors;
-	const bool bAny = UKismetSystemLibrary::SphereOverlapActors(
-		GetWorld(),
-		PlayerLocation,
-		PickupRange,
-		ObjectTypes,
-		/*ClassFilter=*/AActor::StaticClass(),
-		ActorsToIgnore,
-		OutActors
-	);
-
-	if (!bAny)
-	{
-		UE_LOG(LogTemp, Log, TEXT("주변에 픽업 가능한 아이템이 없습니다"));
+	UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this);
+	if (!SpatialHash)
+	{
+		UE_LOG(LogFPS, Warning, TEXT("TryPickupItem: 공간 해시가 없습니다"));
 		return;
 	}
 
-	// 가장 가까운 Pickupable 아이템 고르기 (+ 상태 체크)
-	IPickupable* ClosestPickupable = nullptr;
-	float ClosestDistance = FLT_MAX;
-
-	for (AActor* OverlapActor : OutActors)
-	{
-		if (OverlapActor)
+	AActor* ClosestActor = SpatialHash->FindNearest(PlayerLocation, PickupRange, EFPSSpatialCategory::Pickupable,
+		[](const AActor* Candidate)
 		{
-			if (IPickupable* Pickupable = Cast<IPickupable>(OverlapActor))
-			{
-				// 드롭된 상태인 아이템만 고려
-				if (Pickupable->IsDropped())
-				{
-					float Distance = FVector::Dist(PlayerLocation, OverlapActor->GetActorLocation());
-					if (Distance < ClosestDistance)
-					{
-						ClosestDistance = Distance;
-						ClosestPickupable = Pickupable;
-					}
-				}
-			}
-		}
-	}
+			const IPickupable* Pickupable = Cast<const IPickupable>(Candidate);
+			return Pickupable && Pickupable->IsDropped();
+		});
+
+	IPickupable* ClosestPickupable = Cast<IPickupable>(ClosestActor);
 
 	// 가장 가까운 아이템 픽업 시도
 	if (ClosestPickupable)
 	{
-		UE_LOG(LogTemp, Log, TEXT("가장 가까운 아이템 픽업 시도: %s"), *ClosestPickupable->GetPickupDisplayName());
+		UE_LOG(LogFPS, Log, TEXT("가장 가까운 아이템 픽업 시도: %s"), *ClosestPickupable->GetPickupDisplayName());
 		ClosestPickupable->OnPickedUp(this);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("픽업 가능한 아이템을 찾을 수 없습니다"));
+		UE_LOG(LogFPS, Log, TEXT("픽업 가능한 아이템을 찾을 수 없습니다"));
 	}
 }
 
@@ -501,23 +469,23 @@ void AFPSPlayerCharacter::ReloadPressed(const FInputActionValue& Value)
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("R키 리로드 시도"));
+	UE_LOG(LogFPS, Log, TEXT("R키 리로드 시도"));
 
 	// GameplayAbility_Reload 활성화
 	if (AbilitySystemComponent)
 	{
 		// 리로드 어빌리티 클래스로 어빌리티 활성화 시도
 		// 어빌리티 클래스는 Blueprint에서 설정해야 함
-		bool bSuccess = AbilitySystemComponent->TryActivateAbilitiesByTag(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(FName("Ability.Reload"))));
+		bool bSuccess = AbilitySystemComponent->TryActivateAbilitiesByTag(FGameplayTagContainer(FPSGameplayTags::Ability_Reload));
 
 		if (!bSuccess)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ReloadPressed: 리로드 어빌리티 활성화 실패 (어빌리티가 없거나 조건 불충족)"));
+			UE_LOG(LogFPS, Warning, TEXT("ReloadPressed: 리로드 어빌리티 활성화 실패 (어빌리티가 없거나 조건 불충족)"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ReloadPressed: AbilitySystemComponent가 null입니다"));
+		UE_LOG(LogFPS, Error, TEXT("ReloadPressed: AbilitySystemComponent가 null입니다"));
 	}
 }
 
@@ -534,23 +502,23 @@ void AFPSPlayerCharacter::Sprint(const FInputActionValue& Value)
 	if (bIsSprinting)
 	{
 		// Shift 눌림: Sprint Ability 활성화
-		UE_LOG(LogTemp, Log, TEXT("Shift 키 눌림: Sprint 시작 시도"));
+		UE_LOG(LogFPS, Log, TEXT("Shift 키 눌림: Sprint 시작 시도"));
 		bool bSuccess = AbilitySystemComponent->TryActivateAbilitiesByTag(
-			FGameplayTagContainer(FGameplayTag::RequestGameplayTag(FName("Ability.Sprint")))
+			FGameplayTagContainer(FPSGameplayTags::Ability_Sprint)
 		);
 
 		if (!bSuccess)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Sprint: 어빌리티 활성화 실패 (스태미나 부족 또는 어빌리티 없음)"));
+			UE_LOG(LogFPS, Warning, TEXT("Sprint: 어빌리티 활성화 실패 (스태미나 부족 또는 어빌리티 없음)"));
 		}
 	}
 	else
 	{
 		// Shift 뗌: Sprint Ability 종료
-		UE_LOG(LogTemp, Log, TEXT("Shift 키 뗌: Sprint 종료 시도"));
+		UE_LOG(LogFPS, Log, TEXT("Shift 키 뗌: Sprint 종료 시도"));
 
 		// 활성화된 Sprint Ability 찾아서 종료
-		FGameplayTag SprintTag = FGameplayTag::RequestGameplayTag(FName("Ability.Sprint"));
+		FGameplayTag SprintTag = FPSGameplayTags::Ability_Sprint;
 		TArray<FGameplayAbilitySpec*> ActiveAbilities;
 		AbilitySystemComponent->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
 			FGameplayTagContainer(SprintTag),
@@ -562,7 +530,7 @@ void AFPSPlayerCharacter::Sprint(const FInputActionValue& Value)
 			if (Spec && Spec->IsActive())
 			{
 				AbilitySystemComponent->CancelAbilityHandle(Spec->Handle);
-				UE_LOG(LogTemp, Log, TEXT("Sprint Ability 종료됨"));
+				UE_LOG(LogFPS, Log, TEXT("Sprint Ability 종료됨"));
 			}
 		}
 	}
@@ -617,7 +585,7 @@ void AFPSPlayerCharacter::UpdateWeaponHUD(int32 CurrentAmmo, int32 MagazineSize)
 		PlayerHUDWidget->UpdateWeaponSlots(PrimaryWeaponName, SecondaryWeaponName, ActiveSlotNumber);
 	}
 
-	UE_LOG(LogTemp, VeryVerbose, TEXT("WeaponHUD 업데이트: %d/%d"), CurrentAmmo, MagazineSize);
+	UE_LOG(LogFPS, VeryVerbose, TEXT("WeaponHUD 업데이트: %d/%d"), CurrentAmmo, MagazineSize);
 }
 
 void AFPSPlayerCharacter::UpdateCrosshairFiringSpread(float Spread)
@@ -685,25 +653,25 @@ void AFPSPlayerCharacter::OnWeaponDeactivated(AFPSWeapon* Weapon)
 	{
 		// 발사 및 리로드 어빌리티 강제 취소
 		FGameplayTagContainer AbilitiesToCancel;
-		AbilitiesToCancel.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.Fire")));
-		AbilitiesToCancel.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.Reload")));
+		AbilitiesToCancel.AddTag(FPSGameplayTags::Ability_Fire);
+		AbilitiesToCancel.AddTag(FPSGameplayTags::Ability_Reload);
 
 		AbilitySystemComponent->CancelAbilities(&AbilitiesToCancel);
 
-		UE_LOG(LogTemp, Warning, TEXT("OnWeaponDeactivated: 무기 관련 어빌리티들 취소"));
+		UE_LOG(LogFPS, Warning, TEXT("OnWeaponDeactivated: 무기 관련 어빌리티들 취소"));
 	}
 
 	// 기본 애님 인스턴스 클래스로 복원
 	if (DefaultFirstPersonAnimClass && FirstPersonMesh)
 	{
 		FirstPersonMesh->SetAnimInstanceClass(DefaultFirstPersonAnimClass);
-		UE_LOG(LogTemp, Log, TEXT("1인칭 애니메이션을 기본값으로 복원"));
+		UE_LOG(LogFPS, Log, TEXT("1인칭 애니메이션을 기본값으로 복원"));
 	}
 
 	if (DefaultThirdPersonAnimClass && GetMesh())
 	{
 		GetMesh()->SetAnimInstanceClass(DefaultThirdPersonAnimClass);
-		UE_LOG(LogTemp, Log, TEXT("3인칭 애니메이션을 기본값으로 복원"));
+		UE_LOG(LogFPS, Log, TEXT("3인칭 애니메이션을 기본값으로 복원"));
 	}
 
 	// 무기 해제 시 BaseCrosshairSpread를 0으로 초기화
@@ -717,14 +685,14 @@ void AFPSPlayerCharacter::TestAcquireSkill(const FInputActionValue& Value)
 {
 	if (!SkillComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("TestAcquireSkill: SkillComponent가 없습니다."));
+		UE_LOG(LogFPS, Warning, TEXT("TestAcquireSkill: SkillComponent가 없습니다."));
 		return;
 	}
 
 	// 테스트용 스킬 ID (Blueprint DataAsset 생성 후 설정)
-	FGameplayTag TestSkillTag = FGameplayTag::RequestGameplayTag(FName("Skill.Common.MaxHealth"));
+	FGameplayTag TestSkillTag = FPSGameplayTags::Skill_Common_MaxHealth;
 
-	UE_LOG(LogTemp, Log, TEXT("TestAcquireSkill: 스킬 습득 시도 - %s"), *TestSkillTag.ToString());
+	UE_LOG(LogFPS, Log, TEXT("TestAcquireSkill: 스킬 습득 시도 - %s"), *TestSkillTag.ToString());
 
 	// 스킬 습득 시도
 	ESkillAcquireResult Result = SkillComponent->TryAcquireSkill(TestSkillTag);
@@ -733,19 +701,19 @@ void AFPSPlayerCharacter::TestAcquireSkill(const FInputActionValue& Value)
 	switch (Result)
 	{
 	case ESkillAcquireResult::Success:
-		UE_LOG(LogTemp, Log, TEXT("TestAcquireSkill: 스킬 습득 성공!"));
+		UE_LOG(LogFPS, Log, TEXT("TestAcquireSkill: 스킬 습득 성공!"));
 		break;
 	case ESkillAcquireResult::AlreadyAcquired:
-		UE_LOG(LogTemp, Warning, TEXT("TestAcquireSkill: 이미 습득한 스킬입니다."));
+		UE_LOG(LogFPS, Warning, TEXT("TestAcquireSkill: 이미 습득한 스킬입니다."));
 		break;
 	case ESkillAcquireResult::InsufficientPoints:
-		UE_LOG(LogTemp, Warning, TEXT("TestAcquireSkill: 스킬 포인트가 부족합니다."));
+		UE_LOG(LogFPS, Warning, TEXT("TestAcquireSkill: 스킬 포인트가 부족합니다."));
 		break;
 	case ESkillAcquireResult::PrerequisiteNotMet:
-		UE_LOG(LogTemp, Warning, TEXT("TestAcquireSkill: 선행 스킬이 필요합니다."));
+		UE_LOG(LogFPS, Warning, TEXT("TestAcquireSkill: 선행 스킬이 필요합니다."));
 		break;
 	case ESkillAcquireResult::InvalidSkill:
-		UE_LOG(LogTemp, Warning, TEXT("TestAcquireSkill: 유효하지 않은 스킬 ID입니다. SkillDataArray에 해당 스킬을 추가하세요."));
+		UE_LOG(LogFPS, Warning, TEXT("TestAcquireSkill: 유효하지 않은 스킬 ID입니다. SkillDataArray에 해당 스킬을 추가하세요."));
 		break;
 	}
 }
@@ -754,13 +722,13 @@ void AFPSPlayerCharacter::UseActiveSkill(const FInputActionValue& Value)
 {
 	if (!AbilitySystemComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseActiveSkill: AbilitySystemComponent가 없음"));
+		UE_LOG(LogFPS, Warning, TEXT("UseActiveSkill: AbilitySystemComponent가 없음"));
 		return;
 	}
 
 	// 현재 부여된 Ability 목록 출력 (디버깅)
 	TArray<FGameplayAbilitySpec>& ActivatableAbilities = AbilitySystemComponent->GetActivatableAbilities();
-	UE_LOG(LogTemp, Log, TEXT("=== 현재 부여된 Ability 목록 (%d개) ==="), ActivatableAbilities.Num());
+	UE_LOG(LogFPS, Log, TEXT("=== 현재 부여된 Ability 목록 (%d개) ==="), ActivatableAbilities.Num());
 	for (const FGameplayAbilitySpec& Spec : ActivatableAbilities)
 	{
 		if (Spec.Ability)
@@ -768,25 +736,25 @@ void AFPSPlayerCharacter::UseActiveSkill(const FInputActionValue& Value)
 			// GetAssetTags()로 태그 가져오기
 			const FGameplayTagContainer& SpecAbilityTags = Spec.Ability->GetAssetTags();
 			FString TagsString = SpecAbilityTags.ToStringSimple();
-			UE_LOG(LogTemp, Log, TEXT("  - %s (Tags: %s)"), *Spec.Ability->GetName(), *TagsString);
+			UE_LOG(LogFPS, Log, TEXT("  - %s (Tags: %s)"), *Spec.Ability->GetName(), *TagsString);
 		}
 	}
 
 	// SkillComponent에서 습득한 액티브 스킬 태그 가져오기
 	if (!SkillComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseActiveSkill: SkillComponent가 없음"));
+		UE_LOG(LogFPS, Warning, TEXT("UseActiveSkill: SkillComponent가 없음"));
 		return;
 	}
 
 	FGameplayTag ActiveSkillTag = SkillComponent->GetActiveSkillAbilityTag();
 	if (!ActiveSkillTag.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseActiveSkill: 습득한 액티브 스킬이 없음"));
+		UE_LOG(LogFPS, Warning, TEXT("UseActiveSkill: 습득한 액티브 스킬이 없음"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("찾으려는 태그: %s"), *ActiveSkillTag.ToString());
+	UE_LOG(LogFPS, Log, TEXT("찾으려는 태그: %s"), *ActiveSkillTag.ToString());
 
 	// 액티브 스킬 활성화
 	FGameplayTagContainer AbilityTags;
@@ -795,11 +763,11 @@ void AFPSPlayerCharacter::UseActiveSkill(const FInputActionValue& Value)
 	bool bActivated = AbilitySystemComponent->TryActivateAbilitiesByTag(AbilityTags);
 	if (!bActivated)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseActiveSkill: 액티브 스킬이 없거나 사용할 수 없음 (쿨다운 중?)"));
+		UE_LOG(LogFPS, Warning, TEXT("UseActiveSkill: 액티브 스킬이 없거나 사용할 수 없음 (쿨다운 중?)"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("UseActiveSkill: 액티브 스킬 활성화 성공!"));
+		UE_LOG(LogFPS, Log, TEXT("UseActiveSkill: 액티브 스킬 활성화 성공!"));
 	}
 }
 
@@ -822,20 +790,20 @@ void AFPSPlayerCharacter::ToggleSkillTree(const FInputActionValue& Value)
 		PC->SetShowMouseCursor(false);
 		PC->SetInputMode(FInputModeGameOnly());
 
-		UE_LOG(LogTemp, Log, TEXT("SkillTree UI 닫기"));
+		UE_LOG(LogFPS, Log, TEXT("SkillTree UI 닫기"));
 		return;
 	}
 
 	// 스킬트리 UI 열기
 	if (!SkillComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ToggleSkillTree: SkillComponent가 없습니다."));
+		UE_LOG(LogFPS, Warning, TEXT("ToggleSkillTree: SkillComponent가 없습니다."));
 		return;
 	}
 
 	if (!SkillTreeWidgetClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ToggleSkillTree: SkillTreeWidgetClass가 설정되지 않았습니다."));
+		UE_LOG(LogFPS, Warning, TEXT("ToggleSkillTree: SkillTreeWidgetClass가 설정되지 않았습니다."));
 		return;
 	}
 
@@ -861,7 +829,7 @@ void AFPSPlayerCharacter::ToggleSkillTree(const FInputActionValue& Value)
 		InputMode.SetWidgetToFocus(SkillTreeWidget->TakeWidget());
 		PC->SetInputMode(InputMode);
 
-		UE_LOG(LogTemp, Log, TEXT("SkillTree UI 열기"));
+		UE_LOG(LogFPS, Log, TEXT("SkillTree UI 열기"));
 	}
 }
 
@@ -884,20 +852,20 @@ void AFPSPlayerCharacter::ToggleInventory(const FInputActionValue& Value)
 		PC->SetShowMouseCursor(false);
 		PC->SetInputMode(FInputModeGameOnly());
 
-		UE_LOG(LogTemp, Log, TEXT("Inventory UI 닫기"));
+		UE_LOG(LogFPS, Log, TEXT("Inventory UI 닫기"));
 		return;
 	}
 
 	// 인벤토리 UI 열기
 	if (!InventoryComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ToggleInventory: InventoryComponent가 없습니다."));
+		UE_LOG(LogFPS, Warning, TEXT("ToggleInventory: InventoryComponent가 없습니다."));
 		return;
 	}
 
 	if (!InventoryWidgetClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ToggleInventory: InventoryWidgetClass가 설정되지 않았습니다."));
+		UE_LOG(LogFPS, Warning, TEXT("ToggleInventory: InventoryWidgetClass가 설정되지 않았습니다."));
 		return;
 	}
 
@@ -917,6 +885,6 @@ void AFPSPlayerCharacter::ToggleInventory(const FInputActionValue& Value)
 		InputMode.SetWidgetToFocus(InventoryWidget->TakeWidget());
 		PC->SetInputMode(InputMode);
 
-		UE_LOG(LogTemp, Log, TEXT("Inventory UI 열기"));
+		UE_LOG(LogFPS, Log, TEXT("Inventory UI 열기"));
 	}
 }
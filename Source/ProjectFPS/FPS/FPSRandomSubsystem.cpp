@@ -0,0 +1,275 @@
+// FPSRandomSubsystem.cpp
+
+#include "FPSRandomSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// ========================================
+// FFPSRandomStream
+// ========================================
+
+FFPSRandomStream::FFPSRandomStream(int32 InSeed, int32 InBatchSize)
+	: Stream(InSeed)
+	, Seed(InSeed)
+	, BatchSize(FMath::Max(InBatchSize, 1))
+{
+}
+
+void FFPSRandomStream::RefillBatch()
+{
+	Batch.SetNumUninitialized(BatchSize, EAllowShrinking::No);
+	Cursor = 0;
+
+	int32 NumFilled = 0;
+
+	// 재생 값 우선 사용
+	if (ReplayCursor < ReplayValues.Num())
+	{
+		NumFilled = FMath::Min(BatchSize, ReplayValues.Num() - ReplayCursor);
+		FMemory::Memcpy(Batch.GetData(), ReplayValues.GetData() + ReplayCursor, NumFilled * sizeof(float));
+		ReplayCursor += NumFilled;
+
+		if (ReplayCursor == ReplayValues.Num())
+		{
+			UE_LOG(LogFPS, Warning, TEXT("난수 재생 값 소진 - 이후 시드 기반 생성 (시드: %d)"), Seed);
+		}
+	}
+
+	for (int32 Index = NumFilled; Index < BatchSize; ++Index)
+	{
+		Batch[Index] = Stream.GetFraction();
+	}
+}
+
+FVector FFPSRandomStream::VRandCone(const FVector& Dir, float ConeHalfAngleRad)
+{
+	// FRandomStream::VRandCone과 같은 분포 (난수는 FRand 경로로 소비)
+	if (ConeHalfAngleRad <= 0.0f)
+	{
+		return Dir.GetSafeNormal();
+	}
+
+	const float RandU = FRand();
+	const float RandV = FRand();
+
+	const float Theta = 2.0f * UE_PI * RandU;
+	const float Phi = FMath::Fmod(FMath::Acos((2.0f * RandV) - 1.0f), ConeHalfAngleRad);
+
+	const FMatrix DirMat = FRotationMatrix(Dir.Rotation());
+	const FVector DirZ = DirMat.GetScaledAxis(EAxis::X);
+	const FVector DirY = DirMat.GetScaledAxis(EAxis::Y);
+
+	FVector Result = Dir.RotateAngleAxis(FMath::RadiansToDegrees(Phi), DirY);
+	Result = Result.RotateAngleAxis(FMath::RadiansToDegrees(Theta), DirZ);
+
+	return Result.GetSafeNormal();
+}
+
+void FFPSRandomStream::FillFRand(TArrayView<float> OutValues)
+{
+	int32 NumWritten = 0;
+	while (NumWritten < OutValues.Num())
+	{
+		if (Cursor >= Batch.Num())
+		{
+			RefillBatch();
+		}
+
+		// 배치에서 한 번에 복사
+		const int32 NumCopy = FMath::Min(OutValues.Num() - NumWritten, Batch.Num() - Cursor);
+		FMemory::Memcpy(OutValues.GetData() + NumWritten, Batch.GetData() + Cursor, NumCopy * sizeof(float));
+
+		if (bRecording)
+		{
+			RecordedValues.Append(Batch.GetData() + Cursor, NumCopy);
+		}
+
+		Cursor += NumCopy;
+		NumWritten += NumCopy;
+	}
+}
+
+// ========================================
+// UFPSRandomSubsystem
+// ========================================
+
+void UFPSRandomSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 매치 시드: 명령줄 > Config > 현재 시간
+	MatchSeed = ConfigMatchSeed;
+	FParse::Value(FCommandLine::Get(), TEXT("FPSRandomSeed="), MatchSeed);
+	if (MatchSeed == 0)
+	{
+		MatchSeed = static_cast<int32>(FPlatformTime::Cycles());
+	}
+
+	// 기록/재생 모드
+	FString FileName;
+	if (FParse::Value(FCommandLine::Get(), TEXT("FPSRandomReplay="), FileName))
+	{
+		RecordingPath = GetRecordingPath(FileName);
+		if (LoadRecording(RecordingPath))
+		{
+			Mode = EFPSRandomMode::Replay;
+		}
+		else
+		{
+			UE_LOG(LogFPS, Error, TEXT("난수 재생 파일 로드 실패: %s"), *RecordingPath);
+		}
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("FPSRandomRecord="), FileName))
+	{
+		RecordingPath = GetRecordingPath(FileName);
+		Mode = EFPSRandomMode::Record;
+	}
+
+	UE_LOG(LogFPS, Log, TEXT("난수 서비스 초기화 - 매치 시드: %d, 모드: %s"),
+		MatchSeed, *UEnum::GetValueAsString(Mode));
+}
+
+void UFPSRandomSubsystem::Deinitialize()
+{
+	if (Mode == EFPSRandomMode::Record)
+	{
+		if (SaveRecording(RecordingPath))
+		{
+			UE_LOG(LogFPS, Log, TEXT("난수 기록 저장: %s"), *RecordingPath);
+		}
+		else
+		{
+			UE_LOG(LogFPS, Error, TEXT("난수 기록 저장 실패: %s"), *RecordingPath);
+		}
+	}
+
+	Streams.Empty();
+	PendingReplayValues.Empty();
+	ReleasedRecordings.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSRandomSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FFPSRandomStream& UFPSRandomSubsystem::GetStream(FName Purpose, const UObject* Owner)
+{
+	const FString StreamName = MakeStreamName(Purpose, Owner);
+
+	if (TUniquePtr<FFPSRandomStream>* Existing = Streams.Find(StreamName))
+	{
+		return **Existing;
+	}
+
+	// 이름 해시 기반 시드 (포인터/FName 인덱스는 실행마다 달라지므로 사용하지 않음)
+	const int32 StreamSeed = static_cast<int32>(HashCombine(static_cast<uint32>(MatchSeed), FCrc::StrCrc32(*StreamName)));
+
+	TUniquePtr<FFPSRandomStream>& NewStream = Streams.Add(StreamName, MakeUnique<FFPSRandomStream>(StreamSeed, BatchSize));
+	NewStream->bRecording = (Mode == EFPSRandomMode::Record);
+
+	if (Mode == EFPSRandomMode::Replay)
+	{
+		if (TArray<float>* ReplayValues = PendingReplayValues.Find(StreamName))
+		{
+			NewStream->ReplayValues = MoveTemp(*ReplayValues);
+			PendingReplayValues.Remove(StreamName);
+		}
+	}
+
+	return *NewStream;
+}
+
+void UFPSRandomSubsystem::ReleaseStreams(const UObject* Owner)
+{
+	if (!Owner)
+	{
+		return;
+	}
+
+	const FString Suffix = FString::Printf(TEXT("/%s"), *Owner->GetName());
+
+	for (auto It = Streams.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().EndsWith(Suffix))
+		{
+			continue;
+		}
+
+		// 기록은 저장 시까지 보관 (같은 이름이 다시 발급되면 이어서 기록)
+		if (Mode == EFPSRandomMode::Record && It.Value()->RecordedValues.Num() > 0)
+		{
+			ReleasedRecordings.FindOrAdd(It.Key()).Append(It.Value()->RecordedValues);
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+FFPSRandomStream& UFPSRandomSubsystem::GetStreamFor(const UObject* Owner, FName Purpose)
+{
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	if (UFPSRandomSubsystem* RandomSubsystem = World ? World->GetSubsystem<UFPSRandomSubsystem>() : nullptr)
+	{
+		return RandomSubsystem->GetStream(Purpose, Owner);
+	}
+
+	// 에디터 프리뷰 등 서브시스템이 없는 월드
+	static FFPSRandomStream FallbackStream(FMath::Rand(), 64);
+	return FallbackStream;
+}
+
+FString UFPSRandomSubsystem::MakeStreamName(FName Purpose, const UObject* Owner)
+{
+	return Owner ? FString::Printf(TEXT("%s/%s"), *Purpose.ToString(), *Owner->GetName()) : Purpose.ToString();
+}
+
+FString UFPSRandomSubsystem::GetRecordingPath(const FString& FileName)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Random"), FileName);
+}
+
+bool UFPSRandomSubsystem::LoadRecording(const FString& FilePath)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	Reader << MatchSeed;
+	Reader << PendingReplayValues;
+
+	return !Reader.IsError();
+}
+
+bool UFPSRandomSubsystem::SaveRecording(const FString& FilePath) const
+{
+	// 해제된 스트림 기록 + 살아 있는 스트림 기록
+	TMap<FString, TArray<float>> AllRecordings = ReleasedRecordings;
+	for (const TPair<FString, TUniquePtr<FFPSRandomStream>>& Pair : Streams)
+	{
+		if (Pair.Value->RecordedValues.Num() > 0)
+		{
+			AllRecordings.FindOrAdd(Pair.Key).Append(Pair.Value->RecordedValues);
+		}
+	}
+
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+
+	int32 SavedSeed = MatchSeed;
+	Writer << SavedSeed;
+	Writer << AllRecordings;
+
+	return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
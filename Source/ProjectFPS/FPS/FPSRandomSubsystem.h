@@ -0,0 +1,189 @@
+// FPSRandomSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Math/RandomStream.h"
+#include "FPSRandomSubsystem.generated.h"
+
+/**
+ * 용도별 난수 스트림 이름
+ */
+namespace FPSRandomStreams
+{
+	/** 크리티컬 판정 */
+	static const FName Crit(TEXT("Crit"));
+
+	/** 조준 분산 */
+	static const FName Spread(TEXT("Spread"));
+
+	/** 아이템 드롭 */
+	static const FName Drop(TEXT("Drop"));
+
+	/** AI 조준 오차 */
+	static const FName AIAim(TEXT("AIAim"));
+}
+
+/**
+ * 난수 기록/재생 모드
+ */
+UENUM()
+enum class EFPSRandomMode : uint8
+{
+	Live,    // 시드 기반 생성만
+	Record,  // 생성한 값을 스트림별로 기록 (월드 종료 시 파일 저장)
+	Replay   // 기록 파일의 값을 순서대로 반환 (소진 시 시드 기반 생성으로 대체)
+};
+
+/**
+ * 결정적 난수 스트림
+ * - FRandomStream 위에서 값을 BatchSize개씩 미리 생성해 두고 순서대로 소비
+ * - 모든 파생 값(범위/정수/원뿔 방향)은 FRand 한 경로를 거치므로 기록/재생이 그대로 적용됨
+ * - 게임 스레드 전용
+ */
+class PROJECTFPS_API FFPSRandomStream
+{
+public:
+	FFPSRandomStream() = default;
+	FFPSRandomStream(int32 InSeed, int32 InBatchSize);
+
+	/** [0, 1) 균등 분포 */
+	float FRand()
+	{
+		if (Cursor >= Batch.Num())
+		{
+			RefillBatch();
+		}
+
+		const float Value = Batch[Cursor++];
+		if (bRecording)
+		{
+			RecordedValues.Add(Value);
+		}
+		return Value;
+	}
+
+	/** [Min, Max) 균등 분포 */
+	float FRandRange(float Min, float Max)
+	{
+		return Min + (Max - Min) * FRand();
+	}
+
+	/** [Min, Max] 정수 균등 분포 */
+	int32 RandRange(int32 Min, int32 Max)
+	{
+		const int32 Range = (Max - Min) + 1;
+		return Min + (Range > 0 ? FMath::Min(FMath::TruncToInt(FRand() * Range), Range - 1) : 0);
+	}
+
+	/** Dir 중심, 반각 ConeHalfAngleRad 원뿔 안의 단위 벡터 */
+	FVector VRandCone(const FVector& Dir, float ConeHalfAngleRad);
+
+	/** [0, 1) 값을 한 번에 여러 개 생성 (발사 경로 등 연속 소비용) */
+	void FillFRand(TArrayView<float> OutValues);
+
+	/** 생성 시드 */
+	int32 GetSeed() const { return Seed; }
+
+private:
+	friend class UFPSRandomSubsystem;
+
+	/** 다음 배치 채우기 (재생 중이면 기록된 값 우선) */
+	void RefillBatch();
+
+	FRandomStream Stream;
+	int32 Seed = 0;
+	int32 BatchSize = 64;
+
+	/** 미리 생성한 값 / 다음 소비 위치 */
+	TArray<float> Batch;
+	int32 Cursor = 0;
+
+	/** 소비한 값 기록 (Record 모드) */
+	bool bRecording = false;
+	TArray<float> RecordedValues;
+
+	/** 재생할 값 / 다음 재생 위치 (Replay 모드) */
+	TArray<float> ReplayValues;
+	int32 ReplayCursor = 0;
+};
+
+/**
+ * 게임플레이 난수 서비스 (월드 단위)
+ * - 용도(Purpose) + 소유자별로 독립된 FFPSRandomStream 발급
+ * - 각 스트림 시드 = 매치 시드 + 용도 이름 + 소유자 이름 해시 (실행마다 같은 순서로 스폰되면 같은 값)
+ * - 전역 FMath::FRand 대신 사용해 벤치마크/소크 테스트를 실행 간에 재현 가능하게 함
+ * - 매치 시드: 명령줄 -FPSRandomSeed=N > Config MatchSeed > 0이면 현재 시간
+ * - 기록/재생: 명령줄 -FPSRandomRecord=파일 / -FPSRandomReplay=파일 (Saved/Random/ 기준)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSRandomSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UWorldSubsystem
+	// ========================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** 용도 + 소유자 스트림 (없으면 생성, 포인터는 ReleaseStreams/월드 종료 전까지 유효) */
+	FFPSRandomStream& GetStream(FName Purpose, const UObject* Owner = nullptr);
+
+	/** 소유자 스트림 해제 (소유자 EndPlay 시) */
+	void ReleaseStreams(const UObject* Owner);
+
+	/** 편의 함수: 월드 서브시스템 스트림 (월드가 없으면 시드 없는 공용 스트림) */
+	static FFPSRandomStream& GetStreamFor(const UObject* Owner, FName Purpose);
+
+	/** 현재 매치 시드 */
+	int32 GetMatchSeed() const { return MatchSeed; }
+
+	/** 현재 모드 */
+	EFPSRandomMode GetMode() const { return Mode; }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 고정 매치 시드 (0이면 실행마다 다름) */
+	UPROPERTY(Config, EditAnywhere, Category = "Random")
+	int32 ConfigMatchSeed = 0;
+
+	/** 스트림별 미리 생성할 값 개수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Random", meta = (ClampMin = 1))
+	int32 BatchSize = 64;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 스트림 키 이름 ("Purpose/OwnerName", 기록 파일 키로도 사용) */
+	static FString MakeStreamName(FName Purpose, const UObject* Owner);
+
+	/** 기록 파일 경로 */
+	static FString GetRecordingPath(const FString& FileName);
+
+	/** 기록 파일 로드/저장 */
+	bool LoadRecording(const FString& FilePath);
+	bool SaveRecording(const FString& FilePath) const;
+
+	/** 발급된 스트림 (스트림 이름 -> 스트림) */
+	TMap<FString, TUniquePtr<FFPSRandomStream>> Streams;
+
+	/** 재생 파일에서 읽은 값 (스트림 생성 시 해당 스트림으로 이동) */
+	TMap<FString, TArray<float>> PendingReplayValues;
+
+	/** 해제된 스트림의 기록 (저장 시 살아 있는 스트림 기록과 합침) */
+	TMap<FString, TArray<float>> ReleasedRecordings;
+
+	/** 기록 파일 경로 (Record/Replay) */
+	FString RecordingPath;
+
+	int32 MatchSeed = 0;
+	EFPSRandomMode Mode = EFPSRandomMode::Live;
+};
@@ -0,0 +1,270 @@
+// FPSSpatialHashSubsystem.cpp
+
+#include "FPSSpatialHashSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void UFPSSpatialHashSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSSpatialHashSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSSpatialHashSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSSpatialHashSubsystem, STATGROUP_Tickables);
+}
+
+UFPSSpatialHashSubsystem* UFPSSpatialHashSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFPSSpatialHashSubsystem>() : nullptr;
+}
+
+FIntPoint UFPSSpatialHashSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize)
+	);
+}
+
+void UFPSSpatialHashSubsystem::Register(AActor* Actor, EFPSSpatialCategory Categories)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (const int32* ExistingIndex = EntryIndices.Find(Actor))
+	{
+		Entries[*ExistingIndex].Categories |= Categories;
+		return;
+	}
+
+	FEntry Entry;
+	Entry.Actor = Actor;
+	Entry.Key = Actor;
+	Entry.Location = Actor->GetActorLocation();
+	Entry.Cell = GetCell(Entry.Location);
+	Entry.Categories = Categories;
+
+	const int32 EntryIndex = Entries.Add(Entry);
+	EntryIndices.Add(Actor, EntryIndex);
+	Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+}
+
+void UFPSSpatialHashSubsystem::Unregister(AActor* Actor)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryIndices.RemoveAndCopyValue(Actor, EntryIndex))
+	{
+		return;
+	}
+
+	RemoveFromCell(Entries[EntryIndex].Cell, EntryIndex);
+	Entries.RemoveAt(EntryIndex);
+}
+
+void UFPSSpatialHashSubsystem::RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	if (TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+	}
+}
+
+void UFPSSpatialHashSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 위치 갱신, 셀이 바뀐 항목만 이동 (EndPlay 없이 사라진 액터는 여기서 정리)
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FEntry& Entry = *It;
+		const AActor* Actor = Entry.Actor.Get();
+		if (!Actor)
+		{
+			RemoveFromCell(Entry.Cell, It.GetIndex());
+			EntryIndices.Remove(Entry.Key);
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Entry.Location = Actor->GetActorLocation();
+
+		const FIntPoint NewCell = GetCell(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Entry.Cell, It.GetIndex());
+			Cells.FindOrAdd(NewCell).Add(It.GetIndex());
+			Entry.Cell = NewCell;
+		}
+	}
+}
+
+void UFPSSpatialHashSubsystem::GatherCell(const FIntPoint& Cell, const FVector& Center, float RadiusSq, EFPSSpatialCategory Categories,
+	TArray<FFPSSpatialQueryResult>& OutResults, TFunctionRef<bool(const AActor*)> Filter) const
+{
+	const TArray<int32>* CellEntries = Cells.Find(Cell);
+	if (!CellEntries)
+	{
+		return;
+	}
+
+	for (const int32 EntryIndex : *CellEntries)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (!EnumHasAnyFlags(Entry.Categories, Categories))
+		{
+			continue;
+		}
+
+		const float DistanceSq = static_cast<float>(FVector::DistSquared(Center, Entry.Location));
+		if (DistanceSq > RadiusSq)
+		{
+			continue;
+		}
+
+		AActor* Actor = Entry.Actor.Get();
+		if (Actor && Filter(Actor))
+		{
+			OutResults.Add({ Actor, DistanceSq });
+		}
+	}
+}
+
+void UFPSSpatialHashSubsystem::QueryRadius(const FVector& Center, float Radius, EFPSSpatialCategory Categories,
+	TArray<FFPSSpatialQueryResult>& OutResults, TFunctionRef<bool(const AActor*)> Filter) const
+{
+	OutResults.Reset();
+
+	const FIntPoint MinCell = GetCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = GetCell(Center + FVector(Radius));
+	const float RadiusSq = FMath::Square(Radius);
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			GatherCell(FIntPoint(CellX, CellY), Center, RadiusSq, Categories, OutResults, Filter);
+		}
+	}
+}
+
+void UFPSSpatialHashSubsystem::QueryRadius(const FVector& Center, float Radius, EFPSSpatialCategory Categories,
+	TArray<FFPSSpatialQueryResult>& OutResults) const
+{
+	QueryRadius(Center, Radius, Categories, OutResults, [](const AActor*) { return true; });
+}
+
+void UFPSSpatialHashSubsystem::QueryNearest(const FVector& Center, int32 K, float MaxRadius, EFPSSpatialCategory Categories,
+	TArray<FFPSSpatialQueryResult>& OutResults, TFunctionRef<bool(const AActor*)> Filter) const
+{
+	OutResults.Reset();
+	if (K <= 0)
+	{
+		return;
+	}
+
+	const FIntPoint CenterCell = GetCell(Center);
+	const float RadiusSq = FMath::Square(MaxRadius);
+	const int32 MaxRing = FMath::CeilToInt32(MaxRadius / CellSize);
+
+	auto ByDistance = [](const FFPSSpatialQueryResult& A, const FFPSSpatialQueryResult& B)
+	{
+		return A.DistanceSq < B.DistanceSq;
+	};
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// 고리 Ring의 셀 (중심 셀에서 체비쇼프 거리가 Ring인 셀)
+		for (int32 OffsetY = -Ring; OffsetY <= Ring; ++OffsetY)
+		{
+			const bool bEdgeRow = FMath::Abs(OffsetY) == Ring;
+			const int32 StepX = bEdgeRow ? 1 : FMath::Max(1, 2 * Ring);
+			for (int32 OffsetX = -Ring; OffsetX <= Ring; OffsetX += StepX)
+			{
+				GatherCell(CenterCell + FIntPoint(OffsetX, OffsetY), Center, RadiusSq, Categories, OutResults, Filter);
+			}
+		}
+
+		// 다음 고리의 모든 점은 중심에서 최소 Ring * CellSize 떨어져 있으므로 K번째보다 멀면 중단
+		if (OutResults.Num() >= K)
+		{
+			OutResults.Sort(ByDistance);
+			OutResults.SetNum(K, EAllowShrinking::No);
+			if (OutResults.Last().DistanceSq <= FMath::Square(Ring * CellSize))
+			{
+				return;
+			}
+		}
+	}
+
+	OutResults.Sort(ByDistance);
+	if (OutResults.Num() > K)
+	{
+		OutResults.SetNum(K, EAllowShrinking::No);
+	}
+}
+
+AActor* UFPSSpatialHashSubsystem::FindNearest(const FVector& Center, float MaxRadius, EFPSSpatialCategory Categories,
+	TFunctionRef<bool(const AActor*)> Filter) const
+{
+	const FIntPoint CenterCell = GetCell(Center);
+	const float RadiusSq = FMath::Square(MaxRadius);
+	const int32 MaxRing = FMath::CeilToInt32(MaxRadius / CellSize);
+
+	// 결과 배열 없이 가장 가까운 것만 추적
+	AActor* Nearest = nullptr;
+	float NearestDistanceSq = UE_BIG_NUMBER;
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		for (int32 OffsetY = -Ring; OffsetY <= Ring; ++OffsetY)
+		{
+			const bool bEdgeRow = FMath::Abs(OffsetY) == Ring;
+			const int32 StepX = bEdgeRow ? 1 : FMath::Max(1, 2 * Ring);
+			for (int32 OffsetX = -Ring; OffsetX <= Ring; OffsetX += StepX)
+			{
+				const TArray<int32>* CellEntries = Cells.Find(CenterCell + FIntPoint(OffsetX, OffsetY));
+				if (!CellEntries)
+				{
+					continue;
+				}
+
+				for (const int32 EntryIndex : *CellEntries)
+				{
+					const FEntry& Entry = Entries[EntryIndex];
+					const float DistanceSq = static_cast<float>(FVector::DistSquared(Center, Entry.Location));
+					if (DistanceSq > RadiusSq || DistanceSq >= NearestDistanceSq || !EnumHasAnyFlags(Entry.Categories, Categories))
+					{
+						continue;
+					}
+
+					AActor* Actor = Entry.Actor.Get();
+					if (Actor && Filter(Actor))
+					{
+						Nearest = Actor;
+						NearestDistanceSq = DistanceSq;
+					}
+				}
+			}
+		}
+
+		if (Nearest && NearestDistanceSq <= FMath::Square(Ring * CellSize))
+		{
+			break;
+		}
+	}
+
+	return Nearest;
+}
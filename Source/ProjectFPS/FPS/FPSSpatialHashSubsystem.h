@@ -0,0 +1,128 @@
+// FPSSpatialHashSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FPSSpatialHashSubsystem.generated.h"
+
+/**
+ * 공간 해시 등록 분류 (쿼리 필터, 여러 개 조합 가능)
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EFPSSpatialCategory : uint8
+{
+	None       = 0,
+	Pawn       = 1 << 0,  // 캐릭터 (플레이어/적)
+	Pickupable = 1 << 1   // IPickupable (드롭 아이템/무기)
+};
+ENUM_CLASS_FLAGS(EFPSSpatialCategory);
+
+/**
+ * 공간 쿼리 결과
+ */
+struct FFPSSpatialQueryResult
+{
+	AActor* Actor = nullptr;
+	float DistanceSq = 0.0f;
+};
+
+/**
+ * 균등 격자 공간 해시 (월드 단위)
+ * - 폰/픽업 가능 액터를 XY 격자 셀에 등록, 반경/최근접 K개 쿼리를 물리 씬 오버랩 없이 처리
+ * - Tick에서 등록된 액터 위치를 읽어 셀이 바뀐 항목만 옮김 (같은 셀 안 이동은 위치만 갱신)
+ * - 쿼리는 마지막 Tick 기준 위치를 사용 (최대 1프레임 지연), 거리는 3D로 판정
+ * - 폰은 BeginPlay/EndPlay, 픽업 가능 액터는 드롭될 때만 등록 (장착된 무기는 위치 갱신 대상에서 제외)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSSpatialHashSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSSpatialHashSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 월드 컨텍스트의 공간 해시 (없으면 nullptr) */
+	static UFPSSpatialHashSubsystem* Get(const UObject* WorldContext);
+
+	// ========================================
+	// Registration
+	// ========================================
+
+	/** 액터 등록 (이미 등록되어 있으면 분류만 추가) */
+	void Register(AActor* Actor, EFPSSpatialCategory Categories);
+
+	/** 액터 해제 */
+	void Unregister(AActor* Actor);
+
+	/** 등록된 액터 수 */
+	int32 GetEntryCount() const { return EntryIndices.Num(); }
+
+	// ========================================
+	// Queries
+	// ========================================
+
+	/** 반경 안의 액터 (순서 없음, Filter가 false인 액터 제외) */
+	void QueryRadius(const FVector& Center, float Radius, EFPSSpatialCategory Categories,
+		TArray<FFPSSpatialQueryResult>& OutResults, TFunctionRef<bool(const AActor*)> Filter) const;
+
+	void QueryRadius(const FVector& Center, float Radius, EFPSSpatialCategory Categories,
+		TArray<FFPSSpatialQueryResult>& OutResults) const;
+
+	/** 반경 안에서 가까운 순으로 최대 K개 (가까운 셀부터 고리 단위로 확장, K개를 찾으면 더 먼 고리는 생략) */
+	void QueryNearest(const FVector& Center, int32 K, float MaxRadius, EFPSSpatialCategory Categories,
+		TArray<FFPSSpatialQueryResult>& OutResults, TFunctionRef<bool(const AActor*)> Filter) const;
+
+	/** 반경 안에서 가장 가까운 액터 (없으면 nullptr) */
+	AActor* FindNearest(const FVector& Center, float MaxRadius, EFPSSpatialCategory Categories,
+		TFunctionRef<bool(const AActor*)> Filter) const;
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 셀 크기 (쿼리 반경과 비슷하게 두면 반경 쿼리가 3x3 셀 안에서 끝남) */
+	UPROPERTY(Config, EditAnywhere, Category = "Spatial Hash", meta = (ClampMin = 50.0))
+	float CellSize = 500.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 등록 항목 */
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		EFPSSpatialCategory Categories = EFPSSpatialCategory::None;
+	};
+
+	/** 위치 -> 셀 좌표 */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** 셀 목록에서 항목 제거 (빈 셀은 남겨 두어 셀 이동마다 배열을 다시 할당하지 않음) */
+	void RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex);
+
+	/** 셀 하나의 항목 중 조건에 맞는 것을 결과에 추가 */
+	void GatherCell(const FIntPoint& Cell, const FVector& Center, float RadiusSq, EFPSSpatialCategory Categories,
+		TArray<FFPSSpatialQueryResult>& OutResults, TFunctionRef<bool(const AActor*)> Filter) const;
+
+	/** 등록 항목 (인덱스 고정) */
+	TSparseArray<FEntry> Entries;
+
+	/** 액터 -> 항목 인덱스 */
+	TMap<TObjectKey<AActor>, int32> EntryIndices;
+
+	/** 셀 -> 항목 인덱스 */
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
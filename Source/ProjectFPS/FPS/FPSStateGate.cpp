@@ -0,0 +1,92 @@
+// FPSStateGate.cpp
+
+#include "FPSStateGate.h"
+#include "FPSGameplayTags.h"
+#include "AbilitySystemComponent.h"
+
+namespace FPSStateGate
+{
+	namespace
+	{
+		/** 행동별 차단 상태 테이블 (새 규칙은 여기에 한 줄 추가) */
+		struct FGateRule
+		{
+			EFPSGatedAction Action;
+			const FNativeGameplayTag& BlockingState;
+		};
+
+		const FGateRule GateRules[] =
+		{
+			// 리로드 중에는 발사 불가
+			{ EFPSGatedAction::Fire,   FPSGameplayTags::State_Reloading },
+
+			// 리로드 중 재시도 불가
+			{ EFPSGatedAction::Reload, FPSGameplayTags::State_Reloading },
+
+			// Sprint: 현재 막는 상태 없음
+		};
+
+		/** 테이블을 행동별 태그 컨테이너로 변환 (최초 조회 시 한 번) */
+		const TArray<FGameplayTagContainer>& GetBlockingTagTable()
+		{
+			static const TArray<FGameplayTagContainer> Table = []()
+			{
+				TArray<FGameplayTagContainer> Result;
+				Result.SetNum(static_cast<int32>(EFPSGatedAction::Count));
+
+				for (const FGateRule& Rule : GateRules)
+				{
+					Result[static_cast<int32>(Rule.Action)].AddTag(Rule.BlockingState);
+				}
+
+				return Result;
+			}();
+
+			return Table;
+		}
+	}
+
+	const FGameplayTagContainer& GetBlockingTags(EFPSGatedAction Action)
+	{
+		return GetBlockingTagTable()[static_cast<int32>(Action)];
+	}
+
+	bool IsBlocked(const UAbilitySystemComponent* ASC, EFPSGatedAction Action, FGameplayTag* OutBlockingTag)
+	{
+		if (!ASC)
+		{
+			return false;
+		}
+
+		const FGameplayTagContainer& BlockingTags = GetBlockingTags(Action);
+		if (BlockingTags.IsEmpty() || !ASC->HasAnyMatchingGameplayTags(BlockingTags))
+		{
+			return false;
+		}
+
+		if (OutBlockingTag)
+		{
+			for (const FGameplayTag& Tag : BlockingTags)
+			{
+				if (ASC->HasMatchingGameplayTag(Tag))
+				{
+					*OutBlockingTag = Tag;
+					break;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	const TCHAR* GetActionName(EFPSGatedAction Action)
+	{
+		switch (Action)
+		{
+		case EFPSGatedAction::Fire:   return TEXT("Fire");
+		case EFPSGatedAction::Reload: return TEXT("Reload");
+		case EFPSGatedAction::Sprint: return TEXT("Sprint");
+		default:                      return TEXT("Unknown");
+		}
+	}
+}
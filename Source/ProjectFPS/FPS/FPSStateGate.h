@@ -0,0 +1,38 @@
+// FPSStateGate.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * 상태 게이트로 막을 수 있는 행동
+ */
+enum class EFPSGatedAction : uint8
+{
+	Fire,
+	Reload,
+	Sprint,
+
+	Count
+};
+
+/**
+ * 상태 게이트
+ * - 어빌리티는 활성 중 State.* 태그를 ActivationOwnedTags로 부여 (ex.리로드 중 State.Reloading)
+ * - 행동별로 막는 상태 태그는 FPSStateGate.cpp의 테이블에 선언
+ * - 판정은 ASC 태그 카운트 조회이므로 부여된 어빌리티 수와 무관
+ */
+namespace FPSStateGate
+{
+	/** 행동을 막는 상태 태그 목록 */
+	PROJECTFPS_API const FGameplayTagContainer& GetBlockingTags(EFPSGatedAction Action);
+
+	/** 행동이 막혀 있는지 (OutBlockingTag: 막고 있는 첫 번째 상태 태그) */
+	PROJECTFPS_API bool IsBlocked(const UAbilitySystemComponent* ASC, EFPSGatedAction Action, FGameplayTag* OutBlockingTag = nullptr);
+
+	/** 로그용 행동 이름 */
+	PROJECTFPS_API const TCHAR* GetActionName(EFPSGatedAction Action);
+}
@@ -1,10 +1,12 @@
 // GameplayAbility_Berserker.cpp
 
 #include "GameplayAbility_Berserker.h"
+#include "FPS/FPSLog.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayAbility_Berserker::UGameplayAbility_Berserker()
 {
@@ -14,7 +16,7 @@ UGameplayAbility_Berserker::UGameplayAbility_Berserker()
 
 	// Tag 설정 (SetAssetTags 사용)
 	FGameplayTagContainer Tags;
-	Tags.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.Berserker")));
+	Tags.AddTag(FPSGameplayTags::Ability_Berserker);
 	SetAssetTags(Tags);
 }
 
@@ -51,7 +53,7 @@ void UGameplayAbility_Berserker::ActivateAbility(const FGameplayAbilitySpecHandl
 		);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("버서커 스킬 활성화! (지속시간: %.1f초, 쿨다운: %.1f초, 공격속도/이동속도 증가)"), BerserkerDuration, CooldownDuration);
+	UE_LOG(LogFPSCombat, Warning, TEXT("버서커 스킬 활성화! (지속시간: %.1f초, 쿨다운: %.1f초, 공격속도/이동속도 증가)"), BerserkerDuration, CooldownDuration);
 }
 
 void UGameplayAbility_Berserker::ApplyCooldown(const FGameplayAbilitySpecHandle Handle,
@@ -70,7 +72,7 @@ void UGameplayAbility_Berserker::ApplyCooldown(const FGameplayAbilitySpecHandle
 			{
 				// ⭐ SetByCaller로 쿨다운 시간 전달!
 				SpecHandle.Data->SetSetByCallerMagnitude(
-					FGameplayTag::RequestGameplayTag(FName("Data.Cooldown")),
+					FPSGameplayTags::Data_Cooldown,
 					CooldownDuration
 				);
 
@@ -79,7 +81,7 @@ void UGameplayAbility_Berserker::ApplyCooldown(const FGameplayAbilitySpecHandle
 				// 쿨다운 Effect 적용
 				ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
 
-				UE_LOG(LogTemp, Log, TEXT("버서커 쿨다운 적용: %.0f초"), CooldownDuration);
+				UE_LOG(LogFPSCombat, Log, TEXT("버서커 쿨다운 적용: %.0f초"), CooldownDuration);
 			}
 		}
 	}
@@ -98,7 +100,7 @@ bool UGameplayAbility_Berserker::CanActivateAbility(const FGameplayAbilitySpecHa
 	// ⭐ 쿨다운 체크 (헬퍼 함수로 리팩토링)
 	if (IsOnCooldown(ActorInfo))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("버서커 스킬 쿨다운 중! 사용 불가"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("버서커 스킬 쿨다운 중! 사용 불가"));
 		return false;
 	}
 
@@ -113,7 +115,7 @@ bool UGameplayAbility_Berserker::IsOnCooldown(const FGameplayAbilityActorInfo* A
 	}
 
 	// ASC에서 "Cooldown.ActiveSkill" 태그를 가진 Effect 쿼리
-	FGameplayTag CooldownTag = FGameplayTag::RequestGameplayTag(FName("Cooldown.ActiveSkill"));
+	FGameplayTag CooldownTag = FPSGameplayTags::Cooldown_ActiveSkill;
 	FGameplayEffectQuery Query;
 	Query.EffectTagQuery = FGameplayTagQuery::MakeQuery_MatchAnyTags(FGameplayTagContainer(CooldownTag));
 
@@ -132,7 +134,7 @@ void UGameplayAbility_Berserker::EndAbility(const FGameplayAbilitySpecHandle Han
 	// 오오라 제거
 	RemoveAuraVisual();
 
-	UE_LOG(LogTemp, Log, TEXT("버서커 스킬 종료"));
+	UE_LOG(LogFPSCombat, Log, TEXT("버서커 스킬 종료"));
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
@@ -141,7 +143,7 @@ void UGameplayAbility_Berserker::ApplyBerserkerBuff()
 {
 	if (!BerserkerBuffEffect)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("BerserkerBuffEffect가 설정되지 않음"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("BerserkerBuffEffect가 설정되지 않음"));
 		return;
 	}
 
@@ -161,7 +163,7 @@ void UGameplayAbility_Berserker::ApplyBerserkerBuff()
 	if (SpecHandle.IsValid())
 	{
 		ActiveBuffHandle = ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-		UE_LOG(LogTemp, Log, TEXT("버서커 버프 적용 완료"));
+		UE_LOG(LogFPSCombat, Log, TEXT("버서커 버프 적용 완료"));
 	}
 }
 
@@ -171,7 +173,7 @@ void UGameplayAbility_Berserker::RemoveBerserkerBuff()
 	if (ASC && ActiveBuffHandle.IsValid())
 	{
 		ASC->RemoveActiveGameplayEffect(ActiveBuffHandle);
-		UE_LOG(LogTemp, Log, TEXT("버서커 버프 제거"));
+		UE_LOG(LogFPSCombat, Log, TEXT("버서커 버프 제거"));
 	}
 }
 
@@ -205,7 +207,7 @@ void UGameplayAbility_Berserker::SpawnAuraVisual()
 	{
 		// 캐릭터에 부착
 		ActiveAuraActor->AttachToActor(OwnerActor, FAttachmentTransformRules::SnapToTargetIncludingScale);
-		UE_LOG(LogTemp, Log, TEXT("버서커 오오라 생성 완료"));
+		UE_LOG(LogFPSCombat, Log, TEXT("버서커 오오라 생성 완료"));
 	}
 }
 
@@ -215,13 +217,13 @@ void UGameplayAbility_Berserker::RemoveAuraVisual()
 	{
 		ActiveAuraActor->Destroy();
 		ActiveAuraActor = nullptr;
-		UE_LOG(LogTemp, Log, TEXT("버서커 오오라 제거"));
+		UE_LOG(LogFPSCombat, Log, TEXT("버서커 오오라 제거"));
 	}
 }
 
 void UGameplayAbility_Berserker::OnBerserkerExpired()
 {
-	UE_LOG(LogTemp, Log, TEXT("버서커 지속 시간 만료"));
+	UE_LOG(LogFPSCombat, Log, TEXT("버서커 지속 시간 만료"));
 
 	// Ability 종료
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
@@ -3,7 +3,10 @@
 #include "FPS/GameplayAbility_FireProjectile.h"
 #include "FPS/FPSCharacter.h"
 #include "FPS/Weapons/FPSWeapon.h"
+#include "FPS/Weapons/FPSProjectile.h"
+#include "FPS/Weapons/FPSProjectilePoolSubsystem.h"
 #include "FPS/Components/WeaponSlotComponent.h"
+#include "FPS/FPSEffectPoolSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "Engine/World.h"
 #include "Sound/SoundBase.h"
@@ -82,18 +85,28 @@ void UGameplayAbility_FireProjectile::SpawnProjectile(const FVector& TargetLocat
 			GetAvatarActorFromActorInfo()->GetActorLocation());
 	}
 
-	// 발사체 스폰
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = GetAvatarActorFromActorInfo();
-	SpawnParams.Instigator = Cast<APawn>(GetAvatarActorFromActorInfo());
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	// AFPSProjectile 계열은 풀에서 가져오고, 그 외 클래스는 직접 스폰
+	UFPSProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UFPSProjectilePoolSubsystem>();
+	if (ProjectilePool && ProjectileToSpawn->IsChildOf(AFPSProjectile::StaticClass()))
+	{
+		ProjectilePool->AcquireProjectile(TSubclassOf<AFPSProjectile>(ProjectileToSpawn.Get()), SpawnTransform,
+			GetAvatarActorFromActorInfo(), Cast<APawn>(GetAvatarActorFromActorInfo()));
+	}
+	else
+	{
+		// 발사체 스폰
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = GetAvatarActorFromActorInfo();
+		SpawnParams.Instigator = Cast<APawn>(GetAvatarActorFromActorInfo());
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	AActor* Projectile = GetWorld()->SpawnActor<AActor>(ProjectileToSpawn, SpawnTransform, SpawnParams);
+		GetWorld()->SpawnActor<AActor>(ProjectileToSpawn, SpawnTransform, SpawnParams);
+	}
 
 	// 사운드 재생
 	if (FireSound)
 	{
-		UGameplayStatics::PlaySoundAtLocation(GetWorld(), FireSound, SpawnTransform.GetLocation());
+		UFPSEffectPoolSubsystem::PlaySoundAtLocation(GetWorld(), FireSound, SpawnTransform.GetLocation(), EFPSEffectPriority::High);
 	}
 
 	// 머즐 플래시 재생
@@ -101,7 +114,7 @@ void UGameplayAbility_FireProjectile::SpawnProjectile(const FVector& TargetLocat
 	{
 		if (USkeletalMeshComponent* WeaponMesh = GetCurrentWeapon()->GetFirstPersonMesh())
 		{
-			UGameplayStatics::SpawnEmitterAttached(MuzzleFlash, WeaponMesh, MuzzleSocketName);
+			UFPSEffectPoolSubsystem::SpawnParticleAttached(MuzzleFlash, WeaponMesh, MuzzleSocketName, EFPSEffectPriority::High);
 		}
 	}
 }
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/GameplayAbility_Reload.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Weapons/FPSWeaponHolder.h"
 #include "FPS/Components/WeaponSlotComponent.h"
@@ -9,6 +10,9 @@
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
 #include "Animation/AnimMontage.h"
 #include "GameFramework/Character.h"
+#include "AbilitySystemComponent.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/FPSStateGate.h"
 
 UGameplayAbility_Reload::UGameplayAbility_Reload()
 {
@@ -18,6 +22,9 @@ UGameplayAbility_Reload::UGameplayAbility_Reload()
 
 	// 리로드는 일반적으로 블로킹 어빌리티
 	bRetriggerInstancedAbility = false;
+
+	// 리로드 중 상태 태그 (FPSStateGate에서 발사 차단에 사용)
+	ActivationOwnedTags.AddTag(FPSGameplayTags::State_Reloading);
 }
 
 bool UGameplayAbility_Reload::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, FGameplayTagContainer* OptionalRelevantTags) const
@@ -30,7 +37,7 @@ bool UGameplayAbility_Reload::CanActivateAbility(const FGameplayAbilitySpecHandl
 	// 이미 리로드 중이면 활성화 불가
 	if (bIsReloading)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: 이미 리로드 중입니다 (bIsReloading = true)"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: 이미 리로드 중입니다 (bIsReloading = true)"));
 		return false;
 	}
 
@@ -40,6 +47,14 @@ bool UGameplayAbility_Reload::CanActivateAbility(const FGameplayAbilitySpecHandl
 		return false;
 	}
 
+	// 리로드를 막는 상태 확인
+	FGameplayTag BlockingTag;
+	if (FPSStateGate::IsBlocked(ActorInfo->AbilitySystemComponent.Get(), EFPSGatedAction::Reload, &BlockingTag))
+	{
+		UE_LOG(LogFPSCombat, Verbose, TEXT("%s 불가: %s 상태"), FPSStateGate::GetActionName(EFPSGatedAction::Reload), *BlockingTag.ToString());
+		return false;
+	}
+
 	IFPSWeaponHolder* WeaponHolder = Cast<IFPSWeaponHolder>(ActorInfo->AvatarActor.Get());
 	if (!WeaponHolder)
 	{
@@ -57,7 +72,7 @@ bool UGameplayAbility_Reload::CanActivateAbility(const FGameplayAbilitySpecHandl
 	AFPSWeapon* CurrentWeapon = WeaponSlotComp->GetCurrentWeaponActor();
 	if (!CurrentWeapon)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: 현재 활성화된 무기가 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: 현재 활성화된 무기가 없습니다"));
 		return false;
 	}
 
@@ -65,7 +80,7 @@ bool UGameplayAbility_Reload::CanActivateAbility(const FGameplayAbilitySpecHandl
 	UAnimMontage* ReloadMontage = CurrentWeapon->GetReloadMontage();
 	if (!ReloadMontage)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: 무기에 리로드 몽타주가 설정되지 않았습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: 무기에 리로드 몽타주가 설정되지 않았습니다"));
 		return false;
 	}
 
@@ -73,14 +88,14 @@ bool UGameplayAbility_Reload::CanActivateAbility(const FGameplayAbilitySpecHandl
 	UWeaponItemData* WeaponData = WeaponSlotComp->GetActiveWeaponItem();
 	if (!WeaponData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: 무기 아이템 데이터가 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: 무기 아이템 데이터가 없습니다"));
 		return false;
 	}
 
 	// 이미 탄약이 가득 찬 경우 리로드 불가
 	if (WeaponData->IsAmmoFull())
 	{
-		UE_LOG(LogTemp, Log, TEXT("GameplayAbility_Reload: 탄약이 이미 가득 참 (%d/%d)"),
+		UE_LOG(LogFPSCombat, Log, TEXT("GameplayAbility_Reload: 탄약이 이미 가득 참 (%d/%d)"),
 			WeaponData->CurrentAmmo, WeaponData->MagazineSize);
 		return false;
 	}
@@ -98,7 +113,7 @@ void UGameplayAbility_Reload::ActivateAbility(const FGameplayAbilitySpecHandle H
 	UWeaponSlotComponent* WeaponSlotComp = ActorInfo->AvatarActor->FindComponentByClass<UWeaponSlotComponent>();
 	if (!WeaponSlotComp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GameplayAbility_Reload: WeaponSlotComponent를 찾을 수 없습니다"));
+		UE_LOG(LogFPSCombat, Error, TEXT("GameplayAbility_Reload: WeaponSlotComponent를 찾을 수 없습니다"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -106,7 +121,7 @@ void UGameplayAbility_Reload::ActivateAbility(const FGameplayAbilitySpecHandle H
 	ReloadingWeapon = WeaponSlotComp->GetCurrentWeaponActor();
 	if (!ReloadingWeapon)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GameplayAbility_Reload: 현재 활성화된 무기가 없습니다"));
+		UE_LOG(LogFPSCombat, Error, TEXT("GameplayAbility_Reload: 현재 활성화된 무기가 없습니다"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -115,20 +130,20 @@ void UGameplayAbility_Reload::ActivateAbility(const FGameplayAbilitySpecHandle H
 	UAnimMontage* ReloadMontage = ReloadingWeapon->GetReloadMontage();
 	if (!ReloadMontage)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GameplayAbility_Reload: 리로드 몽타주가 설정되지 않았습니다 - 무기: %s"),
+		UE_LOG(LogFPSCombat, Error, TEXT("GameplayAbility_Reload: 리로드 몽타주가 설정되지 않았습니다 - 무기: %s"),
 			*ReloadingWeapon->GetName());
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: 리로드 몽타주 확인됨 - %s"),
+	UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: 리로드 몽타주 확인됨 - %s"),
 		*ReloadMontage->GetName());
 
 	// WeaponHolder 인터페이스를 통해 애니메이션 재생
 	IFPSWeaponHolder* WeaponHolder = Cast<IFPSWeaponHolder>(ActorInfo->AvatarActor.Get());
 	if (!WeaponHolder)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GameplayAbility_Reload: AvatarActor가 IFPSWeaponHolder를 구현하지 않습니다"));
+		UE_LOG(LogFPSCombat, Error, TEXT("GameplayAbility_Reload: AvatarActor가 IFPSWeaponHolder를 구현하지 않습니다"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -150,7 +165,7 @@ void UGameplayAbility_Reload::ActivateAbility(const FGameplayAbilitySpecHandle H
 
 	if (!MontageTask)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GameplayAbility_Reload: 몽타주 태스크 생성 실패"));
+		UE_LOG(LogFPSCombat, Error, TEXT("GameplayAbility_Reload: 몽타주 태스크 생성 실패"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -163,13 +178,13 @@ void UGameplayAbility_Reload::ActivateAbility(const FGameplayAbilitySpecHandle H
 	// 몽타주 재생 시작
 	MontageTask->ReadyForActivation();
 
-	UE_LOG(LogTemp, Log, TEXT("GameplayAbility_Reload: 리로드 시작 - %s"),
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayAbility_Reload: 리로드 시작 - %s"),
 		*ReloadingWeapon->GetName());
 }
 
 void UGameplayAbility_Reload::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: EndAbility 호출됨 - 취소: %s, 이전 bIsReloading: %s"),
+	UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: EndAbility 호출됨 - 취소: %s, 이전 bIsReloading: %s"),
 		bWasCancelled ? TEXT("true") : TEXT("false"),
 		bIsReloading ? TEXT("true") : TEXT("false"));
 
@@ -180,23 +195,23 @@ void UGameplayAbility_Reload::EndAbility(const FGameplayAbilitySpecHandle Handle
 	// 몽타주 태스크 정리
 	if (MontageTask)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: MontageTask 정리 중"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: MontageTask 정리 중"));
 		MontageTask->EndTask();
 		MontageTask = nullptr;
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: MontageTask가 이미 null"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: MontageTask가 이미 null"));
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("GameplayAbility_Reload: 리로드 종료 완료 - bIsReloading을 false로 설정"));
+	UE_LOG(LogFPSCombat, Warning, TEXT("GameplayAbility_Reload: 리로드 종료 완료 - bIsReloading을 false로 설정"));
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
 void UGameplayAbility_Reload::OnMontageCompleted()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameplayAbility_Reload: 몽타주 재생 완료"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayAbility_Reload: 몽타주 재생 완료"));
 
 	// 정상적으로 리로드 완료
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
@@ -204,7 +219,7 @@ void UGameplayAbility_Reload::OnMontageCompleted()
 
 void UGameplayAbility_Reload::OnMontageCancelled()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameplayAbility_Reload: 몽타주 재생 취소"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayAbility_Reload: 몽타주 재생 취소"));
 
 	// 리로드 취소됨
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
@@ -212,7 +227,7 @@ void UGameplayAbility_Reload::OnMontageCancelled()
 
 void UGameplayAbility_Reload::OnMontageInterrupted()
 {
-	UE_LOG(LogTemp, Log, TEXT("GameplayAbility_Reload: 몽타주 재생 중단"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayAbility_Reload: 몽타주 재생 중단"));
 
 	// 리로드 중단됨
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
@@ -1,9 +1,11 @@
 // GameplayAbility_ShieldBarrier.cpp
 
 #include "GameplayAbility_ShieldBarrier.h"
+#include "FPS/FPSLog.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/Character.h"
 #include "TimerManager.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayAbility_ShieldBarrier::UGameplayAbility_ShieldBarrier()
 {
@@ -13,8 +15,11 @@ UGameplayAbility_ShieldBarrier::UGameplayAbility_ShieldBarrier()
 
 	// Tag 설정 (SetAssetTags 사용)
 	FGameplayTagContainer Tags;
-	Tags.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.ShieldBarrier")));
+	Tags.AddTag(FPSGameplayTags::Ability_ShieldBarrier);
 	SetAssetTags(Tags);
+
+	// 방어막 유지 중 상태 태그 (FPSStateGate)
+	ActivationOwnedTags.AddTag(FPSGameplayTags::State_ShieldBarrier);
 }
 
 void UGameplayAbility_ShieldBarrier::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -50,7 +55,7 @@ void UGameplayAbility_ShieldBarrier::ActivateAbility(const FGameplayAbilitySpecH
 		);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("방어막 스킬 활성화 (HP: %.0f, 지속시간: %.1f초, 쿨다운: %.1f초)"), BarrierHealth, BarrierDuration, CooldownDuration);
+	UE_LOG(LogFPSCombat, Log, TEXT("방어막 스킬 활성화 (HP: %.0f, 지속시간: %.1f초, 쿨다운: %.1f초)"), BarrierHealth, BarrierDuration, CooldownDuration);
 }
 
 void UGameplayAbility_ShieldBarrier::ApplyCooldown(const FGameplayAbilitySpecHandle Handle,
@@ -70,7 +75,7 @@ void UGameplayAbility_ShieldBarrier::ApplyCooldown(const FGameplayAbilitySpecHan
 			{
 				// ⭐ SetByCaller로 쿨다운 시간 전달!
 				SpecHandle.Data->SetSetByCallerMagnitude(
-					FGameplayTag::RequestGameplayTag(FName("Data.Cooldown")),
+					FPSGameplayTags::Data_Cooldown,
 					CooldownDuration
 				);
 
@@ -79,7 +84,7 @@ void UGameplayAbility_ShieldBarrier::ApplyCooldown(const FGameplayAbilitySpecHan
 				// 쿨다운 Effect 적용
 				ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
 
-				UE_LOG(LogTemp, Log, TEXT("방어막 쿨다운 적용: %.0f초"), CooldownDuration);
+				UE_LOG(LogFPSCombat, Log, TEXT("방어막 쿨다운 적용: %.0f초"), CooldownDuration);
 			}
 		}
 	}
@@ -98,7 +103,7 @@ bool UGameplayAbility_ShieldBarrier::CanActivateAbility(const FGameplayAbilitySp
 	// ⭐ 쿨다운 체크 (헬퍼 함수로 리팩토링)
 	if (IsOnCooldown(ActorInfo))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("방어막 스킬 쿨다운 중! 사용 불가"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("방어막 스킬 쿨다운 중! 사용 불가"));
 		return false;
 	}
 
@@ -113,7 +118,7 @@ bool UGameplayAbility_ShieldBarrier::IsOnCooldown(const FGameplayAbilityActorInf
 	}
 
 	// ASC에서 "Cooldown.ActiveSkill" 태그를 가진 Effect 쿼리
-	FGameplayTag CooldownTag = FGameplayTag::RequestGameplayTag(FName("Cooldown.ActiveSkill"));
+	FGameplayTag CooldownTag = FPSGameplayTags::Cooldown_ActiveSkill;
 	FGameplayEffectQuery Query;
 	Query.EffectTagQuery = FGameplayTagQuery::MakeQuery_MatchAnyTags(FGameplayTagContainer(CooldownTag));
 
@@ -129,7 +134,7 @@ void UGameplayAbility_ShieldBarrier::EndAbility(const FGameplayAbilitySpecHandle
 	// 방어막 구체 제거
 	RemoveBarrierVisual();
 
-	UE_LOG(LogTemp, Log, TEXT("방어막 스킬 종료"));
+	UE_LOG(LogFPSCombat, Log, TEXT("방어막 스킬 종료"));
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
@@ -138,7 +143,7 @@ void UGameplayAbility_ShieldBarrier::SpawnBarrierVisual()
 {
 	if (!BarrierActorClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("BarrierActorClass가 설정되지 않음"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("BarrierActorClass가 설정되지 않음"));
 		return;
 	}
 
@@ -164,7 +169,7 @@ void UGameplayAbility_ShieldBarrier::SpawnBarrierVisual()
 	{
 		// 캐릭터에 부착
 		ActiveBarrierActor->AttachToActor(OwnerActor, FAttachmentTransformRules::SnapToTargetIncludingScale);
-		UE_LOG(LogTemp, Log, TEXT("방어막 구체 생성 완료"));
+		UE_LOG(LogFPSCombat, Log, TEXT("방어막 구체 생성 완료"));
 	}
 }
 
@@ -174,13 +179,13 @@ void UGameplayAbility_ShieldBarrier::RemoveBarrierVisual()
 	{
 		ActiveBarrierActor->Destroy();
 		ActiveBarrierActor = nullptr;
-		UE_LOG(LogTemp, Log, TEXT("방어막 구체 제거"));
+		UE_LOG(LogFPSCombat, Log, TEXT("방어막 구체 제거"));
 	}
 }
 
 void UGameplayAbility_ShieldBarrier::OnBarrierExpired()
 {
-	UE_LOG(LogTemp, Log, TEXT("방어막 지속 시간 만료"));
+	UE_LOG(LogFPSCombat, Log, TEXT("방어막 지속 시간 만료"));
 
 	// Ability 종료
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
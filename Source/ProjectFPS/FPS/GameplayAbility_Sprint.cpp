@@ -1,10 +1,13 @@
 // GameplayAbility_Sprint.cpp
 
 #include "GameplayAbility_Sprint.h"
+#include "FPS/FPSLog.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Character.h"
 #include "CharacterAttributeSet.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/FPSStateGate.h"
 
 UGameplayAbility_Sprint::UGameplayAbility_Sprint()
 {
@@ -14,8 +17,11 @@ UGameplayAbility_Sprint::UGameplayAbility_Sprint()
 
 	// Ability 태그 설정 (UE 5.6+ 방식)
 	FGameplayTagContainer Tags;
-	Tags.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.Sprint")));
+	Tags.AddTag(FPSGameplayTags::Ability_Sprint);
 	SetAssetTags(Tags);
+
+	// 질주 중 상태 태그 (FPSStateGate)
+	ActivationOwnedTags.AddTag(FPSGameplayTags::State_Sprinting);
 }
 
 void UGameplayAbility_Sprint::ActivateAbility(
@@ -46,7 +52,7 @@ void UGameplayAbility_Sprint::ActivateAbility(
 		{
 			// SetByCaller로 SprintSpeedBoost 값 전달
 			SpecHandle.Data->SetSetByCallerMagnitude(
-				FGameplayTag::RequestGameplayTag(FName("Data.SprintSpeed")),
+				FPSGameplayTags::Data_SprintSpeed,
 				SprintSpeedBoost
 			);
 
@@ -54,7 +60,7 @@ void UGameplayAbility_Sprint::ActivateAbility(
 				*SpecHandle.Data.Get()
 			);
 
-			UE_LOG(LogTemp, Log, TEXT("Sprint 시작: 이동속도 +%.0f%% (%.2f배)"),
+			UE_LOG(LogFPSCombat, Log, TEXT("Sprint 시작: 이동속도 +%.0f%% (%.2f배)"),
 				SprintSpeedBoost * 100.0f, 1.0f + SprintSpeedBoost);
 		}
 	}
@@ -64,7 +70,7 @@ void UGameplayAbility_Sprint::ActivateAbility(
 	{
 		ActorInfo->AbilitySystemComponent->RemoveActiveGameplayEffect(ActiveStaminaRecoverHandle);
 		ActiveStaminaRecoverHandle.Invalidate();
-		UE_LOG(LogTemp, Log, TEXT("스태미나 회복 중단"));
+		UE_LOG(LogFPSCombat, Log, TEXT("스태미나 회복 중단"));
 	}
 
 	// 3. 스태미나 소모 GameplayEffect 적용 (Periodic)
@@ -100,7 +106,7 @@ void UGameplayAbility_Sprint::EndAbility(
 	{
 		ActorInfo->AbilitySystemComponent->RemoveActiveGameplayEffect(ActiveSprintSpeedHandle);
 		ActiveSprintSpeedHandle.Invalidate();
-		UE_LOG(LogTemp, Log, TEXT("Sprint 종료: 이동속도 복구"));
+		UE_LOG(LogFPSCombat, Log, TEXT("Sprint 종료: 이동속도 복구"));
 	}
 
 	// 2. 스태미나 소모 Effect 제거
@@ -126,7 +132,7 @@ void UGameplayAbility_Sprint::EndAbility(
 		{
 			// 핸들 저장 (다음 Sprint 시작 시 제거하기 위해)
 			ActiveStaminaRecoverHandle = ActorInfo->AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-			UE_LOG(LogTemp, Log, TEXT("Sprint 종료: 스태미나 회복 시작"));
+			UE_LOG(LogFPSCombat, Log, TEXT("Sprint 종료: 스태미나 회복 시작"));
 		}
 	}
 
@@ -145,13 +151,21 @@ bool UGameplayAbility_Sprint::CanActivateAbility(
 		return false;
 	}
 
+	// 질주를 막는 상태 확인
+	FGameplayTag BlockingTag;
+	if (FPSStateGate::IsBlocked(ActorInfo->AbilitySystemComponent.Get(), EFPSGatedAction::Sprint, &BlockingTag))
+	{
+		UE_LOG(LogFPSCombat, Verbose, TEXT("%s 불가: %s 상태"), FPSStateGate::GetActionName(EFPSGatedAction::Sprint), *BlockingTag.ToString());
+		return false;
+	}
+
 	// 스태미나가 0 이하면 질주 불가
 	if (ActorInfo->AbilitySystemComponent.IsValid())
 	{
 		const UCharacterAttributeSet* AttributeSet = ActorInfo->AbilitySystemComponent->GetSet<UCharacterAttributeSet>();
 		if (AttributeSet && AttributeSet->GetStamina() <= 0.0f)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Sprint 불가: 스태미나 부족 (%.1f)"), AttributeSet->GetStamina());
+			UE_LOG(LogFPSCombat, Warning, TEXT("Sprint 불가: 스태미나 부족 (%.1f)"), AttributeSet->GetStamina());
 			return false;
 		}
 	}
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "GameplayAbility_UseConsumable.h"
+#include "FPS/FPSLog.h"
 #include "Items/ConsumableItemData.h"
 #include "Components/InventoryComponent.h"
 #include "FPSPlayerCharacter.h"
@@ -8,6 +9,7 @@
 #include "GameplayTags.h"
 #include "CharacterAttributeSet.h"
 #include "GameplayEffect_InstantHeal.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayAbility_UseConsumable::UGameplayAbility_UseConsumable()
 {
@@ -16,7 +18,7 @@ UGameplayAbility_UseConsumable::UGameplayAbility_UseConsumable()
 
 	// Tag 설정
 	FGameplayTagContainer Tags;
-	Tags.AddTag(FGameplayTag::RequestGameplayTag(FName("Ability.UseConsumable")));
+	Tags.AddTag(FPSGameplayTags::Ability_UseConsumable);
 	SetAssetTags(Tags);
 }
 
@@ -41,7 +43,7 @@ bool UGameplayAbility_UseConsumable::CanActivateAbility(const FGameplayAbilitySp
 	// ConsumableData 체크
 	if (!ConsumableData || !ConsumableData->ConsumableEffect)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CanActivateAbility: ConsumableData 또는 ConsumableEffect가 없습니다."));
+		UE_LOG(LogFPSCombat, Warning, TEXT("CanActivateAbility: ConsumableData 또는 ConsumableEffect가 없습니다."));
 		return false;
 	}
 
@@ -59,7 +61,7 @@ bool UGameplayAbility_UseConsumable::CanActivateAbility(const FGameplayAbilitySp
 			// Health가 이미 최대치면 사용 불가
 			if (CurrentHealth >= MaxHealth)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("CanActivateAbility: 체력이 가득 차서 포션을 사용할 수 없습니다."));
+				UE_LOG(LogFPSCombat, Warning, TEXT("CanActivateAbility: 체력이 가득 차서 포션을 사용할 수 없습니다."));
 				return false;
 			}
 		}
@@ -83,7 +85,7 @@ void UGameplayAbility_UseConsumable::ActivateAbility(const FGameplayAbilitySpecH
 	AFPSPlayerCharacter* PlayerCharacter = Cast<AFPSPlayerCharacter>(ActorInfo->AvatarActor.Get());
 	if (!PlayerCharacter)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ActivateAbility: PlayerCharacter를 찾을 수 없습니다."));
+		UE_LOG(LogFPSCombat, Error, TEXT("ActivateAbility: PlayerCharacter를 찾을 수 없습니다."));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -91,7 +93,7 @@ void UGameplayAbility_UseConsumable::ActivateAbility(const FGameplayAbilitySpecH
 	UInventoryComponent* InventoryComp = PlayerCharacter->GetInventoryComponent();
 	if (!InventoryComp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ActivateAbility: InventoryComponent를 찾을 수 없습니다."));
+		UE_LOG(LogFPSCombat, Error, TEXT("ActivateAbility: InventoryComponent를 찾을 수 없습니다."));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -113,13 +115,13 @@ void UGameplayAbility_UseConsumable::ActivateAbility(const FGameplayAbilitySpecH
 		{
 			// SetByCaller로 회복량 전달
 			SpecHandle.Data->SetSetByCallerMagnitude(
-				FGameplayTag::RequestGameplayTag(FName("Data.HealAmount")),
+				FPSGameplayTags::Data_HealAmount,
 				ConsumableData->EffectMagnitude
 			);
 
 			ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 
-			UE_LOG(LogTemp, Log, TEXT("포션 사용: %s (회복량: %.1f)"),
+			UE_LOG(LogFPSCombat, Log, TEXT("포션 사용: %s (회복량: %.1f)"),
 			       *ConsumableData->GetItemName(),
 			       ConsumableData->EffectMagnitude);
 		}
@@ -129,7 +131,7 @@ void UGameplayAbility_UseConsumable::ActivateAbility(const FGameplayAbilitySpecH
 	if (GridX >= 0 && GridY >= 0)
 	{
 		InventoryComp->DecreaseStackAt(GridX, GridY, 1);
-		UE_LOG(LogTemp, Log, TEXT("인벤토리에서 포션 1개 사용: (%d, %d)"), GridX, GridY);
+		UE_LOG(LogFPSCombat, Log, TEXT("인벤토리에서 포션 1개 사용: (%d, %d)"), GridX, GridY);
 	}
 
 	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
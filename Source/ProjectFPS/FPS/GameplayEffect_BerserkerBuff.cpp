@@ -1,6 +1,7 @@
 // GameplayEffect_BerserkerBuff.cpp
 
 #include "GameplayEffect_BerserkerBuff.h"
+#include "FPS/FPSLog.h"
 #include "PlayerAttributeSet.h"
 #include "CharacterAttributeSet.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -25,5 +26,5 @@ UGameplayEffect_BerserkerBuff::UGameplayEffect_BerserkerBuff()
 	MoveSpeedModifier.ModifierMagnitude = FScalableFloat(0.3f);  // +0.3 (즉, 1.0 + 0.3 = 1.3)
 	Modifiers.Add(MoveSpeedModifier);
 
-	UE_LOG(LogTemp, Log, TEXT("GameplayEffect_BerserkerBuff 생성자 호출 (공격속도 +50%%, 이동속도 +30%%)"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayEffect_BerserkerBuff 생성자 호출 (공격속도 +50%%, 이동속도 +30%%)"));
 }
@@ -2,6 +2,7 @@
 
 #include "GameplayEffect_Cooldown.h"
 #include "GameplayEffectComponents/AssetTagsGameplayEffectComponent.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayEffect_Cooldown::UGameplayEffect_Cooldown()
 {
@@ -10,7 +11,7 @@ UGameplayEffect_Cooldown::UGameplayEffect_Cooldown()
 
 	// SetByCaller로 쿨다운 시간 설정
 	FSetByCallerFloat CooldownDuration;
-	CooldownDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Cooldown"));
+	CooldownDuration.DataTag = FPSGameplayTags::Data_Cooldown;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(CooldownDuration);
 
 	// ⭐ Cooldown.ActiveSkill 태그 추가 (GetCooldownTags()가 이걸 반환함!)
@@ -18,7 +19,7 @@ UGameplayEffect_Cooldown::UGameplayEffect_Cooldown()
 	UAssetTagsGameplayEffectComponent* AssetTagsComp = CreateDefaultSubobject<UAssetTagsGameplayEffectComponent>(TEXT("AssetTagsComponent"));
 
 	FInheritedTagContainer AssetTags;
-	AssetTags.Added.AddTag(FGameplayTag::RequestGameplayTag(FName("Cooldown.ActiveSkill")));
+	AssetTags.Added.AddTag(FPSGameplayTags::Cooldown_ActiveSkill);
 
 	AssetTagsComp->SetAndApplyAssetTagChanges(AssetTags);
 
@@ -3,6 +3,7 @@
 
 #include "FPS/GameplayEffect_Damage.h"
 #include "FPS/CharacterAttributeSet.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayEffect_Damage::UGameplayEffect_Damage()
 {
@@ -15,7 +16,7 @@ UGameplayEffect_Damage::UGameplayEffect_Damage()
 
 	// SetByCaller 방식으로 데미지 값 설정 (발사체에서 동적으로 설정)
 	FSetByCallerFloat SetByCallerMagnitude;
-	SetByCallerMagnitude.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Damage"));
+	SetByCallerMagnitude.DataTag = FPSGameplayTags::Data_Damage;
 	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerMagnitude);
 
 	Modifiers.Add(ModifierInfo);
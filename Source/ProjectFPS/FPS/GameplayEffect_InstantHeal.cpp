@@ -3,6 +3,7 @@
 #include "GameplayEffect_InstantHeal.h"
 #include "CharacterAttributeSet.h"
 #include "GameplayTags.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayEffect_InstantHeal::UGameplayEffect_InstantHeal()
 {
@@ -16,7 +17,7 @@ UGameplayEffect_InstantHeal::UGameplayEffect_InstantHeal()
 
 	// SetByCaller 설정 (Data.HealAmount 태그로 동적 전달)
 	FSetByCallerFloat SetByCallerData;
-	SetByCallerData.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.HealAmount"));
+	SetByCallerData.DataTag = FPSGameplayTags::Data_HealAmount;
 	HealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerData);
 
 	Modifiers.Add(HealthModifier);
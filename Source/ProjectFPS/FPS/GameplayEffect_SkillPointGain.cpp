@@ -2,6 +2,7 @@
 
 #include "GameplayEffect_SkillPointGain.h"
 #include "PlayerAttributeSet.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayEffect_SkillPointGain::UGameplayEffect_SkillPointGain()
 {
@@ -15,7 +16,7 @@ UGameplayEffect_SkillPointGain::UGameplayEffect_SkillPointGain()
 
 	// SetByCaller 설정 (Data.SkillPointGain 태그로 동적 전달)
 	FSetByCallerFloat SetByCallerData;
-	SetByCallerData.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.SkillPointGain"));
+	SetByCallerData.DataTag = FPSGameplayTags::Data_SkillPointGain;
 	SkillPointModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerData);
 
 	Modifiers.Add(SkillPointModifier);
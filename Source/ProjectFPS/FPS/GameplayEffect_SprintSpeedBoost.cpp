@@ -1,7 +1,9 @@
 // GameplayEffect_SprintSpeedBoost.cpp
 
 #include "GameplayEffect_SprintSpeedBoost.h"
+#include "FPS/FPSLog.h"
 #include "PlayerAttributeSet.h"
+#include "FPS/FPSGameplayTags.h"
 
 UGameplayEffect_SprintSpeedBoost::UGameplayEffect_SprintSpeedBoost()
 {
@@ -15,10 +17,10 @@ UGameplayEffect_SprintSpeedBoost::UGameplayEffect_SprintSpeedBoost()
 
 	// SetByCaller로 값 받기 (Data.SprintSpeed 태그)
 	FSetByCallerFloat SetByCallerData;
-	SetByCallerData.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.SprintSpeed"));
+	SetByCallerData.DataTag = FPSGameplayTags::Data_SprintSpeed;
 	MoveSpeedModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerData);
 
 	Modifiers.Add(MoveSpeedModifier);
 
-	UE_LOG(LogTemp, Log, TEXT("GameplayEffect_SprintSpeedBoost 생성자 호출 (SetByCaller 방식)"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayEffect_SprintSpeedBoost 생성자 호출 (SetByCaller 방식)"));
 }
@@ -1,6 +1,7 @@
 // GameplayEffect_StaminaDrain.cpp
 
 #include "GameplayEffect_StaminaDrain.h"
+#include "FPS/FPSLog.h"
 #include "CharacterAttributeSet.h"
 
 UGameplayEffect_StaminaDrain::UGameplayEffect_StaminaDrain()
@@ -24,5 +25,5 @@ UGameplayEffect_StaminaDrain::UGameplayEffect_StaminaDrain()
 	StackingType = EGameplayEffectStackingType::AggregateBySource;
 	StackLimitCount = 1;
 
-	UE_LOG(LogTemp, Log, TEXT("GameplayEffect_StaminaDrain 생성: 0.1초당 -5 스태미나 소모 (초당 -50)"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayEffect_StaminaDrain 생성: 0.1초당 -5 스태미나 소모 (초당 -50)"));
 }
@@ -1,6 +1,7 @@
 // GameplayEffect_StaminaRecover.cpp
 
 #include "GameplayEffect_StaminaRecover.h"
+#include "FPS/FPSLog.h"
 #include "CharacterAttributeSet.h"
 
 UGameplayEffect_StaminaRecover::UGameplayEffect_StaminaRecover()
@@ -24,5 +25,5 @@ UGameplayEffect_StaminaRecover::UGameplayEffect_StaminaRecover()
 	StackingType = EGameplayEffectStackingType::AggregateBySource;
 	StackLimitCount = 1;
 
-	UE_LOG(LogTemp, Log, TEXT("GameplayEffect_StaminaRecover 생성: 0.1초당 +3 스태미나 회복 (초당 +30)"));
+	UE_LOG(LogFPSCombat, Log, TEXT("GameplayEffect_StaminaRecover 생성: 0.1초당 +3 스태미나 회복 (초당 +30)"));
 }
@@ -2,18 +2,20 @@
 
 #include "ItemDropTable.h"
 #include "Items/BaseItemData.h"
+#include "FPSRandomSubsystem.h"
 
-TArray<UBaseItemData*> FItemDropTable::RollDrops() const
+TArray<UBaseItemData*> FItemDropTable::RollDrops(FFPSRandomStream* Stream) const
 {
 	TArray<UBaseItemData*> DroppedItems;
 
 	for (const FItemDropEntry& Entry : DropEntries)
 	{
 		// 확률 체크
-		if (FMath::FRand() <= Entry.DropChance)
+		const float Roll = Stream ? Stream->FRand() : FMath::FRand();
+		if (Roll <= Entry.DropChance)
 		{
 			// 드롭 개수 랜덤
-			int32 DropCount = FMath::RandRange(Entry.MinCount, Entry.MaxCount);
+			int32 DropCount = Stream ? Stream->RandRange(Entry.MinCount, Entry.MaxCount) : FMath::RandRange(Entry.MinCount, Entry.MaxCount);
 
 			// 아이템 데이터 복제 (CurrentStackSize 설정)
 			if (DropCount > 0 && Entry.ItemData)
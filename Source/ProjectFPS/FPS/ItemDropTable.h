@@ -6,6 +6,7 @@
 #include "ItemDropTable.generated.h"
 
 class UBaseItemData;
+class FFPSRandomStream;
 
 /**
  * 아이템 드롭 엔트리
@@ -46,6 +47,6 @@ struct FItemDropTable
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item Drop")
 	TArray<FItemDropEntry> DropEntries;
 
-	/** 랜덤 아이템 선택 (확률 기반) */
-	TArray<UBaseItemData*> RollDrops() const;
+	/** 랜덤 아이템 선택 (확률 기반, Stream이 없으면 전역 난수) */
+	TArray<UBaseItemData*> RollDrops(FFPSRandomStream* Stream = nullptr) const;
 };
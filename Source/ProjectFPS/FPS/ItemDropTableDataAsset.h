@@ -28,4 +28,10 @@ public:
 	{
 		return DropTable.RollDrops();
 	}
+
+	/** 드롭 추첨 (지정한 난수 스트림 사용) */
+	TArray<UBaseItemData*> RollDropsWithStream(FFPSRandomStream& Stream) const
+	{
+		return DropTable.RollDrops(&Stream);
+	}
 };
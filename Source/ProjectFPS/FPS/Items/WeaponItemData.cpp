@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/Items/WeaponItemData.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Weapons/FPSWeapon.h"
 
 UWeaponItemData::UWeaponItemData()
@@ -21,6 +22,7 @@ UWeaponItemData::UWeaponItemData()
 	RecoilStrength = 1.0f;
 	WeaponRange = 5000.0f;
 	bIsAutomatic = false;
+	FireMode = EWeaponFireMode::Projectile;
 
 	// 런타임 상태 초기화
 	CurrentAmmo = MagazineSize; // 처음엔 탄약 가득
@@ -41,7 +43,7 @@ void UWeaponItemData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChan
 	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UWeaponItemData, MagazineSize))
 	{
 		CurrentAmmo = MagazineSize;
-		UE_LOG(LogTemp, Log, TEXT("MagazineSize 변경 감지: CurrentAmmo를 %d로 동기화"), CurrentAmmo);
+		UE_LOG(LogFPSInventory, Log, TEXT("MagazineSize 변경 감지: CurrentAmmo를 %d로 동기화"), CurrentAmmo);
 	}
 }
 #endif
@@ -7,6 +7,18 @@
 #include "WeaponItemData.generated.h"
 
 class AFPSWeapon;
+class UNiagaraSystem;
+
+/**
+ * 무기 발사 방식
+ */
+UENUM(BlueprintType)
+enum class EWeaponFireMode : uint8
+{
+	Projectile UMETA(DisplayName = "Projectile"),  // 발사체 액터 스폰 (ProjectileClass)
+	Hitscan    UMETA(DisplayName = "Hitscan"),     // 라인 트레이스로 즉시 판정 (WeaponRange)
+	Simulated  UMETA(DisplayName = "Simulated")    // 중앙 시뮬레이션 서브시스템에서 처리 (대량 발사체용, 액터는 연출 전용)
+};
 
 /**
  * 무기 아이템 데이터 클래스
@@ -62,6 +74,34 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weapon Stats")
 	bool bIsAutomatic = false;
 
+	/** 한 번 발사 시 펠릿 수 (2 이상이면 산탄: 한 묶음으로 판정, BaseDamage는 펠릿당 데미지) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weapon Stats", meta = (ClampMin = 1, ClampMax = 32))
+	int32 PelletCount = 1;
+
+	/** 펠릿 확산 반각 (도 단위, 조준 분산 적용 후 방향 기준) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weapon Stats", meta = (ClampMin = 0.0, ClampMax = 45.0, EditCondition = "PelletCount > 1"))
+	float PelletSpread = 5.0f;
+
+	// ========================================
+	// 발사 방식
+	// ========================================
+
+	/** 발사 방식 (고연사 무기는 Hitscan 권장) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire Mode")
+	EWeaponFireMode FireMode = EWeaponFireMode::Projectile;
+
+	/** 히트스캔/산탄 총구 이펙트 (선택, 연출 전용) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire Mode", meta = (EditCondition = "FireMode == EWeaponFireMode::Hitscan || PelletCount > 1"))
+	TObjectPtr<UNiagaraSystem> HitscanMuzzleEffect;
+
+	/** 히트스캔/산탄 탄도(트레이서) 이펙트 (선택, 연출 전용) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire Mode", meta = (EditCondition = "FireMode == EWeaponFireMode::Hitscan || PelletCount > 1"))
+	TObjectPtr<UNiagaraSystem> HitscanTracerEffect;
+
+	/** 트레이서 끝점을 전달할 Niagara User 파라미터 이름 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire Mode", meta = (EditCondition = "FireMode == EWeaponFireMode::Hitscan || PelletCount > 1"))
+	FName TracerEndParameterName = FName("BeamEnd");
+
 	// ========================================
 	// 크로스헤어 설정
 	// ========================================
@@ -96,9 +136,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Weapon")
 	bool IsValidWeapon() const;
 
-	/** 무기 DPS 계산 */
+	/** 히트스캔 무기인지 확인 */
+	UFUNCTION(BlueprintPure, Category = "Weapon")
+	bool IsHitscan() const { return FireMode == EWeaponFireMode::Hitscan; }
+
+	/** 산탄 무기인지 확인 */
+	UFUNCTION(BlueprintPure, Category = "Weapon")
+	bool IsPelletWeapon() const { return PelletCount > 1; }
+
+	/** 무기 DPS 계산 (모든 펠릿 명중 기준) */
 	UFUNCTION(BlueprintPure, Category = "Weapon")
-	float CalculateDPS() const { return BaseDamage * FireRate; }
+	float CalculateDPS() const { return BaseDamage * FireRate * PelletCount; }
 
 	/** 현재 탄약을 최대로 채우기 */
 	UFUNCTION(BlueprintCallable, Category = "Runtime State")
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/PlayerAttributeSet.h"
+#include "FPS/FPSLog.h"
 #include "Net/UnrealNetwork.h"
 #include "GameplayEffectExtension.h"
 
@@ -110,24 +111,24 @@ void UPlayerAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCall
 	// SkillPoint 변경 시 로그 출력
 	if (Data.EvaluatedData.Attribute == GetSkillPointAttribute())
 	{
-		UE_LOG(LogTemp, Log, TEXT("SkillPoint 변경: %.0f"), GetSkillPoint());
+		UE_LOG(LogFPSCombat, Log, TEXT("SkillPoint 변경: %.0f"), GetSkillPoint());
 	}
 
 	// CritChance 변경 시 로그 출력
 	if (Data.EvaluatedData.Attribute == GetCritChanceAttribute())
 	{
-		UE_LOG(LogTemp, Log, TEXT("CritChance 변경: %.2f%%"), GetCritChance() * 100.0f);
+		UE_LOG(LogFPSCombat, Log, TEXT("CritChance 변경: %.2f%%"), GetCritChance() * 100.0f);
 	}
 
 	// CritDamage 변경 시 로그 출력
 	if (Data.EvaluatedData.Attribute == GetCritDamageAttribute())
 	{
-		UE_LOG(LogTemp, Log, TEXT("CritDamage 변경: %.0f%%"), GetCritDamage() * 100.0f);
+		UE_LOG(LogFPSCombat, Log, TEXT("CritDamage 변경: %.0f%%"), GetCritDamage() * 100.0f);
 	}
 
 	// AttackSpeedMultiplier 변경 시 로그 출력
 	if (Data.EvaluatedData.Attribute == GetAttackSpeedMultiplierAttribute())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("⚡ AttackSpeedMultiplier 변경: %.2fx"), GetAttackSpeedMultiplier());
+		UE_LOG(LogFPSCombat, Warning, TEXT("⚡ AttackSpeedMultiplier 변경: %.2fx"), GetAttackSpeedMultiplier());
 	}
 }
@@ -1,6 +1,7 @@
 // ShieldBarrierActor.cpp
 
 #include "ShieldBarrierActor.h"
+#include "FPS/FPSLog.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Weapons/FPSProjectile.h"
@@ -49,7 +50,7 @@ void AShieldBarrierActor::BeginPlay()
 	CollisionSphere->OnComponentHit.AddDynamic(this, &AShieldBarrierActor::OnBarrierHit);
 	CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &AShieldBarrierActor::OnProjectileBeginOverlap);
 
-	UE_LOG(LogTemp, Log, TEXT("ShieldBarrierActor 생성 (HP: %.0f)"), MaxHealth);
+	UE_LOG(LogFPSCombat, Log, TEXT("ShieldBarrierActor 생성 (HP: %.0f)"), MaxHealth);
 }
 
 void AShieldBarrierActor::Tick(float DeltaTime)
@@ -89,7 +90,7 @@ void AShieldBarrierActor::OnProjectileBeginOverlap(UPrimitiveComponent* Overlapp
 	// Owner가 발사한 발사체는 무시 (내부에서 발사)
 	if (IsProjectileFromOwner(Projectile))
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("방어막: Owner 발사체 통과"));
+		UE_LOG(LogFPSCombat, Verbose, TEXT("방어막: Owner 발사체 통과"));
 		return;
 	}
 
@@ -99,7 +100,7 @@ void AShieldBarrierActor::OnProjectileBeginOverlap(UPrimitiveComponent* Overlapp
 
 	// 발사체 파괴
 	Projectile->Destroy();
-	UE_LOG(LogTemp, Log, TEXT("방어막: 발사체 차단 (남은 HP: %.0f)"), CurrentHealth);
+	UE_LOG(LogFPSCombat, Log, TEXT("방어막: 발사체 차단 (남은 HP: %.0f)"), CurrentHealth);
 }
 
 void AShieldBarrierActor::ProcessDamage(AActor* DamageCauser, float Damage)
@@ -109,7 +110,7 @@ void AShieldBarrierActor::ProcessDamage(AActor* DamageCauser, float Damage)
 	if (CurrentHealth <= 0.0f)
 	{
 		CurrentHealth = 0.0f;
-		UE_LOG(LogTemp, Warning, TEXT("방어막 HP 소진! 파괴됩니다."));
+		UE_LOG(LogFPSCombat, Warning, TEXT("방어막 HP 소진! 파괴됩니다."));
 
 		// 방어막 파괴
 		Destroy();
@@ -0,0 +1,589 @@
+// FPSCombatBenchmarkSubsystem.cpp
+
+#include "FPSCombatBenchmarkSubsystem.h"
+#include "FPSCountingMalloc.h"
+#include "FPS/FPSCharacter.h"
+#include "FPS/FPSPlayerCharacter.h"
+#include "FPS/AI/FPSEnemyCharacter.h"
+#include "FPS/CharacterAttributeSet.h"
+#include "FPS/FPSRandomSubsystem.h"
+#include "FPS/Weapons/FPSWeapon.h"
+#include "FPS/Items/WeaponItemData.h"
+#include "FPS/Components/WeaponSlotComponent.h"
+#include "AbilitySystemComponent.h"
+#include "GameFramework/PlayerStart.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace FPSCombatBenchmark
+{
+	/** 현재 누적 카운터 (Shipping에서는 0) */
+	FFPSCombatCounters ReadCounters()
+	{
+#if !UE_BUILD_SHIPPING
+		return GFPSCombatCounters;
+#else
+		return FFPSCombatCounters();
+#endif
+	}
+
+	/** 정렬된 배열의 백분위 값 */
+	float Percentile(const TArray<float>& Sorted, float Fraction)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0.0f;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	/** 기준 대비 비교 항목 (bLowerIsBetter: 값이 커지면 회귀) */
+	struct FRegressionMetric
+	{
+		const TCHAR* Name;
+		bool bLowerIsBetter;
+	};
+
+	const FRegressionMetric RegressionMetrics[] =
+	{
+		{ TEXT("game_thread_ms_avg"), true },
+		{ TEXT("game_thread_ms_p95"), true },
+		{ TEXT("allocations_per_frame"), true },
+		{ TEXT("allocations_per_shot"), true },
+		{ TEXT("ge_applications_per_shot"), true },
+		{ TEXT("shots_per_second"), false },
+	};
+}
+
+bool UFPSCombatBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+bool UFPSCombatBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSCombatBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSCombatBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSCombatBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 명령줄 실행은 프로세스당 한 번 (맵 이동 후 다시 시작하지 않음)
+	static bool bCommandLineRunStarted = false;
+	const TCHAR* CommandLine = FCommandLine::Get();
+	if (bCommandLineRunStarted || !FParse::Param(CommandLine, TEXT("FPSCombatBenchmark")))
+	{
+		return;
+	}
+	bCommandLineRunStarted = true;
+
+	FFPSCombatBenchmarkSettings CommandLineSettings;
+	FParse::Value(CommandLine, TEXT("BenchEnemies="), CommandLineSettings.EnemyShooters);
+	FParse::Value(CommandLine, TEXT("BenchPlayers="), CommandLineSettings.PlayerShooters);
+	FParse::Value(CommandLine, TEXT("BenchSeconds="), CommandLineSettings.DurationSeconds);
+	FParse::Value(CommandLine, TEXT("BenchOutput="), CommandLineSettings.OutputPath);
+	FParse::Value(CommandLine, TEXT("BenchBaseline="), CommandLineSettings.BaselinePath);
+	CommandLineSettings.bExitWhenDone = true;
+
+	if (!StartBenchmark(CommandLineSettings))
+	{
+		UE_LOG(LogFPSCombat, Error, TEXT("CombatBenchmark: 시작 실패"));
+		FPlatformMisc::RequestExitWithStatus(false, 1);
+	}
+}
+
+void UFPSCombatBenchmarkSubsystem::Deinitialize()
+{
+	if (IsRunning())
+	{
+		UE_LOG(LogFPSCombat, Warning, TEXT("CombatBenchmark: 월드 종료로 중단"));
+		Cleanup();
+	}
+
+	Super::Deinitialize();
+}
+
+bool UFPSCombatBenchmarkSubsystem::StartBenchmark(const FFPSCombatBenchmarkSettings& InSettings)
+{
+	UWorld* World = GetWorld();
+	if (IsRunning() || !World)
+	{
+		return false;
+	}
+
+	Settings = InSettings;
+	Settings.EnemyShooters = FMath::Max(0, Settings.EnemyShooters);
+	Settings.PlayerShooters = FMath::Max(0, Settings.PlayerShooters);
+	Settings.DurationSeconds = FMath::Max(0.1f, Settings.DurationSeconds);
+
+	UClass* EnemyClass = EnemyShooterClass.IsNull() ? AFPSEnemyCharacter::StaticClass() : EnemyShooterClass.LoadSynchronous();
+	UClass* PlayerClass = PlayerShooterClass.IsNull() ? AFPSPlayerCharacter::StaticClass() : PlayerShooterClass.LoadSynchronous();
+
+	// 기본 무기가 없는 사수용 무기 (설정 없으면 적 사수 기본 무기)
+	TSubclassOf<UWeaponItemData> WeaponData = ShooterWeaponData.LoadSynchronous();
+	if (!WeaponData && EnemyClass)
+	{
+		WeaponData = EnemyClass->GetDefaultObject<AFPSEnemyCharacter>()->GetDefaultWeaponData();
+	}
+
+	// 첫 PlayerStart 기준으로 두 줄 배치 (없으면 월드 원점)
+	FVector Origin = FVector(0.0f, 0.0f, 200.0f);
+	for (TActorIterator<APlayerStart> It(World); It; ++It)
+	{
+		Origin = It->GetActorLocation();
+		break;
+	}
+
+	// 플레이어 사수를 먼저, 짝수 번째는 +X를 보고 홀수 번째는 맞은편에서 -X를 봄
+	const int32 TotalShooters = Settings.PlayerShooters + Settings.EnemyShooters;
+	for (int32 Index = 0; Index < TotalShooters; ++Index)
+	{
+		const bool bFarLane = (Index % 2) == 1;
+		const int32 Row = Index / 2;
+		const float RowOffset = (Row - (TotalShooters - 1) / 4.0f) * ShooterSpacing;
+
+		const FVector Location = Origin + FVector(bFarLane ? LaneDistance : 0.0f, RowOffset, 0.0f);
+		const FRotator Rotation(0.0f, bFarLane ? 180.0f : 0.0f, 0.0f);
+
+		UClass* ShooterClass = Index < Settings.PlayerShooters ? PlayerClass : EnemyClass;
+		if (AFPSCharacter* Shooter = SpawnShooter(ShooterClass, FTransform(Rotation, Location), WeaponData))
+		{
+			FBenchmarkShooter& Entry = Shooters.AddDefaulted_GetRef();
+			Entry.Character = Shooter;
+		}
+	}
+
+	if (Shooters.Num() == 0)
+	{
+		UE_LOG(LogFPSCombat, Error, TEXT("CombatBenchmark: 사수를 스폰하지 못함"));
+		return false;
+	}
+
+	// 고정 시간 간격으로 진행 (프레임 수 = 시뮬레이션 시간 * FixedFrameRate)
+	bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / FixedFrameRate);
+
+	TargetFrames = FMath::Max(1, FMath::RoundToInt(Settings.DurationSeconds * FixedFrameRate));
+	WarmupFramesElapsed = 0;
+	ShootersLost = 0;
+	Phase = EPhase::Warmup;
+
+	UE_LOG(LogFPSCombat, Log, TEXT("CombatBenchmark: 시작 (플레이어 %d, 적 %d, 스폰 %d, %.1f초 = %d프레임)"),
+		Settings.PlayerShooters, Settings.EnemyShooters, Shooters.Num(), Settings.DurationSeconds, TargetFrames);
+
+	return true;
+}
+
+AFPSCharacter* UFPSCombatBenchmarkSubsystem::SpawnShooter(UClass* ShooterClass, const FTransform& SpawnTransform, TSubclassOf<UWeaponItemData> WeaponData)
+{
+	if (!ShooterClass)
+	{
+		return nullptr;
+	}
+
+	// 지연 스폰: BeginPlay 전에 AI 자동 빙의를 꺼서 컨트롤러 없이 무기 경로만 측정
+	AFPSCharacter* Shooter = GetWorld()->SpawnActorDeferred<AFPSCharacter>(
+		ShooterClass,
+		SpawnTransform,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn
+	);
+
+	if (!Shooter)
+	{
+		return nullptr;
+	}
+
+	Shooter->AutoPossessAI = EAutoPossessAI::Disabled;
+	Shooter->FinishSpawning(SpawnTransform);
+
+	// 적 캐릭터는 BeginPlay에서 기본 무기를 받음, 나머지는 여기서 지급
+	UWeaponSlotComponent* WSC = Shooter->GetWeaponSlotComponent();
+	if (WSC && !WSC->GetCurrentWeaponActor() && WeaponData)
+	{
+		UWeaponItemData* WeaponDataInstance = NewObject<UWeaponItemData>(Shooter, WeaponData);
+		if (WSC->EquipWeaponToSlot(EWeaponSlot::Primary, WeaponDataInstance))
+		{
+			WSC->SwitchToSlot(EWeaponSlot::Primary);
+		}
+	}
+
+	if (!WSC || !WSC->GetCurrentWeaponActor())
+	{
+		UE_LOG(LogFPSCombat, Warning, TEXT("CombatBenchmark: %s에 무기가 없어 제외"), *GetNameSafe(ShooterClass));
+		Shooter->Destroy();
+		return nullptr;
+	}
+
+	return Shooter;
+}
+
+void UFPSCombatBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	switch (Phase)
+	{
+	case EPhase::Idle:
+		return;
+
+	case EPhase::Warmup:
+		MaintainShooters();
+		if (++WarmupFramesElapsed >= WarmupFrames)
+		{
+			BeginMeasure();
+		}
+		return;
+
+	case EPhase::Measure:
+		if (FrameTimesMs.Num() >= TargetFrames)
+		{
+			FinishBenchmark();
+			return;
+		}
+		MaintainShooters();
+		return;
+	}
+}
+
+void UFPSCombatBenchmarkSubsystem::MaintainShooters()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (FBenchmarkShooter& Entry : Shooters)
+	{
+		AFPSCharacter* Shooter = Entry.Character.Get();
+		if (!Shooter)
+		{
+			continue;
+		}
+
+		AFPSEnemyCharacter* Enemy = Cast<AFPSEnemyCharacter>(Shooter);
+		if (Enemy && Enemy->IsDead())
+		{
+			ShootersLost++;
+			Entry.Character.Reset();
+			continue;
+		}
+
+		// 측정 중 사망 방지
+		if (UAbilitySystemComponent* ASC = Shooter->GetAbilitySystemComponent())
+		{
+			const float MaxHealth = ASC->GetNumericAttribute(UCharacterAttributeSet::GetMaxHealthAttribute());
+			if (MaxHealth > 0.0f)
+			{
+				ASC->SetNumericAttributeBase(UCharacterAttributeSet::GetHealthAttribute(), MaxHealth);
+			}
+		}
+
+		UWeaponSlotComponent* WSC = Shooter->GetWeaponSlotComponent();
+		AFPSWeapon* Weapon = WSC ? WSC->GetCurrentWeaponActor() : nullptr;
+		UWeaponItemData* WeaponData = Weapon ? Weapon->GetWeaponItemData() : nullptr;
+		if (!WeaponData)
+		{
+			continue;
+		}
+
+		// 재장전 없이 계속 발사
+		WeaponData->RefillAmmo();
+
+		// 자동 무기는 방아쇠 유지, 반자동은 연사 간격마다 다시 당김
+		if (WeaponData->bIsAutomatic)
+		{
+			if (!Weapon->IsFiring())
+			{
+				Weapon->StartFiring();
+			}
+		}
+		else if (Now >= Entry.NextSemiFireTime)
+		{
+			Weapon->StopFiring();
+			Weapon->StartFiring();
+			Entry.NextSemiFireTime = Now + Weapon->GetCurrentRefireRate();
+		}
+	}
+}
+
+void UFPSCombatBenchmarkSubsystem::BeginMeasure()
+{
+	Phase = EPhase::Measure;
+
+	// 측정 중 배열 증가가 할당 수에 잡히지 않도록 미리 확보
+	FrameTimesMs.Reset(TargetFrames + 1);
+	FrameStartSeconds = 0.0;
+	CountersAtStart = FPSCombatBenchmark::ReadCounters();
+
+	BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UFPSCombatBenchmarkSubsystem::HandleBeginFrame);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UFPSCombatBenchmarkSubsystem::HandleEndFrame);
+
+#if !UE_BUILD_SHIPPING
+	FFPSCountingMalloc::Get().Install();
+#endif
+}
+
+void UFPSCombatBenchmarkSubsystem::HandleBeginFrame()
+{
+	FrameStartSeconds = FPlatformTime::Seconds();
+}
+
+void UFPSCombatBenchmarkSubsystem::HandleEndFrame()
+{
+	// 측정 시작 프레임은 중간부터 시작하므로 제외
+	if (FrameStartSeconds > 0.0 && FrameTimesMs.Num() < TargetFrames)
+	{
+		FrameTimesMs.Add(static_cast<float>((FPlatformTime::Seconds() - FrameStartSeconds) * 1000.0));
+	}
+}
+
+void UFPSCombatBenchmarkSubsystem::FinishBenchmark()
+{
+	int64 Allocations = 0;
+#if !UE_BUILD_SHIPPING
+	FFPSCountingMalloc& CountingMalloc = FFPSCountingMalloc::Get();
+	Allocations = CountingMalloc.GetCount();
+	CountingMalloc.Uninstall();
+#endif
+
+	const FFPSCombatCounters CountersAtEnd = FPSCombatBenchmark::ReadCounters();
+
+	FFPSCombatCounters Delta;
+	Delta.ShotsFired = CountersAtEnd.ShotsFired - CountersAtStart.ShotsFired;
+	Delta.ProjectilesLaunched = CountersAtEnd.ProjectilesLaunched - CountersAtStart.ProjectilesLaunched;
+	Delta.ProjectileActorSpawns = CountersAtEnd.ProjectileActorSpawns - CountersAtStart.ProjectileActorSpawns;
+	Delta.DamageApplications = CountersAtEnd.DamageApplications - CountersAtStart.DamageApplications;
+	Delta.DamageExecutions = CountersAtEnd.DamageExecutions - CountersAtStart.DamageExecutions;
+	Delta.CriticalHits = CountersAtEnd.CriticalHits - CountersAtStart.CriticalHits;
+
+	const bool bExitWhenDone = Settings.bExitWhenDone;
+	const int32 NumRegressions = WriteResults(Delta, Allocations);
+
+	Cleanup();
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, NumRegressions > 0 ? 1 : 0);
+	}
+}
+
+void UFPSCombatBenchmarkSubsystem::Cleanup()
+{
+#if !UE_BUILD_SHIPPING
+	FFPSCountingMalloc::Get().Uninstall();
+#endif
+
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	BeginFrameHandle.Reset();
+	EndFrameHandle.Reset();
+
+	for (const FBenchmarkShooter& Entry : Shooters)
+	{
+		if (AFPSCharacter* Shooter = Entry.Character.Get())
+		{
+			UWeaponSlotComponent* WSC = Shooter->GetWeaponSlotComponent();
+			if (AFPSWeapon* Weapon = WSC ? WSC->GetCurrentWeaponActor() : nullptr)
+			{
+				Weapon->StopFiring();
+			}
+			Shooter->Destroy();
+		}
+	}
+	Shooters.Reset();
+
+	FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+
+	Phase = EPhase::Idle;
+}
+
+int32 UFPSCombatBenchmarkSubsystem::WriteResults(const FFPSCombatCounters& Counters, int64 Allocations)
+{
+	const int32 Frames = FrameTimesMs.Num();
+	const double SimulatedSeconds = Frames / FixedFrameRate;
+	const double Shots = static_cast<double>(Counters.ShotsFired);
+
+	TArray<float> SortedFrameTimes = FrameTimesMs;
+	SortedFrameTimes.Sort();
+
+	double TotalMs = 0.0;
+	for (const float FrameMs : FrameTimesMs)
+	{
+		TotalMs += FrameMs;
+	}
+
+	// 지표 (기준 비교 대상은 모두 이 객체의 숫자 필드)
+	TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+	Metrics->SetNumberField(TEXT("frames"), Frames);
+	Metrics->SetNumberField(TEXT("simulated_seconds"), SimulatedSeconds);
+	Metrics->SetNumberField(TEXT("shooters_lost"), ShootersLost);
+	Metrics->SetNumberField(TEXT("shots_fired"), Shots);
+	Metrics->SetNumberField(TEXT("shots_per_second"), SimulatedSeconds > 0.0 ? Shots / SimulatedSeconds : 0.0);
+	Metrics->SetNumberField(TEXT("projectiles_launched"), static_cast<double>(Counters.ProjectilesLaunched));
+	Metrics->SetNumberField(TEXT("projectile_actor_spawns"), static_cast<double>(Counters.ProjectileActorSpawns));
+	Metrics->SetNumberField(TEXT("damage_requests"), static_cast<double>(Counters.DamageApplications));
+	Metrics->SetNumberField(TEXT("ge_applications"), static_cast<double>(Counters.DamageExecutions));
+	Metrics->SetNumberField(TEXT("ge_applications_per_shot"), Shots > 0.0 ? Counters.DamageExecutions / Shots : 0.0);
+	Metrics->SetNumberField(TEXT("critical_hits"), static_cast<double>(Counters.CriticalHits));
+	Metrics->SetNumberField(TEXT("allocations"), static_cast<double>(Allocations));
+	Metrics->SetNumberField(TEXT("allocations_per_frame"), Frames > 0 ? static_cast<double>(Allocations) / Frames : 0.0);
+	Metrics->SetNumberField(TEXT("allocations_per_shot"), Shots > 0.0 ? Allocations / Shots : 0.0);
+	Metrics->SetNumberField(TEXT("game_thread_ms_avg"), Frames > 0 ? TotalMs / Frames : 0.0);
+	Metrics->SetNumberField(TEXT("game_thread_ms_p50"), FPSCombatBenchmark::Percentile(SortedFrameTimes, 0.5f));
+	Metrics->SetNumberField(TEXT("game_thread_ms_p95"), FPSCombatBenchmark::Percentile(SortedFrameTimes, 0.95f));
+	Metrics->SetNumberField(TEXT("game_thread_ms_max"), SortedFrameTimes.Num() > 0 ? SortedFrameTimes.Last() : 0.0f);
+
+	TSharedRef<FJsonObject> SettingsObject = MakeShared<FJsonObject>();
+	SettingsObject->SetNumberField(TEXT("enemy_shooters"), Settings.EnemyShooters);
+	SettingsObject->SetNumberField(TEXT("player_shooters"), Settings.PlayerShooters);
+	SettingsObject->SetNumberField(TEXT("duration_seconds"), Settings.DurationSeconds);
+	SettingsObject->SetNumberField(TEXT("fixed_frame_rate"), FixedFrameRate);
+	SettingsObject->SetNumberField(TEXT("warmup_frames"), WarmupFrames);
+
+	const UFPSRandomSubsystem* RandomSubsystem = GetWorld()->GetSubsystem<UFPSRandomSubsystem>();
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("benchmark"), TEXT("FPSCombat"));
+	Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("map"), GetWorld()->GetMapName());
+	Root->SetStringField(TEXT("build"), LexToString(FApp::GetBuildConfiguration()));
+	Root->SetNumberField(TEXT("seed"), RandomSubsystem ? RandomSubsystem->GetMatchSeed() : 0);
+	Root->SetObjectField(TEXT("settings"), SettingsObject);
+	Root->SetObjectField(TEXT("metrics"), Metrics);
+
+	// 기준 비교
+	TArray<TSharedPtr<FJsonValue>> Regressions;
+	if (!Settings.BaselinePath.IsEmpty())
+	{
+		FString BaselineText;
+		TSharedPtr<FJsonObject> Baseline;
+		const TSharedPtr<FJsonObject>* BaselineMetrics = nullptr;
+
+		if (FFileHelper::LoadFileToString(BaselineText, *Settings.BaselinePath)
+			&& FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineText), Baseline)
+			&& Baseline.IsValid()
+			&& Baseline->TryGetObjectField(TEXT("metrics"), BaselineMetrics))
+		{
+			for (const FPSCombatBenchmark::FRegressionMetric& Metric : FPSCombatBenchmark::RegressionMetrics)
+			{
+				double BaselineValue = 0.0;
+				if (!(*BaselineMetrics)->TryGetNumberField(Metric.Name, BaselineValue) || BaselineValue <= 0.0)
+				{
+					continue;
+				}
+
+				const double CurrentValue = Metrics->GetNumberField(Metric.Name);
+				const double Ratio = CurrentValue / BaselineValue;
+				const bool bRegressed = Metric.bLowerIsBetter ? Ratio > 1.0 + RegressionTolerance : Ratio < 1.0 - RegressionTolerance;
+				if (!bRegressed)
+				{
+					continue;
+				}
+
+				TSharedRef<FJsonObject> Regression = MakeShared<FJsonObject>();
+				Regression->SetStringField(TEXT("metric"), Metric.Name);
+				Regression->SetNumberField(TEXT("baseline"), BaselineValue);
+				Regression->SetNumberField(TEXT("current"), CurrentValue);
+				Regression->SetNumberField(TEXT("ratio"), Ratio);
+				Regressions.Add(MakeShared<FJsonValueObject>(Regression));
+
+				UE_LOG(LogFPSCombat, Error, TEXT("CombatBenchmark: 회귀 %s (기준 %.3f -> 현재 %.3f, x%.2f)"),
+					Metric.Name, BaselineValue, CurrentValue, Ratio);
+			}
+
+			Root->SetStringField(TEXT("baseline"), Settings.BaselinePath);
+		}
+		else
+		{
+			UE_LOG(LogFPSCombat, Warning, TEXT("CombatBenchmark: 기준 파일을 읽지 못함 (%s)"), *Settings.BaselinePath);
+		}
+	}
+	Root->SetArrayField(TEXT("regressions"), Regressions);
+
+	FString OutputPath = Settings.OutputPath;
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"),
+			FString::Printf(TEXT("CombatBenchmark_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	}
+
+	FString Json;
+	FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+
+	if (FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogFPSCombat, Log, TEXT("CombatBenchmark: %d프레임, 발사 %.0f (%.1f/초), GE %lld, 할당 %.1f/프레임, 게임 스레드 %.2fms -> %s"),
+			Frames, Shots, SimulatedSeconds > 0.0 ? Shots / SimulatedSeconds : 0.0, Counters.DamageExecutions,
+			Frames > 0 ? static_cast<double>(Allocations) / Frames : 0.0, Frames > 0 ? TotalMs / Frames : 0.0, *OutputPath);
+	}
+	else
+	{
+		UE_LOG(LogFPSCombat, Error, TEXT("CombatBenchmark: 결과 저장 실패 (%s)"), *OutputPath);
+	}
+
+	return Regressions.Num();
+}
+
+// ========================================
+// 콘솔 명령 (FPS.Bench.Combat [적 수] [플레이어 수] [시간(초)])
+// ========================================
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithWorldAndArgs GFPSCombatBenchmarkCommand(
+	TEXT("FPS.Bench.Combat"),
+	TEXT("무기 발사 경로 벤치마크 (결과는 Saved/Benchmarks/*.json). 인자: [적 수=16] [플레이어 수=1] [시간(초)=10]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UFPSCombatBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<UFPSCombatBenchmarkSubsystem>() : nullptr;
+		if (!Benchmark)
+		{
+			return;
+		}
+
+		FFPSCombatBenchmarkSettings ConsoleSettings;
+		if (Args.Num() > 0)
+		{
+			ConsoleSettings.EnemyShooters = FCString::Atoi(*Args[0]);
+		}
+		if (Args.Num() > 1)
+		{
+			ConsoleSettings.PlayerShooters = FCString::Atoi(*Args[1]);
+		}
+		if (Args.Num() > 2)
+		{
+			ConsoleSettings.DurationSeconds = FCString::Atof(*Args[2]);
+		}
+
+		if (!Benchmark->StartBenchmark(ConsoleSettings))
+		{
+			UE_LOG(LogFPSCombat, Warning, TEXT("CombatBenchmark: 이미 실행 중이거나 사수를 스폰하지 못함"));
+		}
+	}));
+
+#endif
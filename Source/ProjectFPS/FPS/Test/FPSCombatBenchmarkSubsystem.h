@@ -0,0 +1,186 @@
+// FPSCombatBenchmarkSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "FPSCombatBenchmarkSubsystem.generated.h"
+
+class AFPSCharacter;
+class AFPSEnemyCharacter;
+class AFPSWeapon;
+class UWeaponItemData;
+
+/**
+ * 전투 벤치마크 실행 설정 (명령줄/콘솔 명령에서 채움)
+ */
+struct FFPSCombatBenchmarkSettings
+{
+	/** 적 캐릭터 사수 수 */
+	int32 EnemyShooters = 16;
+
+	/** 플레이어 캐릭터 사수 수 */
+	int32 PlayerShooters = 1;
+
+	/** 측정 시간 (시뮬레이션 초, 고정 프레임 기준) */
+	float DurationSeconds = 10.0f;
+
+	/** 결과 JSON 경로 (비어 있으면 Saved/Benchmarks/CombatBenchmark_<시각>.json) */
+	FString OutputPath;
+
+	/** 비교할 기준 JSON 경로 (비어 있으면 비교하지 않음) */
+	FString BaselinePath;
+
+	/** 끝나면 프로세스 종료 (회귀가 있으면 종료 코드 1) */
+	bool bExitWhenDone = false;
+};
+
+/**
+ * 무기 발사 경로 벤치마크 서브시스템 (월드 단위, Shipping 제외)
+ * - 플레이어/적 캐릭터 사수를 두 줄로 마주 보게 스폰하고 정해진 시뮬레이션 시간 동안 계속 발사
+ * - 고정 프레임(FixedFrameRate)으로 진행하므로 같은 시드(-FPSRandomSeed)면 같은 발사/명중 수가 나옴
+ * - 측정: 발사 수/초, 발사체 발사/액터 스폰 수, 데미지 요청/GE 적용 수, 게임 스레드 할당 수, 게임 스레드 ms/프레임
+ * - 결과는 JSON으로 저장, 기준 JSON이 있으면 RegressionTolerance를 넘는 항목을 regressions에 기록
+ * - 사수는 AI/플레이어 컨트롤러 없이 스폰, 매 프레임 체력/탄약을 채워 측정 중 사망/재장전이 없도록 함
+ *
+ * 실행:
+ * - 콘솔: FPS.Bench.Combat [적 수] [플레이어 수] [시간(초)]
+ * - 헤드리스: UnrealEditor-Cmd ProjectFPS.uproject <맵> -game -nullrhi -nosound -unattended -FPSCombatBenchmark
+ *   -BenchEnemies=N -BenchPlayers=N -BenchSeconds=N -BenchOutput=<경로> -BenchBaseline=<경로> -FPSRandomSeed=N
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSCombatBenchmarkSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSCombatBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// Benchmark API
+	// ========================================
+
+	/** 벤치마크 시작 (이미 실행 중이거나 사수를 스폰하지 못하면 false) */
+	bool StartBenchmark(const FFPSCombatBenchmarkSettings& InSettings);
+
+	/** 실행 중인지 여부 */
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 적 사수 클래스 (비어 있으면 AFPSEnemyCharacter) */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark")
+	TSoftClassPtr<AFPSEnemyCharacter> EnemyShooterClass;
+
+	/** 플레이어 사수 클래스 (비어 있으면 AFPSPlayerCharacter) */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark")
+	TSoftClassPtr<AFPSCharacter> PlayerShooterClass;
+
+	/** 기본 무기가 없는 사수에게 지급할 무기 (비어 있으면 적 사수 클래스의 기본 무기) */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark")
+	TSoftClassPtr<UWeaponItemData> ShooterWeaponData;
+
+	/** 고정 프레임 속도 (측정 중 FApp 고정 시간 간격으로 사용) */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark", meta = (ClampMin = 10.0))
+	float FixedFrameRate = 60.0f;
+
+	/** 측정 전 예열 프레임 (풀 예열/스펙 캐시 생성 제외) */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark", meta = (ClampMin = 0))
+	int32 WarmupFrames = 60;
+
+	/** 같은 줄 사수 간격 */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark", meta = (ClampMin = 50.0))
+	float ShooterSpacing = 150.0f;
+
+	/** 마주 보는 두 줄 사이 거리 */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark", meta = (ClampMin = 100.0))
+	float LaneDistance = 2000.0f;
+
+	/** 기준 대비 허용 오차 비율 (0.1 = 10% 나빠지면 회귀) */
+	UPROPERTY(Config, EditAnywhere, Category = "Combat Benchmark", meta = (ClampMin = 0.0))
+	float RegressionTolerance = 0.1f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		Warmup,
+		Measure
+	};
+
+	/** 사수 상태 */
+	struct FBenchmarkShooter
+	{
+		TWeakObjectPtr<AFPSCharacter> Character;
+
+		/** 반자동 무기 다음 발사 가능 시각 (월드 시간) */
+		double NextSemiFireTime = 0.0;
+	};
+
+	/** 사수 스폰 (컨트롤러 없음, 무기 없으면 지급) */
+	AFPSCharacter* SpawnShooter(UClass* ShooterClass, const FTransform& SpawnTransform, TSubclassOf<UWeaponItemData> WeaponData);
+
+	/** 체력/탄약 보충, 발사 유지 */
+	void MaintainShooters();
+
+	/** 측정 시작 (카운터 스냅샷, 할당 카운터 설치, 프레임 시간 수집 시작) */
+	void BeginMeasure();
+
+	/** 측정 종료 후 결과 저장, 사수 정리 */
+	void FinishBenchmark();
+
+	/** 사수 발사 중지 후 파괴, 고정 시간 간격 복구 */
+	void Cleanup();
+
+	/** 결과 JSON 작성 (회귀 수 반환) */
+	int32 WriteResults(const FFPSCombatCounters& Counters, int64 Allocations);
+
+	/** 프레임 경계 (게임 스레드 시간 측정) */
+	void HandleBeginFrame();
+	void HandleEndFrame();
+
+	EPhase Phase = EPhase::Idle;
+	FFPSCombatBenchmarkSettings Settings;
+
+	TArray<FBenchmarkShooter> Shooters;
+
+	/** 예열 경과 프레임 */
+	int32 WarmupFramesElapsed = 0;
+
+	/** 측정할 프레임 수 */
+	int32 TargetFrames = 0;
+
+	/** 측정 중 게임 스레드 프레임 시간 (ms) */
+	TArray<float> FrameTimesMs;
+
+	/** 현재 프레임 시작 시각 */
+	double FrameStartSeconds = 0.0;
+
+	/** 측정 시작 시점 카운터 */
+	FFPSCombatCounters CountersAtStart;
+
+	/** 측정 중 사망한 사수 수 */
+	int32 ShootersLost = 0;
+
+	/** 벤치마크 전 고정 시간 간격 설정 (종료 시 복구) */
+	bool bPrevUseFixedTimeStep = false;
+	double PrevFixedDeltaTime = 0.0;
+
+	FDelegateHandle BeginFrameHandle;
+	FDelegateHandle EndFrameHandle;
+};
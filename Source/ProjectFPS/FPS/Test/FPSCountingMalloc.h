@@ -0,0 +1,93 @@
+// FPSCountingMalloc.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * 게임 스레드 할당 횟수를 세는 GMalloc 프록시 (벤치마크 전용, Shipping 제외)
+ * - Install/Uninstall 사이의 게임 스레드 Malloc/Realloc 호출 수를 셈 (다른 스레드 할당은 제외)
+ * - 다른 스레드가 교체 직후의 포인터를 읽을 수 있으므로 프록시 객체는 해제하지 않음 (Get()의 정적 인스턴스)
+ */
+class FFPSCountingMalloc final : public FMalloc
+{
+public:
+	explicit FFPSCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { CountAllocation(); return Inner->Malloc(Count, Alignment); }
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { CountAllocation(); return Inner->TryMalloc(Count, Alignment); }
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override { CountAllocation(); return Inner->Realloc(Ptr, NewSize, Alignment); }
+	virtual void* TryRealloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override { CountAllocation(); return Inner->TryRealloc(Ptr, NewSize, Alignment); }
+	virtual void Free(void* Ptr) override { Inner->Free(Ptr); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	/** 프로세스 공용 프록시 (최초 호출 시점의 GMalloc을 감쌈) */
+	static FFPSCountingMalloc& Get()
+	{
+		static FFPSCountingMalloc* Instance = new FFPSCountingMalloc(GMalloc);
+		return *Instance;
+	}
+
+	/** 카운트 초기화 후 GMalloc 교체 */
+	void Install()
+	{
+		AllocationCount = 0;
+		GMalloc = this;
+	}
+
+	/** 원래 GMalloc 복구 */
+	void Uninstall()
+	{
+		if (GMalloc == this)
+		{
+			GMalloc = Inner;
+		}
+	}
+
+	bool IsInstalled() const { return GMalloc == this; }
+	int64 GetCount() const { return AllocationCount; }
+
+private:
+	void CountAllocation()
+	{
+		if (IsInGameThread())
+		{
+			++AllocationCount;
+		}
+	}
+
+	FMalloc* Inner;
+	int64 AllocationCount = 0;
+};
+
+namespace FPSCountingMalloc
+{
+	/** Func를 Iterations번 실행하는 동안의 게임 스레드 할당 수 */
+	template <typename FuncType>
+	int64 CountAllocations(int32 Iterations, FuncType&& Func)
+	{
+		FFPSCountingMalloc& CountingMalloc = FFPSCountingMalloc::Get();
+		CountingMalloc.Install();
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Func();
+		}
+
+		const int64 Count = CountingMalloc.GetCount();
+		CountingMalloc.Uninstall();
+		return Count;
+	}
+}
+
+#endif
@@ -0,0 +1,64 @@
+// FPSDamageQueueTest.cpp
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "FPS/FPSLog.h"
+#include "FPS/FPSCharacter.h"
+#include "FPS/GameplayEffect_Damage.h"
+#include "FPS/Weapons/FPSProjectile.h"
+#include "FPS/Weapons/FPSDamageQueueSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+/**
+ * 같은 프레임에 한 대상을 맞힌 여러 발사체의 명중이 GE 1회로 합쳐지는지 확인
+ * - 발사체 경로(AFPSProjectile::ApplyDamageEffect)는 데미지 원인으로 발사체 자신을 넘기므로, 원인이 달라도 합쳐져야 함
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFPSDamageQueueMergesProjectileHitsTest, "ProjectFPS.Combat.DamageQueue.MergesProjectileHits",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FFPSDamageQueueMergesProjectileHitsTest::RunTest(const FString& Parameters)
+{
+	// 데미지 큐/스펙 캐시 서브시스템이 생성되는 게임 월드
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("FPSDamageQueueTestWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UFPSDamageQueueSubsystem* DamageQueue = World->GetSubsystem<UFPSDamageQueueSubsystem>();
+	AFPSCharacter* Target = World->SpawnActor<AFPSCharacter>();
+
+	if (TestNotNull(TEXT("DamageQueue"), DamageQueue) && TestNotNull(TEXT("Target"), Target))
+	{
+		DamageQueue->bBatchDamage = true;
+
+		const int32 NumProjectiles = 3;
+		const float DamagePerHit = 10.0f;
+		const int64 ExecutionsBefore = GFPSCombatCounters.DamageExecutions;
+
+		// 발사체마다 자기 자신을 데미지 원인으로 넘김 (OnComponentBeginOverlap 경로와 동일)
+		for (int32 i = 0; i < NumProjectiles; ++i)
+		{
+			AFPSProjectile* Projectile = World->SpawnActor<AFPSProjectile>();
+			AFPSProjectile::ApplyDamageEffect(Target, UGameplayEffect_Damage::StaticClass(), DamagePerHit, false, nullptr, Projectile);
+		}
+
+		TestEqual(TEXT("명중이 대상 하나로 합쳐짐"), DamageQueue->GetPendingTargetCount(), 1);
+		TestEqual(TEXT("프레임 끝 전에는 적용되지 않음"), GFPSCombatCounters.DamageExecutions, ExecutionsBefore);
+
+		DamageQueue->Flush();
+
+		TestEqual(TEXT("GE 1회 적용"), GFPSCombatCounters.DamageExecutions, ExecutionsBefore + 1);
+		TestEqual(TEXT("대기 중인 명중 없음"), DamageQueue->GetPendingTargetCount(), 0);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
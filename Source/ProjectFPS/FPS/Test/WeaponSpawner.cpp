@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "WeaponSpawner.h"
+#include "FPS/FPSLog.h"
 #include "FPS/Items/WeaponItemData.h"
 #include "FPS/Weapons/FPSWeapon.h"
 #include "FPS/Components/PickupTriggerComponent.h"
@@ -40,7 +41,7 @@ AFPSWeapon* AWeaponSpawner::SpawnWeapon()
 {
 	if (!WeaponToSpawn)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WeaponSpawner: WeaponToSpawn이 설정되지 않았습니다! %s"), *GetName());
+		UE_LOG(LogFPS, Warning, TEXT("WeaponSpawner: WeaponToSpawn이 설정되지 않았습니다! %s"), *GetName());
 		return nullptr;
 	}
 
@@ -48,21 +49,21 @@ AFPSWeapon* AWeaponSpawner::SpawnWeapon()
 	UWeaponItemData* DefaultWeaponData = WeaponToSpawn.GetDefaultObject();
 	if (!DefaultWeaponData || !DefaultWeaponData->IsValidWeapon())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WeaponSpawner: 잘못된 WeaponItemData 클래스입니다!"));
+		UE_LOG(LogFPS, Warning, TEXT("WeaponSpawner: 잘못된 WeaponItemData 클래스입니다!"));
 		return nullptr;
 	}
 
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		UE_LOG(LogTemp, Error, TEXT("WeaponSpawner: World가 null입니다"));
+		UE_LOG(LogFPS, Error, TEXT("WeaponSpawner: World가 null입니다"));
 		return nullptr;
 	}
 
 	// 이미 스폰된 무기가 있으면 제거
 	if (SpawnedWeapon && IsValid(SpawnedWeapon))
 	{
-		UE_LOG(LogTemp, Log, TEXT("WeaponSpawner: 기존 무기 제거 중..."));
+		UE_LOG(LogFPS, Log, TEXT("WeaponSpawner: 기존 무기 제거 중..."));
 		SpawnedWeapon->Destroy();
 		SpawnedWeapon = nullptr;
 	}
@@ -78,7 +79,7 @@ AFPSWeapon* AWeaponSpawner::SpawnWeapon()
 	// WeaponClass 가져오기
 	if (!DefaultWeaponData->WeaponClass)
 	{
-		UE_LOG(LogTemp, Error, TEXT("WeaponSpawner: WeaponClass가 설정되지 않았습니다"));
+		UE_LOG(LogFPS, Error, TEXT("WeaponSpawner: WeaponClass가 설정되지 않았습니다"));
 		return nullptr;
 	}
 
@@ -91,7 +92,7 @@ AFPSWeapon* AWeaponSpawner::SpawnWeapon()
 
 	if (!NewWeapon)
 	{
-		UE_LOG(LogTemp, Error, TEXT("WeaponSpawner: 무기 스폰 실패"));
+		UE_LOG(LogFPS, Error, TEXT("WeaponSpawner: 무기 스폰 실패"));
 		return nullptr;
 	}
 
@@ -103,7 +104,7 @@ AFPSWeapon* AWeaponSpawner::SpawnWeapon()
 	if (UPickupTriggerComponent* PickupTrigger = NewWeapon->FindComponentByClass<UPickupTriggerComponent>())
 	{
 		PickupTrigger->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-		UE_LOG(LogTemp, Log, TEXT("WeaponSpawner: 픽업 트리거 활성화"));
+		UE_LOG(LogFPS, Log, TEXT("WeaponSpawner: 픽업 트리거 활성화"));
 	}
 
 	// 무기를 픽업 가능한 상태로 설정 (보이게 하고 콜리전 활성화)
@@ -115,7 +116,7 @@ AFPSWeapon* AWeaponSpawner::SpawnWeapon()
 
 	SpawnedWeapon = NewWeapon;
 
-	UE_LOG(LogTemp, Log, TEXT("WeaponSpawner: 무기 스폰 완료 - %s at %s"),
+	UE_LOG(LogFPS, Log, TEXT("WeaponSpawner: 무기 스폰 완료 - %s at %s"),
 		*WeaponDataInstance->GetItemName(), *SpawnLocation.ToString());
 
 	// 성공 메시지 표시
@@ -135,7 +136,7 @@ void AWeaponSpawner::SetWeaponData(TSubclassOf<UWeaponItemData> NewWeaponDataCla
 	if (WeaponToSpawn)
 	{
 		UWeaponItemData* DefaultData = WeaponToSpawn.GetDefaultObject();
-		UE_LOG(LogTemp, Log, TEXT("WeaponSpawner: WeaponData 클래스 설정됨 - %s"),
+		UE_LOG(LogFPS, Log, TEXT("WeaponSpawner: WeaponData 클래스 설정됨 - %s"),
 			DefaultData ? *DefaultData->GetItemName() : TEXT("Unknown"));
 	}
 }
\ No newline at end of file
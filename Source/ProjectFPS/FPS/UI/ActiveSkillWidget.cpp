@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "ActiveSkillWidget.h"
+#include "FPS/FPSLog.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/Overlay.h"
@@ -9,6 +10,7 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "FPS/Skills/BaseSkillData.h"
+#include "FPS/FPSGameplayTags.h"
 
 void UActiveSkillWidget::NativeConstruct()
 {
@@ -31,7 +33,7 @@ void UActiveSkillWidget::NativeConstruct()
 	if (CooldownOverlay && CooldownOverlay->GetDynamicMaterial())
 	{
 		CooldownMaterialInstance = CooldownOverlay->GetDynamicMaterial();
-		UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget: 쿨다운 머티리얼 인스턴스 생성 완료"));
+		UE_LOG(LogFPSUI, Log, TEXT("ActiveSkillWidget: 쿨다운 머티리얼 인스턴스 생성 완료"));
 	}
 
 	// 초기 상태: 빈 슬롯
@@ -71,7 +73,7 @@ void UActiveSkillWidget::UpdateCooldown()
 		static bool bWarned = false;
 		if (!bWarned)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: AbilitySystemComponent 없음!"));
+			UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: AbilitySystemComponent 없음!"));
 			bWarned = true;
 		}
 		return;
@@ -86,28 +88,28 @@ void UActiveSkillWidget::UpdateCooldown()
 	static int32 DebugCounter = 0;
 	if (DebugCounter % 60 == 0) // 약 1초마다 로그
 	{
-		UE_LOG(LogTemp, Log, TEXT("UpdateCooldown: 쿨다운 체크 시작 - %s"), *CurrentActiveSkillData->SkillName.ToString());
+		UE_LOG(LogFPSUI, Log, TEXT("UpdateCooldown: 쿨다운 체크 시작 - %s"), *CurrentActiveSkillData->SkillName.ToString());
 	}
 	DebugCounter++;
 
 	// 단계 2: SkillAbilities 체크
 	if (CurrentActiveSkillData->SkillAbilities.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: SkillAbilities 배열이 비어있음!"));
+		UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: SkillAbilities 배열이 비어있음!"));
 		return;
 	}
 
 	TSubclassOf<UGameplayAbility> AbilityClass = CurrentActiveSkillData->SkillAbilities[0];
 	if (!AbilityClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: AbilityClass가 nullptr!"));
+		UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: AbilityClass가 nullptr!"));
 		return;
 	}
 
 	const UGameplayAbility* AbilityCDO = AbilityClass.GetDefaultObject();
 	if (!AbilityCDO)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: AbilityCDO를 가져올 수 없음!"));
+		UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: AbilityCDO를 가져올 수 없음!"));
 		return;
 	}
 
@@ -115,21 +117,21 @@ void UActiveSkillWidget::UpdateCooldown()
 	const FGameplayTagContainer& AssetTags = AbilityCDO->GetAssetTags();
 	if (AssetTags.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: AssetTags가 비어있음! Ability에 태그 설정 필요"));
+		UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: AssetTags가 비어있음! Ability에 태그 설정 필요"));
 		return;
 	}
 
 	FGameplayTag AbilityTag = AssetTags.First();
 	if (DebugCounter % 60 == 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("UpdateCooldown: Ability 태그 - %s"), *AbilityTag.ToString());
+		UE_LOG(LogFPSUI, Log, TEXT("UpdateCooldown: Ability 태그 - %s"), *AbilityTag.ToString());
 	}
 
 	// 단계 4: AbilitySpec 찾기
 	FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecByTag(AbilityTag);
 	if (!AbilitySpec)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: AbilitySpec을 찾을 수 없음! (태그: %s)"), *AbilityTag.ToString());
+		UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: AbilitySpec을 찾을 수 없음! (태그: %s)"), *AbilityTag.ToString());
 
 		// 쿨다운 없음 (정상)
 		if (CooldownOverlay)
@@ -145,13 +147,13 @@ void UActiveSkillWidget::UpdateCooldown()
 
 	if (!AbilitySpec->Ability)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdateCooldown: AbilitySpec->Ability가 nullptr!"));
+		UE_LOG(LogFPSUI, Warning, TEXT("UpdateCooldown: AbilitySpec->Ability가 nullptr!"));
 		return;
 	}
 
 	// ⭐ 새로운 방식: ASC에서 모든 Active GameplayEffect를 순회하며 쿨다운 찾기
 	// GetCooldownTags() 대신 직접 "Cooldown.ActiveSkill" 태그를 가진 Effect를 찾음!
-	FGameplayTag CooldownTag = FGameplayTag::RequestGameplayTag(FName("Cooldown.ActiveSkill"));
+	FGameplayTag CooldownTag = FPSGameplayTags::Cooldown_ActiveSkill;
 
 	// ASC에서 Cooldown.ActiveSkill 태그를 가진 Effect 쿼리
 	FGameplayEffectQuery Query;
@@ -161,7 +163,7 @@ void UActiveSkillWidget::UpdateCooldown()
 
 	if (DebugCounter % 60 == 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("UpdateCooldown: Cooldown.ActiveSkill 태그를 가진 Effect 개수: %d"), ActiveCooldowns.Num());
+		UE_LOG(LogFPSUI, Log, TEXT("UpdateCooldown: Cooldown.ActiveSkill 태그를 가진 Effect 개수: %d"), ActiveCooldowns.Num());
 	}
 
 	if (ActiveCooldowns.Num() == 0)
@@ -178,7 +180,7 @@ void UActiveSkillWidget::UpdateCooldown()
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget: 쿨다운 감지! 활성 쿨다운 개수: %d"), ActiveCooldowns.Num());
+	UE_LOG(LogFPSUI, Log, TEXT("ActiveSkillWidget: 쿨다운 감지! 활성 쿨다운 개수: %d"), ActiveCooldowns.Num());
 
 	// 가장 긴 쿨다운 시간 가져오기
 	float LongestCooldownTimeRemaining = 0.0f;
@@ -203,7 +205,7 @@ void UActiveSkillWidget::UpdateCooldown()
 	// 쿨다운 UI 표시
 	if (LongestCooldownTimeRemaining > 0.0f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget: 쿨다운 시간 - %.1f / %.1f초"),
+		UE_LOG(LogFPSUI, Log, TEXT("ActiveSkillWidget: 쿨다운 시간 - %.1f / %.1f초"),
 			LongestCooldownTimeRemaining, LongestCooldownDuration);
 
 		if (CooldownOverlay)
@@ -231,7 +233,7 @@ void UActiveSkillWidget::UpdateCooldown()
 			FString CooldownString = FString::Printf(TEXT("%.1f"), LongestCooldownTimeRemaining);
 			CooldownText->SetText(FText::FromString(CooldownString));
 
-			UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget: 쿨다운 텍스트 설정 완료 - %s"), *CooldownString);
+			UE_LOG(LogFPSUI, Log, TEXT("ActiveSkillWidget: 쿨다운 텍스트 설정 완료 - %s"), *CooldownString);
 		}
 	}
 	else
@@ -310,13 +312,13 @@ void UActiveSkillWidget::ShowSkillIcon()
 		if (CurrentActiveSkillData->SkillIcon)
 		{
 			SkillIconImage->SetBrushFromTexture(CurrentActiveSkillData->SkillIcon);
-			UE_LOG(LogTemp, Log, TEXT("ActiveSkillWidget: 스킬 아이콘 표시 - %s"),
+			UE_LOG(LogFPSUI, Log, TEXT("ActiveSkillWidget: 스킬 아이콘 표시 - %s"),
 				*CurrentActiveSkillData->SkillName.ToString());
 		}
 		else
 		{
 			// 기본 아이콘 또는 경고 표시
-			UE_LOG(LogTemp, Warning, TEXT("ActiveSkillWidget: 스킬 아이콘이 없음 - %s"),
+			UE_LOG(LogFPSUI, Warning, TEXT("ActiveSkillWidget: 스킬 아이콘이 없음 - %s"),
 				*CurrentActiveSkillData->SkillName.ToString());
 		}
 	}
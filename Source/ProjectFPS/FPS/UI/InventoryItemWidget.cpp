@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "InventoryItemWidget.h"
+#include "FPS/FPSLog.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
@@ -15,6 +16,7 @@
 #include "ToastManagerWidget.h"
 #include "../CharacterAttributeSet.h"
 #include "../GameplayEffect_InstantHeal.h"
+#include "FPS/FPSGameplayTags.h"
 
 UInventoryItemWidget::UInventoryItemWidget(const FObjectInitializer &ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -44,7 +46,7 @@ void UInventoryItemWidget::SetItemData(UBaseItemData *InItemData, int32 InGridX,
 			StackCountText->SetText(FText::FromString(StackText));
 			StackCountText->SetVisibility(ESlateVisibility::HitTestInvisible);
 
-			UE_LOG(LogTemp, Log, TEXT("스택 텍스트 설정: %s (StackCount: %d)"), *StackText, StackCount);
+			UE_LOG(LogFPSUI, Log, TEXT("스택 텍스트 설정: %s (StackCount: %d)"), *StackText, StackCount);
 		}
 		else
 		{
@@ -53,7 +55,7 @@ void UInventoryItemWidget::SetItemData(UBaseItemData *InItemData, int32 InGridX,
 
 			if (ItemData)
 			{
-				UE_LOG(LogTemp, Log, TEXT("스택 텍스트 숨김: %s (Stackable: %s, Count: %d)"),
+				UE_LOG(LogFPSUI, Log, TEXT("스택 텍스트 숨김: %s (Stackable: %s, Count: %d)"),
 					   *ItemData->GetItemName(),
 					   ItemData->IsStackable() ? TEXT("Yes") : TEXT("No"),
 					   StackCount);
@@ -62,7 +64,7 @@ void UInventoryItemWidget::SetItemData(UBaseItemData *InItemData, int32 InGridX,
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StackCountText가 null입니다. Blueprint에서 바인딩 확인 필요"));
+		UE_LOG(LogFPSUI, Warning, TEXT("StackCountText가 null입니다. Blueprint에서 바인딩 확인 필요"));
 	}
 }
 
@@ -91,7 +93,7 @@ void UInventoryItemWidget::NativeOnDragDetected(const FGeometry &InGeometry, con
 
 	if (!ItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("NativeOnDragDetected: ItemData가 없습니다"));
+		UE_LOG(LogFPSUI, Warning, TEXT("NativeOnDragDetected: ItemData가 없습니다"));
 		return;
 	}
 
@@ -99,7 +101,7 @@ void UInventoryItemWidget::NativeOnDragDetected(const FGeometry &InGeometry, con
 	UItemDragDropOperation *DragOp = NewObject<UItemDragDropOperation>();
 	if (!DragOp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("NativeOnDragDetected: DragDropOperation 생성 실패"));
+		UE_LOG(LogFPSUI, Error, TEXT("NativeOnDragDetected: DragDropOperation 생성 실패"));
 		return;
 	}
 
@@ -115,7 +117,7 @@ void UInventoryItemWidget::NativeOnDragDetected(const FGeometry &InGeometry, con
 
 	OutOperation = DragOp;
 
-	UE_LOG(LogTemp, Log, TEXT("드래그 시작: %s (%d, %d)"),
+	UE_LOG(LogFPSUI, Log, TEXT("드래그 시작: %s (%d, %d)"),
 		   *ItemData->GetItemName(), GridX, GridY);
 }
 
@@ -130,7 +132,7 @@ FReply UInventoryItemWidget::NativeOnMouseButtonUp(const FGeometry &InGeometry,
 		{
 			// 드래그 취소
 			UWidgetBlueprintLibrary::CancelDragDrop();
-			UE_LOG(LogTemp, Log, TEXT("우클릭으로 드래그 취소"));
+			UE_LOG(LogFPSUI, Log, TEXT("우클릭으로 드래그 취소"));
 			return FReply::Handled();
 		}
 	}
@@ -144,7 +146,7 @@ void UInventoryItemWidget::UseConsumableItem()
 	UConsumableItemData *ConsumableData = Cast<UConsumableItemData>(ItemData);
 	if (!ConsumableData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseConsumableItem: 소모품이 아닙니다."));
+		UE_LOG(LogFPSUI, Warning, TEXT("UseConsumableItem: 소모품이 아닙니다."));
 		return;
 	}
 
@@ -153,26 +155,26 @@ void UInventoryItemWidget::UseConsumableItem()
 	AFPSPlayerCharacter *PlayerCharacter = Cast<AFPSPlayerCharacter>(OwnerPawn);
 	if (!PlayerCharacter)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UseConsumableItem: PlayerCharacter를 찾을 수 없습니다."));
+		UE_LOG(LogFPSUI, Error, TEXT("UseConsumableItem: PlayerCharacter를 찾을 수 없습니다."));
 		return;
 	}
 
 	UAbilitySystemComponent *ASC = PlayerCharacter->GetAbilitySystemComponent();
 	if (!ASC)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UseConsumableItem: AbilitySystemComponent를 찾을 수 없습니다."));
+		UE_LOG(LogFPSUI, Error, TEXT("UseConsumableItem: AbilitySystemComponent를 찾을 수 없습니다."));
 		return;
 	}
 
 	// ConsumableEffect가 있는지 체크
 	if (!ConsumableData->ConsumableEffect)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UseConsumableItem: ConsumableEffect가 설정되지 않았습니다."));
+		UE_LOG(LogFPSUI, Warning, TEXT("UseConsumableItem: ConsumableEffect가 설정되지 않았습니다."));
 		return;
 	}
 
 	// "Ability.UseConsumable" 태그를 가진 Ability 찾기
-	FGameplayTag UseConsumableTag = FGameplayTag::RequestGameplayTag(FName("Ability.UseConsumable"));
+	FGameplayTag UseConsumableTag = FPSGameplayTags::Ability_UseConsumable;
 	FGameplayAbilitySpec *FoundSpec = nullptr;
 
 	for (FGameplayAbilitySpec &Spec : ASC->GetActivatableAbilities())
@@ -186,7 +188,7 @@ void UInventoryItemWidget::UseConsumableItem()
 
 	if (!FoundSpec)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UseConsumableItem: UseConsumable Ability를 찾을 수 없습니다. DefaultAbilities에 추가했는지 확인하세요."));
+		UE_LOG(LogFPSUI, Error, TEXT("UseConsumableItem: UseConsumable Ability를 찾을 수 없습니다. DefaultAbilities에 추가했는지 확인하세요."));
 		return;
 	}
 
@@ -194,7 +196,7 @@ void UInventoryItemWidget::UseConsumableItem()
 	UGameplayAbility_UseConsumable *UseConsumableAbility = Cast<UGameplayAbility_UseConsumable>(FoundSpec->GetPrimaryInstance());
 	if (!UseConsumableAbility)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UseConsumableItem: Ability 인스턴스를 가져올 수 없습니다."));
+		UE_LOG(LogFPSUI, Error, TEXT("UseConsumableItem: Ability 인스턴스를 가져올 수 없습니다."));
 		return;
 	}
 
@@ -208,7 +210,7 @@ void UInventoryItemWidget::UseConsumableItem()
 	bool bSuccess = ASC->TryActivateAbilitiesByTag(TagContainer);
 	if (bSuccess)
 	{
-		UE_LOG(LogTemp, Log, TEXT("포션 사용: %s"), *ConsumableData->GetItemName());
+		UE_LOG(LogFPSUI, Log, TEXT("포션 사용: %s"), *ConsumableData->GetItemName());
 	}
 	else
 	{
@@ -230,6 +232,6 @@ void UInventoryItemWidget::UseConsumableItem()
 			}
 		}
 
-		UE_LOG(LogTemp, Warning, TEXT("UseConsumableItem: Ability 활성화 실패"));
+		UE_LOG(LogFPSUI, Warning, TEXT("UseConsumableItem: Ability 활성화 실패"));
 	}
 }
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "InventoryWidget.h"
+#include "FPS/FPSLog.h"
 #include "Components/CanvasPanel.h"
 #include "Components/UniformGridPanel.h"
 #include "Components/UniformGridSlot.h"
@@ -161,7 +162,7 @@ void UInventoryWidget::AddItemImageToCanvas(UBaseItemData* ItemData, int32 GridX
 	// ItemWidgetClass가 설정되지 않은 경우 기본 이미지로 대체
 	if (!ItemWidgetClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AddItemImageToCanvas: ItemWidgetClass가 설정되지 않았습니다. 기본 Image 사용"));
+		UE_LOG(LogFPSUI, Warning, TEXT("AddItemImageToCanvas: ItemWidgetClass가 설정되지 않았습니다. 기본 Image 사용"));
 
 		// 기존 방식: UImage 사용 (드래그 불가능)
 		UImage* ItemImage = NewObject<UImage>(this);
@@ -179,7 +180,7 @@ void UInventoryWidget::AddItemImageToCanvas(UBaseItemData* ItemData, int32 GridX
 		UInventoryItemWidget* ItemWidget = CreateWidget<UInventoryItemWidget>(GetOwningPlayer(), ItemWidgetClass);
 		if (!ItemWidget)
 		{
-			UE_LOG(LogTemp, Error, TEXT("AddItemImageToCanvas: ItemWidget 생성 실패"));
+			UE_LOG(LogFPSUI, Error, TEXT("AddItemImageToCanvas: ItemWidget 생성 실패"));
 			return;
 		}
 
@@ -202,7 +203,7 @@ void UInventoryWidget::AddItemImageToCanvas(UBaseItemData* ItemData, int32 GridX
 	if (GridGeo.GetLocalSize().X <= 0.f || GridGeo.GetLocalSize().Y <= 0.f)
 	{
 		// 다음 틱에 다시
-		UE_LOG(LogTemp, Error, TEXT("AddItemImageToCanvas: Geometry가 아직 준비되지 않음!"));
+		UE_LOG(LogFPSUI, Error, TEXT("AddItemImageToCanvas: Geometry가 아직 준비되지 않음!"));
 		return;
 	}
 
@@ -270,11 +271,11 @@ bool UInventoryWidget::NativeOnDrop(const FGeometry& InGeometry, const FDragDrop
 
 	if (bSuccess)
 	{
-		UE_LOG(LogTemp, Log, TEXT("인벤토리 아이템 배치 성공"));
+		UE_LOG(LogFPSUI, Log, TEXT("인벤토리 아이템 배치 성공"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("인벤토리 아이템 배치 실패 - 원래 위치로 복구됨"));
+		UE_LOG(LogFPSUI, Warning, TEXT("인벤토리 아이템 배치 실패 - 원래 위치로 복구됨"));
 	}
 
 	return bSuccess;
@@ -314,12 +315,12 @@ void UInventoryWidget::NativeOnDragCancelled(const FDragDropEvent& InDragDropEve
 
 		if (bRestored)
 		{
-			UE_LOG(LogTemp, Log, TEXT("드래그 취소 - 아이템을 원래 위치(%d, %d)로 복구했습니다"),
+			UE_LOG(LogFPSUI, Log, TEXT("드래그 취소 - 아이템을 원래 위치(%d, %d)로 복구했습니다"),
 				DragOp->OriginGridX, DragOp->OriginGridY);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("드래그 취소 - 원래 위치로 복구 실패!"));
+			UE_LOG(LogFPSUI, Error, TEXT("드래그 취소 - 원래 위치로 복구 실패!"));
 		}
 	}
 
@@ -348,7 +349,7 @@ void UInventoryWidget::UpdateDragHighlight(const FVector2D& MousePosition)
 
 		if (Rect.ContainsPoint(MousePosition))
 		{
-			//UE_LOG(LogTemp, Log, TEXT("UpdateDragHighlight: Primary 무기 슬롯 영역! Mouse(%f,%f) Rect(%f,%f,%f,%f"),
+			//UE_LOG(LogFPSUI, Log, TEXT("UpdateDragHighlight: Primary 무기 슬롯 영역! Mouse(%f,%f) Rect(%f,%f,%f,%f"),
 			//	MousePosition.X, MousePosition.Y, Rect.Left, Rect.Top, Rect.Right, Rect.Bottom);
 			UpdateWeaponSlotHighlight(MousePosition, PrimaryWeaponSlot);
 			return;
@@ -364,7 +365,7 @@ void UInventoryWidget::UpdateDragHighlight(const FVector2D& MousePosition)
 
 		if (Rect.ContainsPoint(MousePosition))
 		{
-			//UE_LOG(LogTemp, Log, TEXT("UpdateDragHighlight: Secondary 무기 슬롯 영역! Mouse(%f,%f) Rect(%f,%f,%f,%f"),
+			//UE_LOG(LogFPSUI, Log, TEXT("UpdateDragHighlight: Secondary 무기 슬롯 영역! Mouse(%f,%f) Rect(%f,%f,%f,%f"),
 			//	MousePosition.X, MousePosition.Y, Rect.Left, Rect.Top, Rect.Right, Rect.Bottom);
 			UpdateWeaponSlotHighlight(MousePosition, SecondaryWeaponSlot);
 			return;
@@ -377,7 +378,7 @@ void UInventoryWidget::UpdateDragHighlight(const FVector2D& MousePosition)
 
 	if (GridPos.X < 0 || GridPos.Y < 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("UpdateDragHighlight: 마우스 좌표가 영역 밖!"));
+		UE_LOG(LogFPSUI, Log, TEXT("UpdateDragHighlight: 마우스 좌표가 영역 밖!"));
 		return;
 	}
 
@@ -400,7 +401,7 @@ void UInventoryWidget::UpdateDragHighlight(const FVector2D& MousePosition)
 			UWidget* OriginCell = GridPanel->GetChildAt(GridPos.X + GridPos.Y * InventoryComponent->GetGridWidth());
 			if (!OriginCell)
 			{
-				UE_LOG(LogTemp, Log, TEXT("UpdateDragHighlight: GridPanel GetChildAt 실패! (%d, %d)"), GridPos.X, GridPos.Y);
+				UE_LOG(LogFPSUI, Log, TEXT("UpdateDragHighlight: GridPanel GetChildAt 실패! (%d, %d)"), GridPos.X, GridPos.Y);
 				return;
 			}
 			const FGeometry& OriginGeo = OriginCell->GetCachedGeometry();
@@ -417,14 +418,14 @@ void UInventoryWidget::UpdateDragHighlight(const FVector2D& MousePosition)
 				UWidget* EdgeCell = GridPanel->GetChildAt(EdgeGridX + EdgeGridY * InventoryComponent->GetGridWidth());
 				if (!EdgeCell)
 				{
-					UE_LOG(LogTemp, Log, TEXT("UpdateDragHighlight: GridPanel EdgeCell GetChildAt 실패! (%d, %d)"), EdgeGridX, EdgeGridY);
+					UE_LOG(LogFPSUI, Log, TEXT("UpdateDragHighlight: GridPanel EdgeCell GetChildAt 실패! (%d, %d)"), EdgeGridX, EdgeGridY);
 					return;
 				}
 				const FGeometry& EdgeGeo = EdgeCell->GetCachedGeometry();
 				FVector2D EdgeSlotScreenPosition = EdgeGeo.GetAbsolutePosition();
 				FVector2D EdgeLocalPosition = GetCachedGeometry().AbsoluteToLocal(EdgeSlotScreenPosition);
 				GridSlotSize = FVector2D(EdgeLocalPosition.X - LocalPosition.X, EdgeLocalPosition.Y - LocalPosition.Y) + GridSlotSize;
-				UE_LOG(LogTemp, Warning, TEXT("UpdateDragHighlight: Image Size (%f, %f)"), GridSlotSize.X, GridSlotSize.Y);
+				UE_LOG(LogFPSUI, Warning, TEXT("UpdateDragHighlight: Image Size (%f, %f)"), GridSlotSize.X, GridSlotSize.Y);
 			}
 			
 			HighlightSlot->SetPosition(LocalPosition);
@@ -485,7 +486,7 @@ void UInventoryWidget::HideDragHighlight()
 
 FIntPoint UInventoryWidget::GetGridPosFromMouse(const FVector2D& MousePosition) const
 {
-	UE_LOG(LogTemp, Log, TEXT("GetGridPosFromMouse Mouse(%f, %f)"), MousePosition.X, MousePosition.Y);
+	UE_LOG(LogFPSUI, Log, TEXT("GetGridPosFromMouse Mouse(%f, %f)"), MousePosition.X, MousePosition.Y);
 
 	if (!GridPanel || !InventoryComponent) return FIntPoint(-1,-1);
 
@@ -509,7 +510,7 @@ FIntPoint UInventoryWidget::GetGridPosFromMouse(const FVector2D& MousePosition)
 		GridY = FMath::Clamp(GridY, 0, InventoryComponent->GetGridHeight() - 1);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("GetGridPosFromMouse Grid(%d, %d)"), GridX, GridY);
+	UE_LOG(LogFPSUI, Log, TEXT("GetGridPosFromMouse Grid(%d, %d)"), GridX, GridY);
 	return FIntPoint(GridX, GridY);
 }
 
@@ -558,7 +559,7 @@ bool UInventoryWidget::TryPlaceItemAtMouse(const FGeometry& MyGeometry, const FV
 		// 무기 슬롯에서 해제
 		WeaponSlotComponent->UnequipWeaponFromSlot(DragOp->OriginWeaponSlot);
 		RefreshWeaponSlots();
-		UE_LOG(LogTemp, Log, TEXT("무기 슬롯 → 그리드 배치 성공"));
+		UE_LOG(LogFPSUI, Log, TEXT("무기 슬롯 → 그리드 배치 성공"));
 	}
 
 	return bSuccess;
@@ -572,13 +573,13 @@ void UInventoryWidget::CreateGridBackground()
 {
 	if (!GridPanel)
 	{
-		UE_LOG(LogTemp, Error, TEXT("CreateGridBackground: GridPanel이 nullptr입니다! BindWidget 확인 필요"));
+		UE_LOG(LogFPSUI, Error, TEXT("CreateGridBackground: GridPanel이 nullptr입니다! BindWidget 확인 필요"));
 		return;
 	}
 
 	if (!InventoryComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("CreateGridBackground: InventoryComponent가 nullptr입니다!"));
+		UE_LOG(LogFPSUI, Error, TEXT("CreateGridBackground: InventoryComponent가 nullptr입니다!"));
 		return;
 	}
 
@@ -586,7 +587,7 @@ void UInventoryWidget::CreateGridBackground()
 	const int32 GridWidth = InventoryComponent->GetGridWidth();
 	const int32 GridHeight = InventoryComponent->GetGridHeight();
 
-	UE_LOG(LogTemp, Warning, TEXT("CreateGridBackground 시작: %dx%d 그리드 생성"), GridWidth, GridHeight);
+	UE_LOG(LogFPSUI, Warning, TEXT("CreateGridBackground 시작: %dx%d 그리드 생성"), GridWidth, GridHeight);
 
 	// 8x6 = 48개의 Border 생성
 	for (int32 Y = 0; Y < GridHeight; ++Y)
@@ -597,7 +598,7 @@ void UInventoryWidget::CreateGridBackground()
 			UBorder* GridCellBorder = NewObject<UBorder>(this);
 			if (!GridCellBorder)
 			{
-				UE_LOG(LogTemp, Error, TEXT("GridCellBorder 생성 실패: (%d, %d)"), X, Y);
+				UE_LOG(LogFPSUI, Error, TEXT("GridCellBorder 생성 실패: (%d, %d)"), X, Y);
 				continue;
 			}
 
@@ -616,12 +617,12 @@ void UInventoryWidget::CreateGridBackground()
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("GridSlot 생성 실패: (%d, %d)"), X, Y);
+				UE_LOG(LogFPSUI, Error, TEXT("GridSlot 생성 실패: (%d, %d)"), X, Y);
 			}
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("CreateGridBackground 완료: %dx%d = %d개 Border 생성"), GridWidth, GridHeight, GridWidth * GridHeight);
+	UE_LOG(LogFPSUI, Warning, TEXT("CreateGridBackground 완료: %dx%d = %d개 Border 생성"), GridWidth, GridHeight, GridWidth * GridHeight);
 }
 
 void UInventoryWidget::MeasureActualSlotSize()
@@ -634,7 +635,7 @@ void UInventoryWidget::MeasureActualSlotSize()
 	const int32 ExpectedChildCount = InventoryComponent->GetGridWidth() * InventoryComponent->GetGridHeight();
 	if (GridPanel->GetChildrenCount() != ExpectedChildCount)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MeasureActualSlotSize: 자식 개수 불일치 (현재: %d, 예상: %d)"),
+		UE_LOG(LogFPSUI, Warning, TEXT("MeasureActualSlotSize: 자식 개수 불일치 (현재: %d, 예상: %d)"),
 			GridPanel->GetChildrenCount(), ExpectedChildCount);
 		return;
 	}
@@ -645,7 +646,7 @@ void UInventoryWidget::MeasureActualSlotSize()
 	// 크기가 유효하지 않으면 다음 프레임에 다시 시도
 	if (GridPanelSize.X <= 0.0f || GridPanelSize.Y <= 0.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MeasureActualSlotSize: GridPanel 크기가 아직 유효하지 않음 (%.2f x %.2f)"),
+		UE_LOG(LogFPSUI, Warning, TEXT("MeasureActualSlotSize: GridPanel 크기가 아직 유효하지 않음 (%.2f x %.2f)"),
 			GridPanelSize.X, GridPanelSize.Y);
 		return;
 	}
@@ -654,7 +655,7 @@ void UInventoryWidget::MeasureActualSlotSize()
 	UWidget* FirstCell = GridPanel->GetChildAt(0);
 	if (!FirstCell)
 	{
-		UE_LOG(LogTemp, Error, TEXT("MeasureActualSlotSize: 첫 번째 셀을 가져올 수 없음"));
+		UE_LOG(LogFPSUI, Error, TEXT("MeasureActualSlotSize: 첫 번째 셀을 가져올 수 없음"));
 		return;
 	}
 
@@ -663,7 +664,7 @@ void UInventoryWidget::MeasureActualSlotSize()
 	// Geometry가 아직 유효하지 않으면 다음 프레임에 다시 시도
 	if (CellSize.X <= 0.0f || CellSize.Y <= 0.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MeasureActualSlotSize: 셀 크기가 아직 유효하지 않음 (%.2f x %.2f)"),
+		UE_LOG(LogFPSUI, Warning, TEXT("MeasureActualSlotSize: 셀 크기가 아직 유효하지 않음 (%.2f x %.2f)"),
 			CellSize.X, CellSize.Y);
 		return;
 	}
@@ -685,18 +686,18 @@ void UInventoryWidget::MeasureActualSlotSize()
 	if (ActualSlotWidth <= 0.0f || ActualSlotHeight <= 0.0f ||
 		ActualSlotPaddingWidth < 0.0f || ActualSlotPaddingHeight < 0.0f)
 	{
-		UE_LOG(LogTemp, Error, TEXT("MeasureActualSlotSize: 계산된 값이 잘못됨 (셀: %.2f x %.2f, 패딩: %.2f x %.2f)"),
+		UE_LOG(LogFPSUI, Error, TEXT("MeasureActualSlotSize: 계산된 값이 잘못됨 (셀: %.2f x %.2f, 패딩: %.2f x %.2f)"),
 			ActualSlotWidth, ActualSlotHeight, ActualSlotPaddingWidth, ActualSlotPaddingHeight);
 		return;
 	}
 
 	bSlotSizeMeasured = true;
 
-	UE_LOG(LogTemp, Warning, TEXT("MeasureActualSlotSize: GridPanel 크기 = %.2f x %.2f"),
+	UE_LOG(LogFPSUI, Warning, TEXT("MeasureActualSlotSize: GridPanel 크기 = %.2f x %.2f"),
 		GridPanelSize.X, GridPanelSize.Y);
-	UE_LOG(LogTemp, Warning, TEXT("MeasureActualSlotSize: 계산된 셀 크기 = %.2f x %.2f (기본값: %.2f)"),
+	UE_LOG(LogFPSUI, Warning, TEXT("MeasureActualSlotSize: 계산된 셀 크기 = %.2f x %.2f (기본값: %.2f)"),
 		ActualSlotWidth, ActualSlotHeight, SlotSize);
-	UE_LOG(LogTemp, Warning, TEXT("MeasureActualSlotSize: 계산된 패딩 = %.2f x %.2f (기본값: %.2f)"),
+	UE_LOG(LogFPSUI, Warning, TEXT("MeasureActualSlotSize: 계산된 패딩 = %.2f x %.2f (기본값: %.2f)"),
 		ActualSlotPaddingWidth, ActualSlotPaddingHeight, SlotPadding);
 
 	// 셀 크기가 측정되었으므로 인벤토리 다시 그리기
@@ -736,7 +737,7 @@ void UInventoryWidget::OnCloseButtonClicked()
 
 void UInventoryWidget::RefreshWeaponSlots()
 {
-	UE_LOG(LogTemp, Log, TEXT("RefreshWeaponSlots:"));
+	UE_LOG(LogFPSUI, Log, TEXT("RefreshWeaponSlots:"));
 	if (!WeaponSlotComponent)
 	{
 		return;
@@ -748,12 +749,12 @@ void UInventoryWidget::RefreshWeaponSlots()
 		UWeaponItemData* PrimaryWeapon = WeaponSlotComponent->GetWeaponInSlot(EWeaponSlot::Primary);
 		if (PrimaryWeapon)
 		{
-			UE_LOG(LogTemp, Log, TEXT("RefreshWeaponSlots: PrimaryWeaponSlot SetWeaponIcon"));
+			UE_LOG(LogFPSUI, Log, TEXT("RefreshWeaponSlots: PrimaryWeaponSlot SetWeaponIcon"));
 			PrimaryWeaponSlot->SetWeaponIcon(PrimaryWeapon);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Log, TEXT("RefreshWeaponSlots: PrimaryWeaponSlot ClearWeaponIcon"));
+			UE_LOG(LogFPSUI, Log, TEXT("RefreshWeaponSlots: PrimaryWeaponSlot ClearWeaponIcon"));
 			PrimaryWeaponSlot->ClearWeaponIcon();
 		}
 	}
@@ -764,12 +765,12 @@ void UInventoryWidget::RefreshWeaponSlots()
 		UWeaponItemData* SecondaryWeapon = WeaponSlotComponent->GetWeaponInSlot(EWeaponSlot::Secondary);
 		if (SecondaryWeapon)
 		{
-			UE_LOG(LogTemp, Log, TEXT("RefreshWeaponSlots: SecondaryWeapon SetWeaponIcon"));
+			UE_LOG(LogFPSUI, Log, TEXT("RefreshWeaponSlots: SecondaryWeapon SetWeaponIcon"));
 			SecondaryWeaponSlot->SetWeaponIcon(SecondaryWeapon);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Log, TEXT("RefreshWeaponSlots: SecondaryWeapon ClearWeaponIcon"));
+			UE_LOG(LogFPSUI, Log, TEXT("RefreshWeaponSlots: SecondaryWeapon ClearWeaponIcon"));
 			SecondaryWeaponSlot->ClearWeaponIcon();
 		}
 	}
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPS/UI/PlayerHUD.h"
+#include "FPS/FPSLog.h"
 #include "Components/TextBlock.h"
 #include "Components/ProgressBar.h"
 #include "Components/Image.h"
@@ -68,7 +69,7 @@ void UPlayerHUD::NativeConstruct()
     CurrentCrosshairSpread = BaseCrosshairSpread;
     TargetCrosshairSpread = BaseCrosshairSpread;
 
-    UE_LOG(LogTemp, Log, TEXT("PlayerHUD 초기화 완료 (체력/스태미나/무기/크로스헤어)"));
+    UE_LOG(LogFPSUI, Log, TEXT("PlayerHUD 초기화 완료 (체력/스태미나/무기/크로스헤어)"));
 }
 
 void UPlayerHUD::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
@@ -104,7 +105,7 @@ void UPlayerHUD::UpdateAmmoDisplay(int32 CurrentAmmo, int32 MaxAmmo)
 {
     if (!AmmoText)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AmmoText가 null입니다!"));
+        UE_LOG(LogFPSUI, Warning, TEXT("AmmoText가 null입니다!"));
         return;
     }
 
@@ -136,14 +137,14 @@ void UPlayerHUD::UpdateAmmoDisplay(int32 CurrentAmmo, int32 MaxAmmo)
         AmmoText->SetColorAndOpacity(DefaultTextColor);
     }
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("탄약 표시 업데이트: %s"), *AmmoString);
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("탄약 표시 업데이트: %s"), *AmmoString);
 }
 
 void UPlayerHUD::UpdateWeaponName(const FString &WeaponName)
 {
     if (!WeaponNameText)
     {
-        UE_LOG(LogTemp, Warning, TEXT("WeaponNameText가 null입니다!"));
+        UE_LOG(LogFPSUI, Warning, TEXT("WeaponNameText가 null입니다!"));
         return;
     }
 
@@ -158,7 +159,7 @@ void UPlayerHUD::UpdateWeaponName(const FString &WeaponName)
 
     WeaponNameText->SetColorAndOpacity(DefaultTextColor);
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("무기 이름 업데이트: %s"), *WeaponName);
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("무기 이름 업데이트: %s"), *WeaponName);
 }
 
 void UPlayerHUD::UpdateWeaponSlots(const FString &PrimaryWeapon, const FString &SecondaryWeapon, int32 ActiveSlot)
@@ -201,7 +202,7 @@ void UPlayerHUD::UpdateWeaponSlots(const FString &PrimaryWeapon, const FString &
 
     // 현재 활성무기가 없다면 (BaseCrosshairSpread는 OnWeaponDeactivated에서 0으로 설정됨)
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("무기 슬롯 업데이트: P=%s, S=%s, Active=%d"),
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("무기 슬롯 업데이트: P=%s, S=%s, Active=%d"),
            *PrimaryWeapon, *SecondaryWeapon, ActiveSlot);
 }
 
@@ -209,7 +210,7 @@ void UPlayerHUD::RefreshWeaponHUD()
 {
     // 외부에서 호출하여 전체 HUD 갱신
     // WeaponSlotComponent에서 현재 상태를 가져와서 업데이트
-    UE_LOG(LogTemp, Log, TEXT("WeaponHUD 전체 갱신 요청"));
+    UE_LOG(LogFPSUI, Log, TEXT("WeaponHUD 전체 갱신 요청"));
 
     // TODO: WeaponSlotComponent에서 현재 상태 정보를 가져와서 업데이트
     // 지금은 기본 구조만 만들어둠
@@ -220,7 +221,7 @@ void UPlayerHUD::UpdateHealthBar(float CurrentHealth, float MaxHealth)
 {
     if (!HealthBar)
     {
-        UE_LOG(LogTemp, Warning, TEXT("HealthBar가 null입니다!"));
+        UE_LOG(LogFPSUI, Warning, TEXT("HealthBar가 null입니다!"));
         return;
     }
 
@@ -254,17 +255,17 @@ void UPlayerHUD::UpdateHealthBar(float CurrentHealth, float MaxHealth)
     {
         float NewWidth = MaxHealth * 4.0f;  // 100 MaxHealth = 400px
         HealthBarSizeBox->SetWidthOverride(NewWidth);
-        UE_LOG(LogTemp, Log, TEXT("HealthBar Width 조정: %.0fpx (MaxHealth=%.0f)"), NewWidth, MaxHealth);
+        UE_LOG(LogFPSUI, Log, TEXT("HealthBar Width 조정: %.0fpx (MaxHealth=%.0f)"), NewWidth, MaxHealth);
     }
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("체력 바 업데이트: %.0f / %.0f (%.1f%%)"), CurrentHealth, MaxHealth, HealthPercent * 100.0f);
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("체력 바 업데이트: %.0f / %.0f (%.1f%%)"), CurrentHealth, MaxHealth, HealthPercent * 100.0f);
 }
 
 void UPlayerHUD::UpdateStaminaBar(float CurrentStamina, float MaxStamina)
 {
     if (!StaminaBar)
     {
-        UE_LOG(LogTemp, Warning, TEXT("StaminaBar가 null입니다!"));
+        UE_LOG(LogFPSUI, Warning, TEXT("StaminaBar가 null입니다!"));
         return;
     }
 
@@ -284,17 +285,17 @@ void UPlayerHUD::UpdateStaminaBar(float CurrentStamina, float MaxStamina)
     {
         float NewWidth = MaxStamina * 4.0f;  // 100 MaxStamina = 400px
         StaminaBarSizeBox->SetWidthOverride(NewWidth);
-        UE_LOG(LogTemp, VeryVerbose, TEXT("StaminaBar Width 조정: %.0fpx (MaxStamina=%.0f)"), NewWidth, MaxStamina);
+        UE_LOG(LogFPSUI, VeryVerbose, TEXT("StaminaBar Width 조정: %.0fpx (MaxStamina=%.0f)"), NewWidth, MaxStamina);
     }
 
-    UE_LOG(LogTemp, VeryVerbose, TEXT("스태미나 바 업데이트: %.0f / %.0f (%.1f%%)"), CurrentStamina, MaxStamina, StaminaPercent * 100.0f);
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("스태미나 바 업데이트: %.0f / %.0f (%.1f%%)"), CurrentStamina, MaxStamina, StaminaPercent * 100.0f);
 }
 
 void UPlayerHUD::UpdateShieldBar(float CurrentShield, float MaxShield)
 {
     if (!ShieldBar)
     {
-        UE_LOG(LogTemp, Warning, TEXT("ShieldBar가 null입니다!"));
+        UE_LOG(LogFPSUI, Warning, TEXT("ShieldBar가 null입니다!"));
         return;
     }
 
@@ -304,7 +305,7 @@ void UPlayerHUD::UpdateShieldBar(float CurrentShield, float MaxShield)
         if (ShieldBarBorder)
         {
             ShieldBarBorder->SetVisibility(ESlateVisibility::Collapsed);
-            UE_LOG(LogTemp, Log, TEXT("쉴드 스킬 미개방 - ShieldBarBorder 숨김"));
+            UE_LOG(LogFPSUI, Log, TEXT("쉴드 스킬 미개방 - ShieldBarBorder 숨김"));
         }
         return;
     }
@@ -313,7 +314,7 @@ void UPlayerHUD::UpdateShieldBar(float CurrentShield, float MaxShield)
     if (ShieldBarBorder)
     {
         ShieldBarBorder->SetVisibility(ESlateVisibility::Visible);
-        UE_LOG(LogTemp, Warning, TEXT("ShieldBarBorder를 Visible로 설정! CurrentShield=%.0f, MaxShield=%.0f"), CurrentShield, MaxShield);
+        UE_LOG(LogFPSUI, Warning, TEXT("ShieldBarBorder를 Visible로 설정! CurrentShield=%.0f, MaxShield=%.0f"), CurrentShield, MaxShield);
     }
 
     // 쉴드 퍼센트 계산
@@ -325,10 +326,10 @@ void UPlayerHUD::UpdateShieldBar(float CurrentShield, float MaxShield)
     {
         float NewWidth = MaxShield * 2.0f;  // 50 MaxShield = 100px
         ShieldBarSizeBox->SetWidthOverride(NewWidth);
-        UE_LOG(LogTemp, Log, TEXT("ShieldBar Width 조정: %.0fpx (MaxShield=%.0f)"), NewWidth, MaxShield);
+        UE_LOG(LogFPSUI, Log, TEXT("ShieldBar Width 조정: %.0fpx (MaxShield=%.0f)"), NewWidth, MaxShield);
     }
 
-    UE_LOG(LogTemp, Log, TEXT("쉴드 바 업데이트: %.0f / %.0f (%.1f%%)"), CurrentShield, MaxShield, ShieldPercent * 100.0f);
+    UE_LOG(LogFPSUI, Log, TEXT("쉴드 바 업데이트: %.0f / %.0f (%.1f%%)"), CurrentShield, MaxShield, ShieldPercent * 100.0f);
 }
 
 // === 크로스헤어 업데이트 구현 ===
@@ -336,19 +337,19 @@ void UPlayerHUD::SetCrosshairFiringSpread(float Spread)
 {
     // 발사 확산 설정 (현재 값보다 크면 갱신)
     FiringSpreadAmount = FMath::Max(FiringSpreadAmount, Spread);
-    UE_LOG(LogTemp, VeryVerbose, TEXT("크로스헤어 발사 확산: %.1f"), FiringSpreadAmount);
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("크로스헤어 발사 확산: %.1f"), FiringSpreadAmount);
 }
 
 void UPlayerHUD::SetCrosshairMovementSpread(float Spread)
 {
     // 이동 확산 설정
     MovementSpreadAmount = Spread;
-    UE_LOG(LogTemp, VeryVerbose, TEXT("크로스헤어 이동 확산: %.1f"), MovementSpreadAmount);
+    UE_LOG(LogFPSUI, VeryVerbose, TEXT("크로스헤어 이동 확산: %.1f"), MovementSpreadAmount);
 }
 
 void UPlayerHUD::SetBaseCrosshairSpread(float NewBaseSpread)
 {
     // 기본 크로스헤어 확산 설정 (무기 교체 시)
     BaseCrosshairSpread = NewBaseSpread;
-    UE_LOG(LogTemp, Log, TEXT("크로스헤어 기본 확산 변경: %.1f"), BaseCrosshairSpread);
+    UE_LOG(LogFPSUI, Log, TEXT("크로스헤어 기본 확산 변경: %.1f"), BaseCrosshairSpread);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 // SkillItemWidget.cpp
 
 #include "UI/SkillItemWidget.h"
+#include "FPS/FPSLog.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Components/Image.h"
@@ -30,7 +31,7 @@ void USkillItemWidget::SetSkillData(UBaseSkillData* InSkillData, USkillComponent
 
 	if (!SkillData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SetSkillData: SkillData가 nullptr입니다."));
+		UE_LOG(LogFPSUI, Warning, TEXT("SetSkillData: SkillData가 nullptr입니다."));
 		return;
 	}
 
@@ -105,18 +106,18 @@ void USkillItemWidget::OnLearnButtonClicked()
 	// 스킬 습득 시도
 	if (SkillComponent->LearnSkill(SkillData->SkillID))
 	{
-		UE_LOG(LogTemp, Log, TEXT("스킬 습득 성공: %s"), *SkillData->SkillName.ToString());
+		UE_LOG(LogFPSUI, Log, TEXT("스킬 습득 성공: %s"), *SkillData->SkillName.ToString());
 
 		// 부모 SkillTreeWidget의 RefreshSkillList 호출하여 전체 UI 갱신
 		if (USkillTreeWidget* SkillTreeWidget = Cast<USkillTreeWidget>(ParentSkillTreeWidget))
 		{
 			SkillTreeWidget->RefreshSkillList();
-			UE_LOG(LogTemp, Log, TEXT("스킬트리 UI 갱신 완료"));
+			UE_LOG(LogFPSUI, Log, TEXT("스킬트리 UI 갱신 완료"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("스킬 습득 실패: %s"), *SkillData->SkillName.ToString());
+		UE_LOG(LogFPSUI, Warning, TEXT("스킬 습득 실패: %s"), *SkillData->SkillName.ToString());
 	}
 }
 
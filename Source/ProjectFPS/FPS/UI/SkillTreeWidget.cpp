@@ -1,6 +1,7 @@
 // SkillTreeWidget.cpp
 
 #include "UI/SkillTreeWidget.h"
+#include "FPS/FPSLog.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
 #include "Components/TextBlock.h"
@@ -31,7 +32,7 @@ void USkillTreeWidget::InitializeSkillTree(USkillComponent* InSkillComponent)
 
 	if (!SkillComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("InitializeSkillTree: SkillComponent가 nullptr입니다."));
+		UE_LOG(LogFPSUI, Warning, TEXT("InitializeSkillTree: SkillComponent가 nullptr입니다."));
 		return;
 	}
 
@@ -43,7 +44,7 @@ void USkillTreeWidget::RefreshSkillList()
 {
 	if (!SkillComponent || !SkillTreeCanvas || !SkillItemWidgetClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("RefreshSkillList: SkillTreeCanvas 또는 SkillItemWidgetClass가 nullptr입니다."));
+		UE_LOG(LogFPSUI, Warning, TEXT("RefreshSkillList: SkillTreeCanvas 또는 SkillItemWidgetClass가 nullptr입니다."));
 		return;
 	}
 
@@ -105,7 +106,7 @@ void USkillTreeWidget::RefreshSkillList()
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("RefreshSkillList: %d개의 스킬을 트리 구조로 표시"), AllSkills.Num());
+	UE_LOG(LogFPSUI, Log, TEXT("RefreshSkillList: %d개의 스킬을 트리 구조로 표시"), AllSkills.Num());
 }
 
 void USkillTreeWidget::UpdateSkillPointDisplay(int32 CurrentPoints)
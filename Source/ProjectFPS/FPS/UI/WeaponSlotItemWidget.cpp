@@ -2,6 +2,7 @@
 
 
 #include "UI/WeaponSlotItemWidget.h"
+#include "FPS/FPSLog.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/WeaponSlotComponent.h"
@@ -85,7 +86,7 @@ void UWeaponSlotItemWidget::NativeOnDragDetected(const FGeometry& InGeometry, co
 
 	if (!CurrentWeaponData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("NativeOnDragDetected: CurrentWeaponData가 없습니다"));
+		UE_LOG(LogFPSUI, Warning, TEXT("NativeOnDragDetected: CurrentWeaponData가 없습니다"));
 		return;
 	}
 
@@ -93,7 +94,7 @@ void UWeaponSlotItemWidget::NativeOnDragDetected(const FGeometry& InGeometry, co
 	UItemDragDropOperation* DragOp = NewObject<UItemDragDropOperation>();
 	if (!DragOp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("NativeOnDragDetected: DragDropOperation 생성 실패"));
+		UE_LOG(LogFPSUI, Error, TEXT("NativeOnDragDetected: DragDropOperation 생성 실패"));
 		return;
 	}
 
@@ -103,7 +104,7 @@ void UWeaponSlotItemWidget::NativeOnDragDetected(const FGeometry& InGeometry, co
 
 	OutOperation = DragOp;
 
-	UE_LOG(LogTemp, Log, TEXT("무기 슬롯에서 드래그 시작: %s"), *CurrentWeaponData->GetItemName());
+	UE_LOG(LogFPSUI, Log, TEXT("무기 슬롯에서 드래그 시작: %s"), *CurrentWeaponData->GetItemName());
 }
 
 bool UWeaponSlotItemWidget::NativeOnDrop(const FGeometry& InGeometry, const FDragDropEvent& InDragDropEvent, UDragDropOperation* InOperation)
@@ -118,18 +119,18 @@ bool UWeaponSlotItemWidget::NativeOnDrop(const FGeometry& InGeometry, const FDra
 	UWeaponItemData* WeaponData = Cast<UWeaponItemData>(DragOp->DraggedItem);
 	if (!WeaponData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("무기 슬롯에는 무기만 배치할 수 있습니다"));
+		UE_LOG(LogFPSUI, Warning, TEXT("무기 슬롯에는 무기만 배치할 수 있습니다"));
 		return false;
 	}
 
 	// 같은 슬롯에 드롭하면 취소
 	if (DragOp->DragSource == EItemDragSource::WeaponSlot && DragOp->OriginWeaponSlot == SlotType)
 	{
-		UE_LOG(LogTemp, Log, TEXT("같은 슬롯에 드롭 - 취소"));
+		UE_LOG(LogFPSUI, Log, TEXT("같은 슬롯에 드롭 - 취소"));
 		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("무기 슬롯 OnDrop: %s → %s 슬롯 (From: %d)"),
+	UE_LOG(LogFPSUI, Log, TEXT("무기 슬롯 OnDrop: %s → %s 슬롯 (From: %d)"),
 		*WeaponData->GetItemName(),
 		(SlotType == EWeaponSlot::Primary) ? TEXT("Primary") : TEXT("Secondary"),
 		(int32)DragOp->DragSource);
@@ -137,7 +138,7 @@ bool UWeaponSlotItemWidget::NativeOnDrop(const FGeometry& InGeometry, const FDra
 	// 컴포넌트가 없으면 실패
 	if (!WeaponSlotComponent || !InventoryComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("WeaponSlotComponent 또는 InventoryComponent가 없습니다!"));
+		UE_LOG(LogFPSUI, Error, TEXT("WeaponSlotComponent 또는 InventoryComponent가 없습니다!"));
 		return false;
 	}
 
@@ -155,11 +156,11 @@ bool UWeaponSlotItemWidget::NativeOnDrop(const FGeometry& InGeometry, const FDra
 
 		if (bSuccess)
 		{
-			UE_LOG(LogTemp, Log, TEXT("무기 슬롯 <교환> 성공"));
+			UE_LOG(LogFPSUI, Log, TEXT("무기 슬롯 <교환> 성공"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("무기 슬롯 <교환> 실패"));
+			UE_LOG(LogFPSUI, Warning, TEXT("무기 슬롯 <교환> 실패"));
 		}
 	}
 	else
@@ -181,7 +182,7 @@ bool UWeaponSlotItemWidget::NativeOnDrop(const FGeometry& InGeometry, const FDra
 
 		if (bSuccess)
 		{
-			UE_LOG(LogTemp, Log, TEXT("무기 슬롯 <장착> 성공"));
+			UE_LOG(LogFPSUI, Log, TEXT("무기 슬롯 <장착> 성공"));
 		}
 		else
 		{
@@ -194,7 +195,7 @@ bool UWeaponSlotItemWidget::NativeOnDrop(const FGeometry& InGeometry, const FDra
 			{
 				WeaponSlotComponent->EquipWeaponToSlot(DragOp->OriginWeaponSlot, WeaponData);
 			}
-			UE_LOG(LogTemp, Warning, TEXT("무기 슬롯 <장착> 실패 - 원래 위치 복구"));
+			UE_LOG(LogFPSUI, Warning, TEXT("무기 슬롯 <장착> 실패 - 원래 위치 복구"));
 		}
 	}
 
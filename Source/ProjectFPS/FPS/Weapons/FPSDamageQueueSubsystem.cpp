@@ -0,0 +1,95 @@
+// FPSDamageQueueSubsystem.cpp
+
+#include "FPSDamageQueueSubsystem.h"
+#include "FPSProjectile.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+void UFPSDamageQueueSubsystem::Deinitialize()
+{
+	PendingDamage.Empty();
+	PendingIndexByKey.Empty();
+	ProcessingDamage.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSDamageQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSDamageQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSDamageQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSDamageQueueSubsystem::QueueDamage(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> DamageEffectClass,
+	float DamageAmount, bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount)
+{
+	if (!TargetASC || !DamageEffectClass)
+	{
+		return;
+	}
+
+	const FDamageKey Key{ TargetASC, DamageInstigator, DamageEffectClass.Get() };
+
+	int32& PendingIndex = PendingIndexByKey.FindOrAdd(Key, INDEX_NONE);
+	if (PendingIndex == INDEX_NONE)
+	{
+		PendingIndex = PendingDamage.AddDefaulted();
+
+		FPendingDamage& NewDamage = PendingDamage[PendingIndex];
+		NewDamage.TargetASC = TargetASC;
+		NewDamage.DamageEffectClass = DamageEffectClass;
+		NewDamage.Instigator = DamageInstigator;
+		NewDamage.DamageCauser = DamageCauser;
+	}
+
+	FPendingDamage& Pending = PendingDamage[PendingIndex];
+	Pending.TotalDamage += DamageAmount;
+	Pending.bAnyCritical |= bCritical;
+	Pending.HitCount += HitCount;
+
+	if (HitResult && !Pending.bHasHit)
+	{
+		Pending.FirstHit = *HitResult;
+		Pending.bHasHit = true;
+	}
+}
+
+void UFPSDamageQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	Flush();
+}
+
+void UFPSDamageQueueSubsystem::Flush()
+{
+	if (PendingDamage.Num() == 0)
+	{
+		return;
+	}
+
+	// 적용 중 발생한 명중(ex.사망 처리 중 폭발)은 다음 처리로 넘김
+	Swap(PendingDamage, ProcessingDamage);
+	PendingIndexByKey.Reset();
+
+	for (const FPendingDamage& Damage : ProcessingDamage)
+	{
+		UAbilitySystemComponent* TargetASC = Damage.TargetASC.Get();
+		if (!TargetASC)
+		{
+			continue;
+		}
+
+		// 대상별 GE 1회 실행 -> PostGameplayEffectExecute / 사망 판정도 1회
+		AFPSProjectile::ApplyDamageEffectToASC(TargetASC, Damage.DamageEffectClass, Damage.TotalDamage, Damage.bAnyCritical,
+			Damage.Instigator.Get(), Damage.DamageCauser.Get(), Damage.bHasHit ? &Damage.FirstHit : nullptr, Damage.HitCount);
+	}
+
+	ProcessingDamage.Reset();
+}
@@ -0,0 +1,102 @@
+// FPSDamageQueueSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FPSDamageQueueSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * 데미지 처리 큐 서브시스템 (월드 단위)
+ * - 한 프레임 동안의 명중을 모아 프레임 끝에 대상별로 처리
+ * - 같은 대상/공격자/GE 클래스의 명중은 데미지 합산, 크리티컬 OR, 명중 수(Data.HitCount)로 합쳐 GE 1회 실행
+ *   (데미지 원인은 키에 넣지 않음: 발사체마다 원인이 달라 같은 프레임의 여러 발사체 명중이 합쳐지지 않으므로 첫 명중의 원인을 사용)
+ * - PostGameplayEffectExecute (쉴드 흡수, 클램핑, 데미지 숫자, 사망 판정)가 대상마다 프레임당 1회만 실행
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSDamageQueueSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSDamageQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 명중 등록 (프레임 끝에 합쳐서 적용, HitCount: 이미 합쳐진 명중 수 ex.산탄 펠릿) */
+	void QueueDamage(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> DamageEffectClass, float DamageAmount,
+		bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount = 1);
+
+	/** 대기 중인 명중을 즉시 적용 */
+	void Flush();
+
+	/** 이번 프레임에 대기 중인 대상 수 */
+	int32 GetPendingTargetCount() const { return PendingDamage.Num(); }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 프레임 단위 일괄 처리 사용 (false면 명중 즉시 적용) */
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Queue")
+	bool bBatchDamage = true;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 합치기 키 (대상 + 공격자 + GE 클래스) */
+	struct FDamageKey
+	{
+		TObjectKey<UAbilitySystemComponent> Target;
+		TObjectKey<APawn> Instigator;
+		TObjectKey<UClass> EffectClass;
+
+		bool operator==(const FDamageKey& Other) const
+		{
+			return Target == Other.Target && Instigator == Other.Instigator && EffectClass == Other.EffectClass;
+		}
+
+		friend uint32 GetTypeHash(const FDamageKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Target), GetTypeHash(Key.Instigator)), GetTypeHash(Key.EffectClass));
+		}
+	};
+
+	/** 합쳐진 데미지 */
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+		TSubclassOf<UGameplayEffect> DamageEffectClass;
+		TWeakObjectPtr<APawn> Instigator;
+
+		/** 첫 명중의 데미지 원인 (이펙트 컨텍스트용) */
+		TWeakObjectPtr<AActor> DamageCauser;
+
+		float TotalDamage = 0.0f;
+		bool bAnyCritical = false;
+		int32 HitCount = 0;
+
+		/** 첫 명중의 HitResult (이펙트 컨텍스트용) */
+		FHitResult FirstHit;
+		bool bHasHit = false;
+	};
+
+	/** 대기 중인 데미지 (등록 순서 유지) */
+	TArray<FPendingDamage> PendingDamage;
+
+	/** 키 -> PendingDamage 인덱스 */
+	TMap<FDamageKey, int32> PendingIndexByKey;
+
+	/** 처리 중 버퍼 (처리 중 새로 등록된 명중은 다음 프레임) */
+	TArray<FPendingDamage> ProcessingDamage;
+};
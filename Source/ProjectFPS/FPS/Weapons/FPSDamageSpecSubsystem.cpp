@@ -0,0 +1,229 @@
+// FPSDamageSpecSubsystem.cpp
+
+#include "FPSDamageSpecSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/GameplayEffect_Damage.h"
+#include "FPS/Test/FPSCountingMalloc.h"
+
+void UFPSDamageSpecSubsystem::Deinitialize()
+{
+	SpecCache.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSDamageSpecSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UFPSDamageSpecSubsystem::ApplyDamage(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> DamageEffectClass,
+	float DamageAmount, bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount)
+{
+	if (!TargetASC)
+	{
+		return false;
+	}
+
+	FGameplayEffectSpec* Spec = PrepareDamageSpec(DamageEffectClass, DamageAmount, bCritical, DamageInstigator, DamageCauser, HitResult, HitCount);
+	if (!Spec)
+	{
+		return false;
+	}
+
+	TargetASC->ApplyGameplayEffectSpecToSelf(*Spec);
+	return true;
+}
+
+FGameplayEffectSpec* UFPSDamageSpecSubsystem::PrepareDamageSpec(TSubclassOf<UGameplayEffect> DamageEffectClass, float DamageAmount,
+	bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount)
+{
+	FDamageSpecEntry* Entry = FindOrCreateEntry(DamageEffectClass, DamageInstigator, DamageCauser);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	FGameplayEffectSpec* Spec = Entry->Spec.Data.Get();
+
+	// 명중마다 바뀌는 값만 덮어씀 (키가 이미 있으므로 할당 없음)
+	Spec->SetSetByCallerMagnitude(FPSGameplayTags::Data_Damage, -DamageAmount);
+	Spec->SetSetByCallerMagnitude(FPSGameplayTags::Data_IsCritical, bCritical ? 1.0f : 0.0f);
+	Spec->SetSetByCallerMagnitude(FPSGameplayTags::Data_HitCount, static_cast<float>(HitCount));
+
+	// 컨텍스트는 명중마다 다시 연결 (HitResult가 없는 명중에 이전 대상의 HitResult가 남지 않도록)
+	// 공격자/원인은 같으므로 소스 태그는 다시 캡처하지 않음
+	if (HitResult)
+	{
+		if (!Entry->HitContext.IsValid())
+		{
+			Entry->HitContext = Entry->Context.Duplicate();
+		}
+
+		Entry->HitContext.AddHitResult(*HitResult, true);
+		Spec->SetContext(Entry->HitContext, true);
+	}
+	else
+	{
+		Spec->SetContext(Entry->Context, true);
+	}
+
+	return Spec;
+}
+
+FGameplayEffectSpec* UFPSDamageSpecSubsystem::FindOrCreateSpec(TSubclassOf<UGameplayEffect> DamageEffectClass, APawn* DamageInstigator,
+	AActor* DamageCauser)
+{
+	FDamageSpecEntry* Entry = FindOrCreateEntry(DamageEffectClass, DamageInstigator, DamageCauser);
+	return Entry ? Entry->Spec.Data.Get() : nullptr;
+}
+
+UFPSDamageSpecSubsystem::FDamageSpecEntry* UFPSDamageSpecSubsystem::FindOrCreateEntry(TSubclassOf<UGameplayEffect> DamageEffectClass,
+	APawn* DamageInstigator, AActor* DamageCauser)
+{
+	if (!DamageEffectClass || !DamageInstigator)
+	{
+		return nullptr;
+	}
+
+	const FDamageSpecKey Key{ DamageEffectClass.Get(), DamageInstigator, DamageCauser };
+
+	if (FDamageSpecEntry* Entry = SpecCache.Find(Key))
+	{
+		if (Entry->SourceASC.IsValid() && Entry->Spec.IsValid())
+		{
+			return Entry;
+		}
+
+		// ASC가 교체/파괴됨: 다시 생성
+		SpecCache.Remove(Key);
+	}
+
+	// 명중 컨텍스트를 다음 명중에서 교체하므로 적용 즉시 실행되는 Instant GE만 캐시
+	const UGameplayEffect* EffectCDO = DamageEffectClass->GetDefaultObject<UGameplayEffect>();
+	if (!EffectCDO || EffectCDO->DurationPolicy != EGameplayEffectDurationType::Instant)
+	{
+		return nullptr;
+	}
+
+	// 스펙은 공격자 ASC 기준으로 생성 (대상과 무관하게 재사용)
+	IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(DamageInstigator);
+	UAbilitySystemComponent* SourceASC = ASI ? ASI->GetAbilitySystemComponent() : nullptr;
+	if (!SourceASC)
+	{
+		return nullptr;
+	}
+
+	FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
+	ContextHandle.AddInstigator(DamageInstigator, DamageCauser);
+
+	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(DamageEffectClass, 1.0f, ContextHandle);
+	if (!SpecHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	// SetByCaller 키를 미리 넣어 두어 명중 시 맵 할당이 없도록 함
+	SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_Damage, 0.0f);
+	SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_IsCritical, 0.0f);
+	SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_HitCount, 1.0f);
+
+	if (SpecCache.Num() >= PurgeThreshold)
+	{
+		PurgeStaleEntries();
+	}
+
+	FDamageSpecEntry& NewEntry = SpecCache.Add(Key);
+	NewEntry.Spec = SpecHandle;
+	NewEntry.Context = ContextHandle;
+	NewEntry.SourceASC = SourceASC;
+
+	return &NewEntry;
+}
+
+void UFPSDamageSpecSubsystem::InvalidateInstigator(const APawn* DamageInstigator)
+{
+	const TObjectKey<APawn> InstigatorKey(DamageInstigator);
+
+	for (auto It = SpecCache.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Instigator == InstigatorKey)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UFPSDamageSpecSubsystem::PurgeStaleEntries()
+{
+	for (auto It = SpecCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().SourceASC.IsValid() || !It.Key().Instigator.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+// ========================================
+// 마이크로 벤치마크 (FPS.Damage.SpecBenchmark [반복 횟수])
+// ========================================
+
+#if !UE_BUILD_SHIPPING
+
+static FAutoConsoleCommandWithWorldAndArgs GFPSDamageSpecBenchmarkCommand(
+	TEXT("FPS.Damage.SpecBenchmark"),
+	TEXT("데미지 스펙 생성 경로별 명중당 할당 수 비교 (플레이어 폰 기준, 실제 적용은 하지 않음). 인자: [반복 횟수=1000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(Pawn);
+		UAbilitySystemComponent* ASC = ASI ? ASI->GetAbilitySystemComponent() : nullptr;
+		UFPSDamageSpecSubsystem* SpecCache = World ? World->GetSubsystem<UFPSDamageSpecSubsystem>() : nullptr;
+		const TSubclassOf<UGameplayEffect> EffectClass = UGameplayEffect_Damage::StaticClass();
+
+		if (!ASC || !SpecCache)
+		{
+			UE_LOG(LogFPSCombat, Warning, TEXT("SpecBenchmark: ASC를 가진 플레이어 폰이 필요합니다"));
+			return;
+		}
+
+		FHitResult Hit;
+		Hit.ImpactPoint = Pawn->GetActorLocation();
+
+		// 기존 경로: 명중마다 컨텍스트/스펙 생성 + SetByCaller 2회 + HitResult
+		const int64 BaselineAllocs = FPSCountingMalloc::CountAllocations(Iterations, [&]()
+		{
+			FGameplayEffectContextHandle ContextHandle = ASC->MakeEffectContext();
+			ContextHandle.AddInstigator(Pawn, Pawn);
+			ContextHandle.AddHitResult(Hit);
+
+			FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(EffectClass, 1.0f, ContextHandle);
+			SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_Damage, -10.0f);
+			SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_IsCritical, 0.0f);
+		});
+
+		// 캐시 경로: 첫 생성(명중 컨텍스트 포함)은 측정에서 제외
+		SpecCache->PrepareDamageSpec(EffectClass, 10.0f, false, Pawn, Pawn, &Hit);
+
+		const int64 CachedAllocs = FPSCountingMalloc::CountAllocations(Iterations, [&]()
+		{
+			SpecCache->PrepareDamageSpec(EffectClass, 10.0f, false, Pawn, Pawn, &Hit);
+		});
+
+		UE_LOG(LogFPSCombat, Log, TEXT("SpecBenchmark (%d회): 기존 %.2f 할당/명중, 캐시 %.2f 할당/명중"),
+			Iterations, static_cast<double>(BaselineAllocs) / Iterations, static_cast<double>(CachedAllocs) / Iterations);
+	}));
+
+#endif
@@ -0,0 +1,107 @@
+// FPSDamageSpecSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayEffectTypes.h"
+#include "UObject/ObjectKey.h"
+#include "FPSDamageSpecSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+struct FGameplayEffectSpec;
+
+/**
+ * 데미지 GameplayEffect 스펙 캐시 (월드 단위)
+ * - (데미지 GE 클래스, 공격자, 데미지 원인) 조합마다 스펙/컨텍스트를 한 번만 생성
+ * - 명중마다 SetByCaller 값(Data.Damage / Data.IsCritical / Data.HitCount)만 덮어써서 재사용
+ * - 지속 사격 중 MakeEffectContext / MakeOutgoingSpec 힙 할당 제거
+ * - HitResult가 없으면 HitResult 없는 기본 컨텍스트를, 있으면 항목 전용 명중 컨텍스트에 HitResult를 새로 넣어 스펙에 연결
+ *   (이전 대상의 HitResult가 남지 않음, HitResult가 있는 명중만 HitResult 1회 할당)
+ * - 명중 컨텍스트는 다음 명중에서 교체되므로 Instant 데미지 GE 전용 (다른 GE는 캐시하지 않고 호출측 일반 경로로)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSDamageSpecSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSDamageSpecSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * 캐시된 스펙으로 대상 ASC에 데미지 적용
+	 * 공격자에게 ASC가 없어 캐시할 수 없으면 false (호출측이 일반 경로로 처리)
+	 */
+	bool ApplyDamage(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> DamageEffectClass, float DamageAmount,
+		bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult = nullptr, int32 HitCount = 1);
+
+	/** 캐시된 스펙 조회/생성 (없으면 nullptr, 반환된 스펙은 다음 조회 전까지만 유효) */
+	FGameplayEffectSpec* FindOrCreateSpec(TSubclassOf<UGameplayEffect> DamageEffectClass, APawn* DamageInstigator, AActor* DamageCauser);
+
+	/** 캐시된 스펙에 이번 명중 값(SetByCaller/컨텍스트)을 채워 반환 (적용은 하지 않음, 없으면 nullptr) */
+	FGameplayEffectSpec* PrepareDamageSpec(TSubclassOf<UGameplayEffect> DamageEffectClass, float DamageAmount, bool bCritical,
+		APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult = nullptr, int32 HitCount = 1);
+
+	/** 공격자의 캐시 제거 (ASC 재초기화 등) */
+	void InvalidateInstigator(const APawn* DamageInstigator);
+
+	/** 캐시된 스펙 수 */
+	int32 GetCachedSpecCount() const { return SpecCache.Num(); }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 캐시가 이 크기를 넘으면 파괴된 공격자의 항목 정리 */
+	UPROPERTY(Config, EditAnywhere, Category = "Damage Spec Cache", meta = (ClampMin = 1))
+	int32 PurgeThreshold = 256;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 캐시 키 */
+	struct FDamageSpecKey
+	{
+		TObjectKey<UClass> EffectClass;
+		TObjectKey<APawn> Instigator;
+		TObjectKey<AActor> Causer;
+
+		bool operator==(const FDamageSpecKey& Other) const
+		{
+			return EffectClass == Other.EffectClass && Instigator == Other.Instigator && Causer == Other.Causer;
+		}
+
+		friend uint32 GetTypeHash(const FDamageSpecKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.EffectClass), GetTypeHash(Key.Instigator)), GetTypeHash(Key.Causer));
+		}
+	};
+
+	/** 캐시 항목 */
+	struct FDamageSpecEntry
+	{
+		/** 재사용 스펙 (컨텍스트 포함) */
+		FGameplayEffectSpecHandle Spec;
+
+		/** HitResult 없는 기본 컨텍스트 */
+		FGameplayEffectContextHandle Context;
+
+		/** 기본 컨텍스트 복제본 (HitResult가 있는 명중마다 HitResult만 교체, 첫 사용 시 생성) */
+		FGameplayEffectContextHandle HitContext;
+
+		/** 스펙을 만든 공격자 ASC (파괴/교체 감지용) */
+		TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+	};
+
+	/** 캐시 항목 조회/생성 (Instant GE가 아니거나 공격자 ASC가 없으면 nullptr) */
+	FDamageSpecEntry* FindOrCreateEntry(TSubclassOf<UGameplayEffect> DamageEffectClass, APawn* DamageInstigator, AActor* DamageCauser);
+
+	/** 파괴된 공격자의 항목 정리 */
+	void PurgeStaleEntries();
+
+	/** 스펙 캐시 */
+	TMap<FDamageSpecKey, FDamageSpecEntry> SpecCache;
+};
@@ -0,0 +1,166 @@
+// FPSFireClockSubsystem.cpp
+
+#include "FPSFireClockSubsystem.h"
+#include "FPSWeapon.h"
+#include "Engine/World.h"
+
+void UFPSFireClockSubsystem::Deinitialize()
+{
+	Clocks.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UFPSFireClockSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSFireClockSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSFireClockSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSFireClockSubsystem::StartClock(AFPSWeapon* Weapon, bool bAutomatic)
+{
+	if (!Weapon)
+	{
+		return;
+	}
+
+	FFireClock* Clock = Clocks.FindByPredicate([Weapon](const FFireClock& Entry) { return Entry.Weapon.Get() == Weapon; });
+	if (!Clock)
+	{
+		Clock = &Clocks.AddDefaulted_GetRef();
+		Clock->Weapon = Weapon;
+	}
+
+	// 발사는 이번 프레임 시간이 이미 흐른 뒤에 일어나므로, 같은 프레임 Tick의 DeltaTime은 누적하지 않도록 시작 시각 기록
+	Clock->Accumulator = 0.0;
+	Clock->StartTime = GetWorld()->GetTimeSeconds();
+	Clock->bAutomatic = bAutomatic;
+	Clock->LastMuzzleLocation = Weapon->GetMuzzleLocation();
+	Clock->bStopped = false;
+}
+
+void UFPSFireClockSubsystem::StopClock(AFPSWeapon* Weapon)
+{
+	for (int32 Index = 0; Index < Clocks.Num(); ++Index)
+	{
+		if (Clocks[Index].Weapon.Get() != Weapon)
+		{
+			continue;
+		}
+
+		// Tick 도중이면 표시만 하고 Tick 끝에서 제거 (인덱스 유지)
+		if (bIsTicking)
+		{
+			Clocks[Index].bStopped = true;
+		}
+		else
+		{
+			Clocks.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+		return;
+	}
+}
+
+bool UFPSFireClockSubsystem::IsClockRunning(const AFPSWeapon* Weapon) const
+{
+	return Clocks.ContainsByPredicate([Weapon](const FFireClock& Entry) { return !Entry.bStopped && Entry.Weapon.Get() == Weapon; });
+}
+
+void UFPSFireClockSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Clocks.Num() == 0)
+	{
+		return;
+	}
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// 발사 콜백 안에서 새 시계가 추가될 수 있으므로 시작 시점의 개수만 진행 (새 시계는 다음 프레임부터)
+	bIsTicking = true;
+
+	const int32 NumClocks = Clocks.Num();
+	for (int32 ClockIndex = 0; ClockIndex < NumClocks; ++ClockIndex)
+	{
+		AdvanceClock(ClockIndex, DeltaTime, CurrentTime);
+	}
+
+	bIsTicking = false;
+
+	// 정지된 시계 / 파괴된 무기 정리
+	Clocks.RemoveAllSwap([](const FFireClock& Entry) { return Entry.bStopped || !Entry.Weapon.IsValid(); }, EAllowShrinking::No);
+}
+
+void UFPSFireClockSubsystem::AdvanceClock(int32 ClockIndex, float DeltaTime, double CurrentTime)
+{
+	AFPSWeapon* Weapon = Clocks[ClockIndex].Weapon.Get();
+	if (!Weapon || Clocks[ClockIndex].bStopped)
+	{
+		return;
+	}
+
+	// 연사 간격은 매 프레임 다시 읽음 (버서커 등 공격 속도 변화 즉시 반영, 버스트 간격 지정 시 그 값)
+	const double Interval = FMath::Max(static_cast<double>(Weapon->GetFireClockInterval()), UE_KINDA_SMALL_NUMBER);
+
+	// 시작 시각 이후의 시간만 누적 (시작한 프레임에는 0 -> 두 번째 발사/쿨다운이 한 프레임 일찍 오지 않음)
+	const double Elapsed = FMath::Clamp(CurrentTime - Clocks[ClockIndex].StartTime, 0.0, static_cast<double>(DeltaTime));
+	Clocks[ClockIndex].Accumulator += Elapsed;
+
+	// 반자동: 쿨다운 만료 알림 1회
+	if (!Clocks[ClockIndex].bAutomatic)
+	{
+		if (Clocks[ClockIndex].Accumulator >= Interval)
+		{
+			Clocks[ClockIndex].bStopped = true;
+			Weapon->FireCooldownExpired();
+		}
+		return;
+	}
+
+	const FVector PrevMuzzleLocation = Clocks[ClockIndex].LastMuzzleLocation;
+	const FVector CurrentMuzzleLocation = Weapon->GetMuzzleLocation();
+
+	int32 NumShots = 0;
+	while (Clocks[ClockIndex].Accumulator >= Interval && NumShots < MaxShotsPerFrame)
+	{
+		// 발사 콜백이 시계를 추가할 수 있으므로 매번 인덱스로 접근
+		Clocks[ClockIndex].Accumulator -= Interval;
+
+		// 발사 시점이 프레임 내 어디인지 (0 = 이전 프레임, 1 = 현재 프레임)
+		const double TimeSinceShot = Clocks[ClockIndex].Accumulator;
+		const float Alpha = DeltaTime > 0.0f ? FMath::Clamp(1.0f - static_cast<float>(TimeSinceShot / DeltaTime), 0.0f, 1.0f) : 1.0f;
+
+		FFireClockShot Shot;
+		Shot.Timestamp = CurrentTime - TimeSinceShot;
+		Shot.TimeSinceShot = static_cast<float>(TimeSinceShot);
+		Shot.MuzzleLocation = FMath::Lerp(PrevMuzzleLocation, CurrentMuzzleLocation, Alpha);
+
+		Weapon->FireClockShot(Shot);
+		++NumShots;
+
+		// 탄약 소진 등으로 정지됨
+		if (Clocks[ClockIndex].bStopped)
+		{
+			return;
+		}
+	}
+
+	// 지속 시간만 지정한 버스트는 다음 발사를 기다리지 않고 시간이 지난 프레임에 종료
+	if (Weapon->FinishExpiredBurst(CurrentTime))
+	{
+		return;
+	}
+
+	// 히치로 한도를 넘긴 발사는 버림 (다음 프레임에 몰아서 쏘지 않도록)
+	if (NumShots == MaxShotsPerFrame)
+	{
+		Clocks[ClockIndex].Accumulator = FMath::Min(Clocks[ClockIndex].Accumulator, Interval);
+	}
+
+	Clocks[ClockIndex].LastMuzzleLocation = CurrentMuzzleLocation;
+}
@@ -0,0 +1,98 @@
+// FPSFireClockSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSFireClockSubsystem.generated.h"
+
+class AFPSWeapon;
+
+/**
+ * 연사 시계가 발생시킨 발사 1회 정보
+ */
+struct FFireClockShot
+{
+	/** 발사 시각 (월드 시간, 프레임 내 보간) */
+	double Timestamp = 0.0;
+
+	/** 발사 시각부터 현재 프레임까지 지난 시간 */
+	float TimeSinceShot = 0.0f;
+
+	/** 발사 시점의 총구 위치 (이전 프레임 -> 현재 프레임 보간) */
+	FVector MuzzleLocation = FVector::ZeroVector;
+};
+
+/**
+ * 연사 시계 서브시스템 (월드 단위)
+ * - 발사 중인 무기마다 시간 누적기를 두고, 매 프레임 밀린 발사 수만큼 정확히 발사
+ * - 한 프레임에 여러 발이 필요하면 발사 시각/총구 위치를 프레임 내에서 보간
+ * - 프레임레이트와 무관한 DPS, 발사마다 타이머를 다시 거는 비용 제거 (플레이어/적 공통)
+ * - 반자동 무기는 연사 쿨다운 만료 알림에만 사용 (버스트 발사 중에는 무기 종류와 관계없이 연사)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSFireClockSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSFireClockSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 시계 시작 (방금 발사한 시점 기준, 이미 있으면 누적기 초기화) */
+	void StartClock(AFPSWeapon* Weapon, bool bAutomatic);
+
+	/** 시계 정지 */
+	void StopClock(AFPSWeapon* Weapon);
+
+	/** 시계가 동작 중인지 */
+	bool IsClockRunning(const AFPSWeapon* Weapon) const;
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 무기당 한 프레임 최대 발사 수 (히치 후 몰아서 발사하는 것 방지, 초과분은 버림) */
+	UPROPERTY(Config, EditAnywhere, Category = "Fire Clock", meta = (ClampMin = 1))
+	int32 MaxShotsPerFrame = 8;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 무기별 시계 */
+	struct FFireClock
+	{
+		TWeakObjectPtr<AFPSWeapon> Weapon;
+
+		/** 마지막 발사 이후 누적 시간 */
+		double Accumulator = 0.0;
+
+		/** 시계 시작 시각 (월드 시간, 이 시각 이전의 프레임 시간은 누적하지 않음) */
+		double StartTime = 0.0;
+
+		/** 자동 연사 (false면 쿨다운 만료 알림 1회 후 제거) */
+		bool bAutomatic = true;
+
+		/** 이전 프레임 총구 위치 (보간용) */
+		FVector LastMuzzleLocation = FVector::ZeroVector;
+
+		/** 정지됨 (Tick 도중 정지 요청 시 Tick 끝에서 제거) */
+		bool bStopped = false;
+	};
+
+	/** 시계 하나 진행 */
+	void AdvanceClock(int32 ClockIndex, float DeltaTime, double CurrentTime);
+
+	/** 동작 중인 시계 */
+	TArray<FFireClock> Clocks;
+
+	/** Tick 진행 중 여부 (발사 콜백에서 Start/Stop 호출 대비) */
+	bool bIsTicking = false;
+};
@@ -0,0 +1,212 @@
+// FPSHitscanSubsystem.cpp
+
+#include "FPSHitscanSubsystem.h"
+#include "FPSProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraComponent.h"
+#include "GameplayEffect.h"
+#include "FPS/FPSCosmeticLODSubsystem.h"
+#include "FPS/FPSEffectPoolSubsystem.h"
+
+void UFPSHitscanSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceParams = FCollisionQueryParams(SCENE_QUERY_STAT(FPSHitscan), false);
+}
+
+bool UFPSHitscanSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSHitscanSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSHitscanSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSHitscanSubsystem::QueueShot(const FHitscanShotRequest& Shot)
+{
+	PendingShots.Add(Shot);
+}
+
+void UFPSHitscanSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingShots.Num() == 0)
+	{
+		return;
+	}
+
+	// 이번 프레임 사격을 한 번에 처리 (처리 중 추가되는 사격은 다음 프레임)
+	Swap(PendingShots, ProcessingShots);
+
+	for (const FHitscanShotRequest& Shot : ProcessingShots)
+	{
+		if (Shot.PelletEnds.Num() > 0)
+		{
+			ResolvePelletBundle(Shot);
+		}
+		else
+		{
+			ResolveShot(Shot);
+		}
+	}
+
+	ProcessingShots.Reset();
+}
+
+void UFPSHitscanSubsystem::ResolveShot(const FHitscanShotRequest& Shot)
+{
+	PrepareTraceParams(Shot);
+
+	FHitResult Hit;
+	const bool bHit = TraceShot(Shot, Shot.End, Hit);
+
+	// 폰에 명중: 발사체와 같은 GAS 경로로 데미지 적용
+	if (bHit && Hit.GetActor() && Hit.GetActor()->IsA<APawn>())
+	{
+		AFPSProjectile::ApplyDamageEffect(Hit.GetActor(), Shot.DamageEffectClass, Shot.Damage, Shot.bCritical,
+			Shot.Instigator.Get(), Shot.DamageCauser.Get(), &Hit);
+	}
+
+	SpawnShotCosmetics(Shot, Shot.End, bHit ? &Hit : nullptr);
+}
+
+void UFPSHitscanSubsystem::ResolvePelletBundle(const FHitscanShotRequest& Shot)
+{
+	// 펠릿 전체가 같은 트레이스 파라미터 사용
+	PrepareTraceParams(Shot);
+
+	PelletTargets.Reset();
+	bool bImpactSoundPlayed = false;
+
+	for (const FVector& PelletEnd : Shot.PelletEnds)
+	{
+		FHitResult Hit;
+		const bool bHit = TraceShot(Shot, PelletEnd, Hit);
+
+		// 폰 명중은 대상별로 합산 (펠릿 수가 적으므로 선형 탐색)
+		if (bHit && Hit.GetActor() && Hit.GetActor()->IsA<APawn>())
+		{
+			AActor* HitActor = Hit.GetActor();
+			FPelletTargetHit* TargetHit = PelletTargets.FindByPredicate([HitActor](const FPelletTargetHit& Entry)
+			{
+				return Entry.Target == HitActor;
+			});
+
+			if (!TargetHit)
+			{
+				TargetHit = &PelletTargets.AddDefaulted_GetRef();
+				TargetHit->Target = HitActor;
+				TargetHit->FirstHit = Hit;
+			}
+
+			TargetHit->Damage += Shot.Damage;
+			TargetHit->HitCount++;
+		}
+
+		SpawnShotCosmetics(Shot, PelletEnd, bHit ? &Hit : nullptr, bHit && !bImpactSoundPlayed);
+		bImpactSoundPlayed |= bHit;
+	}
+
+	// 대상당 GAS 1회
+	for (const FPelletTargetHit& TargetHit : PelletTargets)
+	{
+		AFPSProjectile::ApplyDamageEffect(TargetHit.Target, Shot.DamageEffectClass, TargetHit.Damage, Shot.bCritical,
+			Shot.Instigator.Get(), Shot.DamageCauser.Get(), &TargetHit.FirstHit, TargetHit.HitCount);
+	}
+}
+
+void UFPSHitscanSubsystem::PrepareTraceParams(const FHitscanShotRequest& Shot)
+{
+	TraceParams.ClearIgnoredActors();
+	TraceParams.AddIgnoredActor(Shot.Instigator.Get());
+	TraceParams.AddIgnoredActor(Shot.DamageCauser.Get());
+}
+
+bool UFPSHitscanSubsystem::TraceShot(const FHitscanShotRequest& Shot, const FVector& End, FHitResult& OutHit)
+{
+	UWorld* World = GetWorld();
+	APawn* ShotInstigator = Shot.Instigator.Get();
+
+	// 발사체 충돌 설정과 동일한 대상 (Pawn / WorldStatic / WorldDynamic)
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	// 오브젝트 타입 Multi 트레이스는 경로상의 모든 충돌을 거리순으로 반환
+	TraceHits.Reset();
+	World->LineTraceMultiByObjectType(TraceHits, Shot.Start, End, ObjectParams, TraceParams);
+
+	for (const FHitResult& Hit : TraceHits)
+	{
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor)
+		{
+			continue;
+		}
+
+		// Owner에 속한 충돌체는 무시 (ex.방어막 안에서 발사)
+		if (ShotInstigator && HitActor->GetOwner() == ShotInstigator)
+		{
+			continue;
+		}
+
+		OutHit = Hit;
+		return true;
+	}
+
+	return false;
+}
+
+void UFPSHitscanSubsystem::SpawnShotCosmetics(const FHitscanShotRequest& Shot, const FVector& End, const FHitResult* Hit, bool bImpactSound) const
+{
+	UWorld* World = GetWorld();
+	if (World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	const FVector TracerEnd = Hit ? FVector(Hit->ImpactPoint) : End;
+
+	// 트레이서 (총구 -> 명중 지점)
+	if (Shot.TracerEffect)
+	{
+		const FRotator TracerRotation = (TracerEnd - Shot.Start).Rotation();
+		if (UNiagaraComponent* Tracer = UFPSEffectPoolSubsystem::SpawnNiagaraAtLocation(World, Shot.TracerEffect, Shot.Start, TracerRotation,
+			EFPSEffectPriority::Low))
+		{
+			Tracer->SetVariableVec3(Shot.TracerEndParameterName, TracerEnd);
+		}
+	}
+
+	if (!Hit)
+	{
+		return;
+	}
+
+	// 명중 이펙트/사운드 (연출 LOD/프레임 상한 적용)
+	FFPSImpactCosmetics Cosmetics;
+	Cosmetics.bSpawnParticle = true;
+	Cosmetics.bPlaySound = true;
+	if (UFPSCosmeticLODSubsystem* CosmeticLOD = World->GetSubsystem<UFPSCosmeticLODSubsystem>())
+	{
+		Cosmetics = CosmeticLOD->RequestImpactCosmetics(Hit->ImpactPoint);
+	}
+
+	if (Shot.ImpactParticle && Cosmetics.bSpawnParticle)
+	{
+		UFPSEffectPoolSubsystem::SpawnParticleAtLocation(World, Shot.ImpactParticle, Hit->ImpactPoint);
+	}
+
+	if (Shot.ImpactSound && bImpactSound && Cosmetics.bPlaySound)
+	{
+		UFPSEffectPoolSubsystem::PlaySoundAtLocation(World, Shot.ImpactSound, Hit->ImpactPoint);
+	}
+}
@@ -0,0 +1,131 @@
+// FPSHitscanSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSHitscanSubsystem.generated.h"
+
+class UGameplayEffect;
+class UNiagaraSystem;
+class UParticleSystem;
+class USoundBase;
+
+/**
+ * 히트스캔 사격 요청 (한 발 또는 산탄 한 묶음)
+ * - 판정 데이터와 연출 데이터를 함께 보관
+ * - PelletEnds가 있으면 산탄 묶음: 펠릿마다 트레이스 후 대상별로 데미지를 합쳐 한 번만 적용
+ * - 연출 에셋은 무기/발사체 데이터가 소유하므로 한 프레임 동안만 참조
+ */
+struct FHitscanShotRequest
+{
+	/** 발사 시작점 (총구) */
+	FVector Start = FVector::ZeroVector;
+
+	/** 사거리 끝점 */
+	FVector End = FVector::ZeroVector;
+
+	/** 산탄 펠릿별 사거리 끝점 (비어 있으면 단발, 있으면 End 대신 사용) */
+	TArray<FVector, TInlineAllocator<16>> PelletEnds;
+
+	/** 데미지 (크리티컬 반영된 최종값, 산탄은 펠릿당) */
+	float Damage = 0.0f;
+
+	/** 크리티컬 여부 */
+	bool bCritical = false;
+
+	/** 데미지 GameplayEffect 클래스 */
+	TSubclassOf<UGameplayEffect> DamageEffectClass;
+
+	/** 공격자 (LastAttacker/데미지 숫자용) */
+	TWeakObjectPtr<APawn> Instigator;
+
+	/** 데미지 원인 (무기) */
+	TWeakObjectPtr<AActor> DamageCauser;
+
+	// ========================================
+	// 연출 (선택, 판정에 영향 없음)
+	// ========================================
+
+	/** 트레이서 이펙트 */
+	UNiagaraSystem* TracerEffect = nullptr;
+
+	/** 트레이서 끝점 Niagara 파라미터 이름 */
+	FName TracerEndParameterName;
+
+	/** 명중 파티클 */
+	UParticleSystem* ImpactParticle = nullptr;
+
+	/** 명중 사운드 */
+	USoundBase* ImpactSound = nullptr;
+};
+
+/**
+ * 히트스캔 판정 서브시스템 (월드 단위)
+ * - 같은 프레임에 발사된 모든 무기의 히트스캔 사격을 모아서 한 번의 트레이스 패스로 처리
+ * - 데미지는 AFPSProjectile::ApplyDamageEffect와 같은 GAS 경로로 적용
+ * - 트레이서/명중 이펙트는 연출 전용 (데디케이티드 서버에서는 생략)
+ */
+UCLASS()
+class PROJECTFPS_API UFPSHitscanSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 사격 요청 등록 (이번 프레임 끝의 트레이스 패스에서 처리) */
+	void QueueShot(const FHitscanShotRequest& Shot);
+
+	/** 대기 중인 사격 수 */
+	int32 GetPendingShotCount() const { return PendingShots.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** 산탄 대상별 합산 */
+	struct FPelletTargetHit
+	{
+		AActor* Target = nullptr;
+		float Damage = 0.0f;
+		int32 HitCount = 0;
+		FHitResult FirstHit;
+	};
+
+	/** 단발 처리 */
+	void ResolveShot(const FHitscanShotRequest& Shot);
+
+	/** 산탄 묶음 처리 (펠릿 트레이스 -> 대상별 합산 -> 대상당 GAS 1회) */
+	void ResolvePelletBundle(const FHitscanShotRequest& Shot);
+
+	/** 트레이스 파라미터 설정 (Instigator/무기 무시) */
+	void PrepareTraceParams(const FHitscanShotRequest& Shot);
+
+	/** 한 발 판정 (첫 번째 유효 충돌 반환, PrepareTraceParams 이후 호출) */
+	bool TraceShot(const FHitscanShotRequest& Shot, const FVector& End, FHitResult& OutHit);
+
+	/** 트레이서/명중 연출 (bImpactSound: 명중 사운드 재생 여부, 산탄은 묶음당 1회) */
+	void SpawnShotCosmetics(const FHitscanShotRequest& Shot, const FVector& End, const FHitResult* Hit, bool bImpactSound = true) const;
+
+	/** 이번 프레임에 등록된 사격 */
+	TArray<FHitscanShotRequest> PendingShots;
+
+	/** 처리 중인 사격 (처리 중 등록된 사격은 다음 프레임으로) */
+	TArray<FHitscanShotRequest> ProcessingShots;
+
+	/** 트레이스 결과 버퍼 (프레임 간 재사용) */
+	TArray<FHitResult> TraceHits;
+
+	/** 트레이스 파라미터 (프레임 간 재사용) */
+	FCollisionQueryParams TraceParams;
+
+	/** 산탄 대상별 합산 버퍼 (프레임 간 재사용) */
+	TArray<FPelletTargetHit> PelletTargets;
+};
@@ -1,6 +1,10 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPSProjectile.h"
+#include "FPS/FPSLog.h"
+#include "FPSProjectilePoolSubsystem.h"
+#include "FPSDamageSpecSubsystem.h"
+#include "FPSDamageQueueSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -10,6 +14,9 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
 #include "TimerManager.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/FPSCosmeticLODSubsystem.h"
+#include "FPS/FPSEffectPoolSubsystem.h"
 
 AFPSProjectile::AFPSProjectile()
 {
@@ -53,41 +60,75 @@ void AFPSProjectile::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// 7초 후 자동 파괴 타이머 설정
-	GetWorld()->GetTimerManager().SetTimer(DestroyTimerHandle, this, &AFPSProjectile::DestroyProjectile, 7.0f, false);
+	// 메시 연출 LOD 대상 등록 (풀 발사체는 최초 스폰 시 한 번)
+	if (UFPSCosmeticLODSubsystem* CosmeticLOD = GetWorld()->GetSubsystem<UFPSCosmeticLODSubsystem>())
+	{
+		CosmeticLOD->RegisterProjectile(this);
+	}
+
+	// 풀 소속 발사체는 ActivateFromPool에서 타이머 설정
+	if (IsPooled())
+	{
+		return;
+	}
+
+	bIsInFlight = true;
+
+	// 수명 만료 타이머 설정
+	GetWorld()->GetTimerManager().SetTimer(DestroyTimerHandle, this, &AFPSProjectile::DestroyProjectile, LifeSeconds, false);
+}
+
+void AFPSProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UFPSCosmeticLODSubsystem* CosmeticLOD = World->GetSubsystem<UFPSCosmeticLODSubsystem>())
+		{
+			CosmeticLOD->UnregisterProjectile(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AFPSProjectile::OnComponentBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
 	int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	// ⭐ 디버깅: OnComponentBeginOverlap 호출 확인
-	UE_LOG(LogTemp, Log, TEXT("발사체 OnComponentBeginOverlap 호출됨 - 충돌 대상: %s"), OtherActor ? *OtherActor->GetName() : TEXT("NULL"));
+	// 풀 대기 중이거나 이미 명중 처리된 발사체는 무시
+	if (!bIsInFlight)
+	{
+		return;
+	}
+
+	// 매 충돌마다 호출되므로 카운터만 (상세 로그는 Verbose)
+	INC_DWORD_STAT(STAT_FPSProjectileOverlaps);
+	UE_LOG(LogFPSCombat, Verbose, TEXT("발사체 OnComponentBeginOverlap 호출됨 - 충돌 대상: %s"), OtherActor ? *OtherActor->GetName() : TEXT("NULL"));
 
 	// 자기 자신이나 Instigator는 무시
 	if (OtherActor == this || OtherActor == GetInstigator())
 	{
-		UE_LOG(LogTemp, Log, TEXT("자기 자신 or Instigator 무시"));
+		UE_LOG(LogFPSCombat, Verbose, TEXT("자기 자신 or Instigator 무시"));
 		return;
 	}
 
 	// Owner에 속한 충돌체는 무시 (ex.방어막 안에서 발사)
 	if (IsHitObjectFromOwner(OtherActor))
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("방어막: Owner 발사체 통과"));
+		UE_LOG(LogFPSCombat, Verbose, TEXT("방어막: Owner 발사체 통과"));
 		return;
 	}
 
 	// 벽/바닥에 충돌: 이펙트만 재생, 데미지 없음
 	if (!OtherActor->IsA<APawn>())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("발사체가 벽에 충돌: %s"), *OtherActor->GetName());
+		UE_LOG(LogFPSCombat, Verbose, TEXT("발사체가 벽에 충돌: %s"), *OtherActor->GetName());
 		PlayHitEffects(SweepResult.ImpactPoint);
 		OnProjectileHit(SweepResult);
-		Destroy();
+		FinishProjectile();
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Pawn에 충돌: %s"), *OtherActor->GetName());
+	UE_LOG(LogFPSCombat, Verbose, TEXT("Pawn에 충돌: %s"), *OtherActor->GetName());
 
 	// Pawn에 충돌: 데미지 적용
 	bool bApply = ApplyDamageToTarget(OtherActor);
@@ -100,14 +141,20 @@ void AFPSProjectile::OnComponentBeginOverlap(UPrimitiveComponent* OverlappedComp
 		// Blueprint 이벤트 호출
 		OnProjectileHit(SweepResult);
 
-		// 발사체 파괴
-		Destroy();
+		// 발사체 종료 (풀 반납 또는 파괴)
+		FinishProjectile();
 	}
 }
 
 bool AFPSProjectile::ApplyDamageToTarget(AActor* Target)
 {
-	if (!Target || !DamageEffectClass)
+	return ApplyDamageEffect(Target, DamageEffectClass, Damage, bIsCriticalHit, GetInstigator(), this);
+}
+
+bool AFPSProjectile::ApplyDamageEffect(AActor* Target, TSubclassOf<UGameplayEffect> InDamageEffectClass, float DamageAmount,
+	bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount)
+{
+	if (!Target || !InDamageEffectClass)
 	{
 		return false;
 	}
@@ -125,26 +172,70 @@ bool AFPSProjectile::ApplyDamageToTarget(AActor* Target)
 		return false;
 	}
 
-	// GameplayEffect로 데미지 적용
+	INC_DWORD_STAT(STAT_FPSDamageApplications);
+	FPS_INC_COMBAT_COUNTER(DamageApplications);
+
+	// 프레임 단위 일괄 처리 (같은 대상의 명중은 프레임 끝에 한 번으로 합쳐 적용)
+	UFPSDamageQueueSubsystem* DamageQueue = Target->GetWorld() ? Target->GetWorld()->GetSubsystem<UFPSDamageQueueSubsystem>() : nullptr;
+	if (DamageQueue && DamageQueue->bBatchDamage)
+	{
+		DamageQueue->QueueDamage(TargetASC, InDamageEffectClass, DamageAmount, bCritical, DamageInstigator, DamageCauser, HitResult, HitCount);
+		return true;
+	}
+
+	return ApplyDamageEffectToASC(TargetASC, InDamageEffectClass, DamageAmount, bCritical, DamageInstigator, DamageCauser, HitResult, HitCount);
+}
+
+bool AFPSProjectile::ApplyDamageEffectToASC(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> InDamageEffectClass,
+	float DamageAmount, bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount)
+{
+	if (!TargetASC || !InDamageEffectClass)
+	{
+		return false;
+	}
+
+	// 캐시된 스펙 재사용 (명중마다 스펙/컨텍스트 할당 없음)
+	UWorld* World = TargetASC->GetWorld();
+	UFPSDamageSpecSubsystem* SpecCache = World ? World->GetSubsystem<UFPSDamageSpecSubsystem>() : nullptr;
+	if (SpecCache && SpecCache->ApplyDamage(TargetASC, InDamageEffectClass, DamageAmount, bCritical, DamageInstigator, DamageCauser, HitResult, HitCount))
+	{
+		INC_DWORD_STAT(STAT_FPSDamageExecutions);
+		FPS_INC_COMBAT_COUNTER(DamageExecutions);
+		UE_LOG(LogFPSCombat, Verbose, TEXT("데미지 적용: %.0f to %s (크리티컬: %s, 명중 %d회)"),
+			DamageAmount, *GetNameSafe(TargetASC->GetOwnerActor()), bCritical ? TEXT("예") : TEXT("아니오"), HitCount);
+
+		return true;
+	}
+
+	// GameplayEffect로 데미지 적용 (공격자 ASC가 없는 경우)
 	FGameplayEffectContextHandle ContextHandle = TargetASC->MakeEffectContext();
-	ContextHandle.AddInstigator(GetInstigator(), this);
+	ContextHandle.AddInstigator(DamageInstigator, DamageCauser);
+	if (HitResult)
+	{
+		ContextHandle.AddHitResult(*HitResult);
+	}
 
-	FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(DamageEffectClass, 1.0f, ContextHandle);
+	FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(InDamageEffectClass, 1.0f, ContextHandle);
 	if (SpecHandle.IsValid())
 	{
 		// Damage 값을 GameplayEffect Magnitude로 설정
-		SpecHandle.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(FName("Data.Damage")), -Damage);
+		SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_Damage, -DamageAmount);
 
 		// 크리티컬 여부를 SetByCaller로 전달 (0.0 = 일반, 1.0 = 크리티컬)
 		SpecHandle.Data->SetSetByCallerMagnitude(
-			FGameplayTag::RequestGameplayTag(FName("Data.IsCritical")),
-			bIsCriticalHit ? 1.0f : 0.0f
+			FPSGameplayTags::Data_IsCritical,
+			bCritical ? 1.0f : 0.0f
 		);
 
+		// 합쳐진 명중 수
+		SpecHandle.Data->SetSetByCallerMagnitude(FPSGameplayTags::Data_HitCount, static_cast<float>(HitCount));
+
 		TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 
-		UE_LOG(LogTemp, Log, TEXT("발사체 데미지 적용: %.0f to %s (크리티컬: %s)"),
-			Damage, *Target->GetName(), bIsCriticalHit ? TEXT("예") : TEXT("아니오"));
+		INC_DWORD_STAT(STAT_FPSDamageExecutions);
+		FPS_INC_COMBAT_COUNTER(DamageExecutions);
+		UE_LOG(LogFPSCombat, Verbose, TEXT("데미지 적용: %.0f to %s (크리티컬: %s, 명중 %d회)"),
+			DamageAmount, *GetNameSafe(TargetASC->GetOwnerActor()), bCritical ? TEXT("예") : TEXT("아니오"), HitCount);
 
 		return true;
 	}
@@ -154,22 +245,136 @@ bool AFPSProjectile::ApplyDamageToTarget(AActor* Target)
 
 void AFPSProjectile::PlayHitEffects(const FVector& HitLocation)
 {
+	PlayHitEffectsInWorld(GetWorld(), HitLocation);
+}
+
+void AFPSProjectile::PlayHitEffectsInWorld(UWorld* World, const FVector& HitLocation) const
+{
+	// 데디케이티드 서버는 연출 없음
+	if (!World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// 연출 LOD (거리/시야 단계 + 프레임 상한)
+	FFPSImpactCosmetics Cosmetics;
+	Cosmetics.bSpawnParticle = true;
+	Cosmetics.bPlaySound = true;
+	if (UFPSCosmeticLODSubsystem* CosmeticLOD = World->GetSubsystem<UFPSCosmeticLODSubsystem>())
+	{
+		Cosmetics = CosmeticLOD->RequestImpactCosmetics(HitLocation);
+	}
+
 	// 파티클 이펙트 재생
-	if (HitParticle)
+	if (HitParticle && Cosmetics.bSpawnParticle)
 	{
-		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), HitParticle, HitLocation);
+		UFPSEffectPoolSubsystem::SpawnParticleAtLocation(World, HitParticle, HitLocation);
 	}
 
 	// 사운드 재생
-	if (HitSound)
+	if (HitSound && Cosmetics.bPlaySound)
 	{
-		UGameplayStatics::PlaySoundAtLocation(GetWorld(), HitSound, HitLocation);
+		UFPSEffectPoolSubsystem::PlaySoundAtLocation(World, HitSound, HitLocation);
 	}
 }
 
 void AFPSProjectile::DestroyProjectile()
 {
-	Destroy();
+	FinishProjectile();
+}
+
+void AFPSProjectile::ActivateFromPool(const FTransform& SpawnTransform, AActor* InOwner, APawn* InInstigator)
+{
+	SetOwner(InOwner);
+	SetInstigator(InInstigator);
+
+	// 데미지/크리티컬은 클래스 기본값으로 초기화 (무기에서 다시 설정)
+	const AFPSProjectile* DefaultProjectile = GetClass()->GetDefaultObject<AFPSProjectile>();
+	Damage = DefaultProjectile->Damage;
+	bIsCriticalHit = DefaultProjectile->bIsCriticalHit;
+
+	// 위치/회전 이동 (충돌 해제 상태에서 텔레포트)
+	SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+
+	// 표시 및 충돌 복구
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	bIsInFlight = true;
+
+	// 메시 연출 LOD 즉시 반영 (라운드 로빈 갱신 전까지 이전 상태가 남지 않도록)
+	if (UFPSCosmeticLODSubsystem* CosmeticLOD = GetWorld()->GetSubsystem<UFPSCosmeticLODSubsystem>())
+	{
+		CosmeticLOD->UpdateProjectileMesh(this);
+	}
+
+	// 이동 재시작 (발사 방향으로 InitialSpeed)
+	if (ProjectileMovement)
+	{
+		const float LaunchSpeed = ProjectileMovement->InitialSpeed > 0.0f ? ProjectileMovement->InitialSpeed : ProjectileMovement->MaxSpeed;
+		ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+		ProjectileMovement->Velocity = SpawnTransform.GetRotation().Vector() * LaunchSpeed;
+		ProjectileMovement->Activate(true);
+		ProjectileMovement->UpdateComponentVelocity();
+	}
+
+	// 수명 타이머 재설정
+	GetWorld()->GetTimerManager().SetTimer(DestroyTimerHandle, this, &AFPSProjectile::DestroyProjectile, LifeSeconds, false);
+}
+
+void AFPSProjectile::DeactivateToPool()
+{
+	bIsInFlight = false;
+
+	GetWorld()->GetTimerManager().ClearTimer(DestroyTimerHandle);
+
+	// 이동 정지
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->Deactivate();
+	}
+
+	// 숨김 및 충돌 해제
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+}
+
+void AFPSProjectile::EnterVisualProxyMode()
+{
+	// 판정은 시뮬레이션 서브시스템이 담당하므로 충돌 이벤트 무시
+	bIsInFlight = false;
+
+	GetWorld()->GetTimerManager().ClearTimer(DestroyTimerHandle);
+
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->Deactivate();
+	}
+
+	SetActorEnableCollision(false);
+}
+
+void AFPSProjectile::FinishProjectile()
+{
+	if (!bIsInFlight)
+	{
+		return;
+	}
+
+	bIsInFlight = false;
+
+	if (UFPSProjectilePoolSubsystem* Pool = OwningPool.Get())
+	{
+		Pool->ReleaseProjectile(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
 
 bool AFPSProjectile::IsHitObjectFromOwner(AActor* HitObject)
@@ -10,6 +10,9 @@ class USphereComponent;
 class UProjectileMovementComponent;
 class UParticleSystem;
 class USoundBase;
+class UFPSProjectilePoolSubsystem;
+class UGameplayEffect;
+class UAbilitySystemComponent;
 
 /**
  * FPS 발사체 기본 클래스
@@ -27,6 +30,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// ========================================
@@ -101,20 +105,72 @@ public:
 	/** 데미지 적용 함수 */
 	bool ApplyDamageToTarget(AActor* Target);
 
+	/**
+	 * 대상에게 데미지 GameplayEffect 적용 (발사체/히트스캔 공용 GAS 경로)
+	 * Data.Damage / Data.IsCritical SetByCaller를 설정하므로 크리티컬/데미지 숫자가 동일하게 동작
+	 * 데미지 큐가 활성화되어 있으면 프레임 끝에 대상별로 합쳐서 적용 (ASC가 있는 대상이면 true)
+	 * HitCount: 호출 전에 이미 합쳐진 명중 수 (ex.산탄 펠릿)
+	 */
+	static bool ApplyDamageEffect(AActor* Target, TSubclassOf<UGameplayEffect> InDamageEffectClass, float DamageAmount,
+		bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult = nullptr, int32 HitCount = 1);
+
+	/**
+	 * 대상 ASC에 데미지 GameplayEffect 즉시 적용 (HitCount: 합쳐진 명중 수, Data.HitCount SetByCaller)
+	 * 공격자에게 ASC가 있으면 UFPSDamageSpecSubsystem의 캐시된 스펙을 재사용
+	 */
+	static bool ApplyDamageEffectToASC(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> InDamageEffectClass,
+		float DamageAmount, bool bCritical, APawn* DamageInstigator, AActor* DamageCauser, const FHitResult* HitResult, int32 HitCount);
+
 	/** 충돌 후 이펙트/사운드 재생 */
 	void PlayHitEffects(const FVector& HitLocation);
 
+	/** 지정한 월드에 충돌 이펙트/사운드 재생 (클래스 기본 객체에서도 사용 가능, 연출 LOD/프레임 상한 적용) */
+	void PlayHitEffectsInWorld(UWorld* World, const FVector& HitLocation) const;
+
 	/** 충돌 후 처리 (Blueprint에서 오버라이드 가능) */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Projectile")
 	void OnProjectileHit(const FHitResult& HitResult);
 
+	// ========================================
+	// Pooling
+	// ========================================
+
+	/** 발사체 수명 (초) - 만료 시 풀 반납 또는 파괴 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	float LifeSeconds = 7.0f;
+
+	/** 풀 소속 설정 (풀에서 스폰할 때만 호출) */
+	void SetOwningPool(UFPSProjectilePoolSubsystem* InPool) { OwningPool = InPool; }
+
+	/** 풀 소속 발사체인지 여부 */
+	bool IsPooled() const { return OwningPool.IsValid(); }
+
+	/** 풀에서 꺼낼 때 호출: 위치/속도/데미지/충돌/수명 타이머 재설정 */
+	void ActivateFromPool(const FTransform& SpawnTransform, AActor* InOwner, APawn* InInstigator);
+
+	/** 풀로 반납될 때 호출: 숨김, 충돌 해제, 이동 정지, 타이머 정리 */
+	void DeactivateToPool();
+
+	/** 시각 프록시 모드 전환 (시뮬레이션 서브시스템용): 충돌/이동/수명 타이머 비활성, 위치는 외부에서 갱신 */
+	void EnterVisualProxyMode();
+
+	/** 발사체 종료 처리 (풀 소속이면 반납, 아니면 파괴) */
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	void FinishProjectile();
+
 protected:
-	/** 7초 후 자동 파괴 타이머 핸들 */
+	/** 수명 만료 타이머 핸들 */
 	FTimerHandle DestroyTimerHandle;
 
-	/** 발사체 자동 파괴 함수 */
+	/** 수명 만료 처리 함수 */
 	void DestroyProjectile();
 
+	/** 소속 풀 (풀 밖에서 스폰된 발사체는 null) */
+	TWeakObjectPtr<UFPSProjectilePoolSubsystem> OwningPool;
+
+	/** 발사 중인지 여부 (풀 대기 중에는 충돌 이벤트 무시) */
+	bool bIsInFlight = false;
+
 	/** Owner에 속한 충돌체인지 체크 **/
 	bool IsHitObjectFromOwner(AActor* HitObject);
 };
@@ -0,0 +1,225 @@
+// FPSProjectilePoolSubsystem.cpp
+
+#include "FPSProjectilePoolSubsystem.h"
+#include "FPS/FPSLog.h"
+#include "FPSProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+void UFPSProjectilePoolSubsystem::Deinitialize()
+{
+	// 월드 정리 시 액터는 함께 파괴되므로 참조만 해제
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+AFPSProjectile* UFPSProjectilePoolSubsystem::AcquireProjectile(TSubclassOf<AFPSProjectile> ProjectileClass, const FTransform& SpawnTransform,
+	AActor* InOwner, APawn* InInstigator, bool bVisualProxy)
+{
+	if (!ProjectileClass || !GetWorld())
+	{
+		return nullptr;
+	}
+
+	FProjectilePool& Pool = Pools.FindOrAdd(ProjectileClass);
+
+	// 처음 사용하는 클래스면 예열
+	if (Pool.GetTotalCount() == 0)
+	{
+		PrewarmPool(ProjectileClass, DefaultPrewarmCount);
+	}
+
+	AFPSProjectile* Projectile = nullptr;
+
+	// 1. 대기 중인 발사체 재사용 (파괴된 항목은 건너뜀)
+	while (!Projectile && Pool.Available.Num() > 0)
+	{
+		AFPSProjectile* Candidate = Pool.Available.Pop(EAllowShrinking::No);
+		if (IsValid(Candidate))
+		{
+			Projectile = Candidate;
+			Pool.Stats.Hits++;
+		}
+	}
+
+	// 2. 풀에 여유가 있으면 새로 생성
+	if (!Projectile && Pool.GetTotalCount() < MaxPoolSize)
+	{
+		Projectile = SpawnPooledProjectile(ProjectileClass);
+		Pool.Stats.Misses++;
+	}
+
+	// 시각 프록시는 없어도 되므로 다른 발사체를 회수하거나 풀 밖에서 만들지 않음
+	if (!Projectile && bVisualProxy)
+	{
+		return nullptr;
+	}
+
+	// 3. 풀이 가득 찬 경우 오버플로 정책 적용 (회수 대상은 Active만, 프록시는 제외)
+	if (!Projectile)
+	{
+		switch (OverflowPolicy)
+		{
+		case EProjectilePoolOverflowPolicy::RecycleOldest:
+			while (!Projectile && Pool.Active.Num() > 0)
+			{
+				AFPSProjectile* Oldest = Pool.Active[0];
+				Pool.Active.RemoveAt(0, EAllowShrinking::No);
+				if (IsValid(Oldest))
+				{
+					Oldest->DeactivateToPool();
+					Projectile = Oldest;
+					Pool.Stats.Recycled++;
+				}
+			}
+			break;
+
+		case EProjectilePoolOverflowPolicy::SpawnNew:
+			Pool.Stats.OverflowSpawned++;
+			return SpawnTransientProjectile(ProjectileClass, SpawnTransform, InOwner, InInstigator);
+
+		case EProjectilePoolOverflowPolicy::Reject:
+		default:
+			Pool.Stats.Rejected++;
+			return nullptr;
+		}
+	}
+
+	if (!Projectile)
+	{
+		return nullptr;
+	}
+
+	if (bVisualProxy)
+	{
+		Pool.Proxies.Add(Projectile);
+	}
+	else
+	{
+		Pool.Active.Add(Projectile);
+	}
+	Projectile->ActivateFromPool(SpawnTransform, InOwner, InInstigator);
+
+	return Projectile;
+}
+
+void UFPSProjectilePoolSubsystem::ReleaseProjectile(AFPSProjectile* Projectile)
+{
+	if (!IsValid(Projectile))
+	{
+		return;
+	}
+
+	FProjectilePool* Pool = Pools.Find(Projectile->GetClass());
+	if (!Pool || (Pool->Active.RemoveSingle(Projectile) == 0 && Pool->Proxies.RemoveSingleSwap(Projectile, EAllowShrinking::No) == 0))
+	{
+		// 이미 반납되었거나 (중복 Release) 이 풀 소속이 아님
+		return;
+	}
+
+	Projectile->DeactivateToPool();
+	Pool->Available.Add(Projectile);
+}
+
+void UFPSProjectilePoolSubsystem::PrewarmPool(TSubclassOf<AFPSProjectile> ProjectileClass, int32 Count)
+{
+	if (!ProjectileClass || !GetWorld())
+	{
+		return;
+	}
+
+	if (Count < 0)
+	{
+		Count = DefaultPrewarmCount;
+	}
+
+	FProjectilePool& Pool = Pools.FindOrAdd(ProjectileClass);
+	const int32 TargetCount = FMath::Min(Count, MaxPoolSize);
+
+	while (Pool.GetTotalCount() < TargetCount)
+	{
+		AFPSProjectile* Projectile = SpawnPooledProjectile(ProjectileClass);
+		if (!Projectile)
+		{
+			break;
+		}
+
+		Pool.Available.Add(Projectile);
+	}
+}
+
+FProjectilePoolStats UFPSProjectilePoolSubsystem::GetPoolStats(TSubclassOf<AFPSProjectile> ProjectileClass) const
+{
+	const FProjectilePool* Pool = Pools.Find(ProjectileClass);
+	if (!Pool)
+	{
+		return FProjectilePoolStats();
+	}
+
+	FProjectilePoolStats Stats = Pool->Stats;
+	Stats.ActiveCount = Pool->Active.Num();
+	Stats.ProxyCount = Pool->Proxies.Num();
+	Stats.AvailableCount = Pool->Available.Num();
+	return Stats;
+}
+
+void UFPSProjectilePoolSubsystem::LogPoolStats() const
+{
+	for (const TPair<TSubclassOf<AFPSProjectile>, FProjectilePool>& Pair : Pools)
+	{
+		const FProjectilePoolStats Stats = GetPoolStats(Pair.Key);
+		const int32 TotalRequests = Stats.Hits + Stats.Misses + Stats.Recycled + Stats.OverflowSpawned + Stats.Rejected;
+
+		UE_LOG(LogFPSCombat, Log, TEXT("발사체 풀 [%s] - 활성: %d, 프록시: %d, 대기: %d, Hit: %d, Miss: %d, 회수: %d, 임시 스폰: %d, 거부: %d (Hit율 %.1f%%)"),
+			*GetNameSafe(Pair.Key.Get()), Stats.ActiveCount, Stats.ProxyCount, Stats.AvailableCount,
+			Stats.Hits, Stats.Misses, Stats.Recycled, Stats.OverflowSpawned, Stats.Rejected,
+			TotalRequests > 0 ? 100.0f * Stats.Hits / TotalRequests : 0.0f);
+	}
+}
+
+AFPSProjectile* UFPSProjectilePoolSubsystem::SpawnPooledProjectile(TSubclassOf<AFPSProjectile> ProjectileClass)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// 지연 스폰: BeginPlay 전에 풀 소속으로 표시해야 수명 타이머가 걸리지 않음
+	AFPSProjectile* Projectile = World->SpawnActorDeferred<AFPSProjectile>(
+		ProjectileClass,
+		FTransform::Identity,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+
+	if (!Projectile)
+	{
+		UE_LOG(LogFPSCombat, Warning, TEXT("발사체 풀: %s 스폰 실패"), *GetNameSafe(ProjectileClass.Get()));
+		return nullptr;
+	}
+
+	FPS_INC_COMBAT_COUNTER(ProjectileActorSpawns);
+
+	Projectile->SetOwningPool(this);
+	Projectile->SetActorEnableCollision(false);
+	Projectile->FinishSpawning(FTransform::Identity);
+	Projectile->DeactivateToPool();
+
+	return Projectile;
+}
+
+AFPSProjectile* UFPSProjectilePoolSubsystem::SpawnTransientProjectile(TSubclassOf<AFPSProjectile> ProjectileClass, const FTransform& SpawnTransform,
+	AActor* InOwner, APawn* InInstigator) const
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.TransformScaleMethod = ESpawnActorScaleMethod::OverrideRootScale;
+	SpawnParams.Owner = InOwner;
+	SpawnParams.Instigator = InInstigator;
+
+	FPS_INC_COMBAT_COUNTER(ProjectileActorSpawns);
+	return GetWorld()->SpawnActor<AFPSProjectile>(ProjectileClass, SpawnTransform, SpawnParams);
+}
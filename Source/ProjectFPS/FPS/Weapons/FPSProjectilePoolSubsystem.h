@@ -0,0 +1,158 @@
+// FPSProjectilePoolSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSProjectilePoolSubsystem.generated.h"
+
+class AFPSProjectile;
+
+/**
+ * 풀이 가득 찼을 때의 처리 방식
+ */
+UENUM(BlueprintType)
+enum class EProjectilePoolOverflowPolicy : uint8
+{
+	SpawnNew      UMETA(DisplayName = "Spawn New"),       // 풀 밖에서 임시 발사체 생성 (반납 시 파괴)
+	RecycleOldest UMETA(DisplayName = "Recycle Oldest"),  // 가장 오래된 활성 발사체를 회수해서 재사용
+	Reject        UMETA(DisplayName = "Reject")           // 발사체 생성 거부 (nullptr 반환)
+};
+
+/**
+ * 발사체 풀 통계
+ * - Hits: 풀에서 재사용에 성공한 횟수
+ * - Misses: 풀이 비어 새로 스폰한 횟수
+ */
+USTRUCT(BlueprintType)
+struct FProjectilePoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 Hits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 Misses = 0;
+
+	/** 오버플로 시 회수(RecycleOldest)된 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 Recycled = 0;
+
+	/** 오버플로 시 풀 밖에서 스폰(SpawnNew)된 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 OverflowSpawned = 0;
+
+	/** 오버플로 시 거부(Reject)된 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 Rejected = 0;
+
+	/** 현재 발사 중인 발사체 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 ActiveCount = 0;
+
+	/** 현재 시각 프록시로 사용 중인 발사체 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 ProxyCount = 0;
+
+	/** 현재 대기 중인 발사체 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool")
+	int32 AvailableCount = 0;
+};
+
+/**
+ * 발사체 클래스별 풀
+ */
+USTRUCT()
+struct FProjectilePool
+{
+	GENERATED_BODY()
+
+	/** 대기 중인 발사체 (숨김/충돌 해제 상태) */
+	UPROPERTY()
+	TArray<TObjectPtr<AFPSProjectile>> Available;
+
+	/** 발사 중인 발사체 (발사 순서대로 정렬, 0번이 가장 오래됨) */
+	UPROPERTY()
+	TArray<TObjectPtr<AFPSProjectile>> Active;
+
+	/** 시뮬레이션 시각 프록시로 빌려준 발사체 (RecycleOldest 회수 대상 아님) */
+	UPROPERTY()
+	TArray<TObjectPtr<AFPSProjectile>> Proxies;
+
+	/** 통계 */
+	FProjectilePoolStats Stats;
+
+	int32 GetTotalCount() const { return Available.Num() + Active.Num() + Proxies.Num(); }
+};
+
+/**
+ * 발사체 풀 서브시스템 (월드 단위)
+ * - 발사체 클래스별로 미리 N개를 스폰해두고 재사용
+ * - 발사 시 Acquire, 명중/수명 만료 시 Release
+ * - 재사용 시 이동/데미지/크리티컬/충돌/타이머 상태를 모두 초기화
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSProjectilePoolSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// ========================================
+	// Pool API
+	// ========================================
+
+	/**
+	 * 풀에서 발사체를 꺼내 발사 상태로 만든다.
+	 * 풀이 가득 차면 OverflowPolicy에 따라 처리 (Reject면 nullptr 반환)
+	 * bVisualProxy: 시뮬레이션 시각 프록시용 (오버플로 정책 없이 풀이 가득 차면 nullptr, 회수 대상에서 제외)
+	 */
+	AFPSProjectile* AcquireProjectile(TSubclassOf<AFPSProjectile> ProjectileClass, const FTransform& SpawnTransform,
+		AActor* InOwner, APawn* InInstigator, bool bVisualProxy = false);
+
+	/** 발사체를 풀로 반납 (명중/수명 만료 시 발사체가 직접 호출) */
+	void ReleaseProjectile(AFPSProjectile* Projectile);
+
+	/** 지정한 클래스의 발사체를 Count개까지 미리 생성 (Count < 0이면 DefaultPrewarmCount 사용) */
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	void PrewarmPool(TSubclassOf<AFPSProjectile> ProjectileClass, int32 Count = -1);
+
+	/** 클래스별 풀 통계 반환 */
+	UFUNCTION(BlueprintPure, Category = "Projectile Pool")
+	FProjectilePoolStats GetPoolStats(TSubclassOf<AFPSProjectile> ProjectileClass) const;
+
+	/** 전체 풀 통계를 로그로 출력 */
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	void LogPoolStats() const;
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 클래스별 기본 예열 개수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Pool", meta = (ClampMin = 0))
+	int32 DefaultPrewarmCount = 16;
+
+	/** 클래스별 최대 풀 크기 (활성 + 대기) */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Pool", meta = (ClampMin = 1))
+	int32 MaxPoolSize = 64;
+
+	/** 풀이 가득 찼을 때의 처리 방식 */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Pool")
+	EProjectilePoolOverflowPolicy OverflowPolicy = EProjectilePoolOverflowPolicy::RecycleOldest;
+
+private:
+	/** 풀 소속 발사체 스폰 (숨김/비활성 상태로 생성) */
+	AFPSProjectile* SpawnPooledProjectile(TSubclassOf<AFPSProjectile> ProjectileClass);
+
+	/** 풀 밖의 임시 발사체 스폰 (SpawnNew 오버플로용) */
+	AFPSProjectile* SpawnTransientProjectile(TSubclassOf<AFPSProjectile> ProjectileClass, const FTransform& SpawnTransform,
+		AActor* InOwner, APawn* InInstigator) const;
+
+	/** 클래스별 풀 */
+	UPROPERTY()
+	TMap<TSubclassOf<AFPSProjectile>, FProjectilePool> Pools;
+};
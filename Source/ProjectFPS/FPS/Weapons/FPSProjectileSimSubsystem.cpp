@@ -0,0 +1,408 @@
+// FPSProjectileSimSubsystem.cpp
+
+#include "FPSProjectileSimSubsystem.h"
+#include "FPSProjectile.h"
+#include "FPSProjectilePoolSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameplayEffect.h"
+#include "Math/VectorRegister.h"
+
+// ========================================
+// FProjectileSimBuffers
+// ========================================
+
+void FProjectileSimBuffers::Add(const FProjectileSimLaunchParams& Params, AFPSProjectile* InProxy)
+{
+	PosX.Add(Params.Location.X);
+	PosY.Add(Params.Location.Y);
+	PosZ.Add(Params.Location.Z);
+	PrevX.Add(Params.Location.X);
+	PrevY.Add(Params.Location.Y);
+	PrevZ.Add(Params.Location.Z);
+	VelX.Add(Params.Velocity.X);
+	VelY.Add(Params.Velocity.Y);
+	VelZ.Add(Params.Velocity.Z);
+	GravityZ.Add(Params.GravityZ);
+	LifeRemaining.Add(Params.LifeSeconds);
+	Radius.Add(Params.Radius);
+	Damage.Add(Params.Damage);
+	bCritical.Add(Params.bCritical ? 1 : 0);
+	Instigator.Add(Params.Instigator);
+	DamageCauser.Add(Params.DamageCauser);
+	DamageEffectClass.Add(Params.DamageEffectClass);
+	ProjectileClass.Add(Params.ProjectileClass);
+	Proxy.Add(InProxy);
+	SweepQuery.AddDefaulted();
+}
+
+void FProjectileSimBuffers::RemoveAtSwap(int32 Index)
+{
+	PosX.RemoveAtSwap(Index, EAllowShrinking::No);
+	PosY.RemoveAtSwap(Index, EAllowShrinking::No);
+	PosZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	PrevX.RemoveAtSwap(Index, EAllowShrinking::No);
+	PrevY.RemoveAtSwap(Index, EAllowShrinking::No);
+	PrevZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	VelX.RemoveAtSwap(Index, EAllowShrinking::No);
+	VelY.RemoveAtSwap(Index, EAllowShrinking::No);
+	VelZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	GravityZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	LifeRemaining.RemoveAtSwap(Index, EAllowShrinking::No);
+	Radius.RemoveAtSwap(Index, EAllowShrinking::No);
+	Damage.RemoveAtSwap(Index, EAllowShrinking::No);
+	bCritical.RemoveAtSwap(Index, EAllowShrinking::No);
+	Instigator.RemoveAtSwap(Index, EAllowShrinking::No);
+	DamageCauser.RemoveAtSwap(Index, EAllowShrinking::No);
+	DamageEffectClass.RemoveAtSwap(Index, EAllowShrinking::No);
+	ProjectileClass.RemoveAtSwap(Index, EAllowShrinking::No);
+	Proxy.RemoveAtSwap(Index, EAllowShrinking::No);
+	SweepQuery.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void FProjectileSimBuffers::Empty()
+{
+	*this = FProjectileSimBuffers();
+}
+
+// ========================================
+// UFPSProjectileSimSubsystem
+// ========================================
+
+void UFPSProjectileSimSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SweepParams = FCollisionQueryParams(SCENE_QUERY_STAT(FPSProjectileSim), false);
+
+	SweepObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	SweepObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	SweepObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+}
+
+void UFPSProjectileSimSubsystem::Deinitialize()
+{
+	Buffers.Empty();
+	NumVisualProxies = 0;
+
+	Super::Deinitialize();
+}
+
+bool UFPSProjectileSimSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UFPSProjectileSimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSProjectileSimSubsystem, STATGROUP_Tickables);
+}
+
+bool UFPSProjectileSimSubsystem::LaunchProjectile(const FProjectileSimLaunchParams& Params)
+{
+	if (Buffers.Num() >= MaxProjectiles)
+	{
+		return false;
+	}
+
+	// 시각 프록시 (선택): 풀에서 꺼내서 충돌/이동 없이 위치만 따라가게 함
+	// 풀이 가득 차면 프록시 없이 시뮬레이션만 (다른 발사체/프록시를 회수하지 않음)
+	AFPSProjectile* VisualProxy = nullptr;
+	const bool bCanSpawnProxy = bSpawnVisualProxies && Params.ProjectileClass
+		&& NumVisualProxies < MaxVisualProxies && GetWorld()->GetNetMode() != NM_DedicatedServer;
+
+	if (bCanSpawnProxy)
+	{
+		if (UFPSProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UFPSProjectilePoolSubsystem>())
+		{
+			const FTransform ProxyTransform(Params.Velocity.Rotation(), Params.Location);
+			VisualProxy = ProjectilePool->AcquireProjectile(Params.ProjectileClass, ProxyTransform, Params.DamageCauser, Params.Instigator, true);
+			if (VisualProxy)
+			{
+				VisualProxy->EnterVisualProxyMode();
+				NumVisualProxies++;
+			}
+		}
+	}
+
+	Buffers.Add(Params, VisualProxy);
+	return true;
+}
+
+void UFPSProjectileSimSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Buffers.Num() == 0)
+	{
+		return;
+	}
+
+	// 1. 적분 (SoA + SIMD)
+	IntegrateProjectiles(DeltaTime);
+
+	// 2. 일괄 스윕 + 수명 만료 판정
+	PendingRemovals.Reset();
+
+	UFPSAsyncQuerySubsystem* AsyncQuery = bUseAsyncSweeps ? GetWorld()->GetSubsystem<UFPSAsyncQuerySubsystem>() : nullptr;
+
+	const int32 Count = Buffers.Num();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		bool bFinished = false;
+
+		if (AsyncQuery)
+		{
+			bFinished = UpdateAsyncSweep(Index, AsyncQuery);
+		}
+		else
+		{
+			FHitResult Hit;
+			bFinished = SweepProjectile(Index, Hit) && ResolveHit(Index, Hit);
+		}
+
+		if (bFinished || Buffers.LifeRemaining[Index] <= 0.0f)
+		{
+			PendingRemovals.Add(Index);
+		}
+	}
+
+	// 3. 제거 (뒤에서부터 Swap 제거해야 앞쪽 인덱스가 유지됨)
+	for (int32 RemovalIndex = PendingRemovals.Num() - 1; RemovalIndex >= 0; --RemovalIndex)
+	{
+		RemoveProjectile(PendingRemovals[RemovalIndex]);
+	}
+
+	// 4. 시각 프록시 갱신
+	UpdateVisualProxies();
+}
+
+void UFPSProjectileSimSubsystem::IntegrateProjectiles(float DeltaTime)
+{
+	const int32 Count = Buffers.Num();
+
+	// 스윕 시작점 저장 (비동기 스윕은 요청 시점에 갱신)
+	if (!bUseAsyncSweeps)
+	{
+		FMemory::Memcpy(Buffers.PrevX.GetData(), Buffers.PosX.GetData(), Count * sizeof(float));
+		FMemory::Memcpy(Buffers.PrevY.GetData(), Buffers.PosY.GetData(), Count * sizeof(float));
+		FMemory::Memcpy(Buffers.PrevZ.GetData(), Buffers.PosZ.GetData(), Count * sizeof(float));
+	}
+
+	float* RESTRICT PosX = Buffers.PosX.GetData();
+	float* RESTRICT PosY = Buffers.PosY.GetData();
+	float* RESTRICT PosZ = Buffers.PosZ.GetData();
+	const float* RESTRICT VelX = Buffers.VelX.GetData();
+	const float* RESTRICT VelY = Buffers.VelY.GetData();
+	float* RESTRICT VelZ = Buffers.VelZ.GetData();
+	const float* RESTRICT GravityZ = Buffers.GravityZ.GetData();
+	float* RESTRICT LifeRemaining = Buffers.LifeRemaining.GetData();
+
+	// 4개씩 SIMD 처리: V.z += G * dt, P += V * dt, Life -= dt
+	const VectorRegister4Float DeltaVec = VectorSetFloat1(DeltaTime);
+	const int32 SimdCount = Count & ~3;
+
+	for (int32 Index = 0; Index < SimdCount; Index += 4)
+	{
+		const VectorRegister4Float NewVelZ = VectorMultiplyAdd(VectorLoad(GravityZ + Index), DeltaVec, VectorLoad(VelZ + Index));
+		VectorStore(NewVelZ, VelZ + Index);
+
+		VectorStore(VectorMultiplyAdd(VectorLoad(VelX + Index), DeltaVec, VectorLoad(PosX + Index)), PosX + Index);
+		VectorStore(VectorMultiplyAdd(VectorLoad(VelY + Index), DeltaVec, VectorLoad(PosY + Index)), PosY + Index);
+		VectorStore(VectorMultiplyAdd(NewVelZ, DeltaVec, VectorLoad(PosZ + Index)), PosZ + Index);
+
+		VectorStore(VectorSubtract(VectorLoad(LifeRemaining + Index), DeltaVec), LifeRemaining + Index);
+	}
+
+	// 나머지 (4개 미만)
+	for (int32 Index = SimdCount; Index < Count; ++Index)
+	{
+		VelZ[Index] += GravityZ[Index] * DeltaTime;
+		PosX[Index] += VelX[Index] * DeltaTime;
+		PosY[Index] += VelY[Index] * DeltaTime;
+		PosZ[Index] += VelZ[Index] * DeltaTime;
+		LifeRemaining[Index] -= DeltaTime;
+	}
+}
+
+bool UFPSProjectileSimSubsystem::SweepProjectile(int32 Index, FHitResult& OutHit)
+{
+	const FVector Start(Buffers.PrevX[Index], Buffers.PrevY[Index], Buffers.PrevZ[Index]);
+	const FVector End(Buffers.PosX[Index], Buffers.PosY[Index], Buffers.PosZ[Index]);
+
+	if (Start.Equals(End))
+	{
+		return false;
+	}
+
+	PrepareSweepParams(Index);
+
+	SweepHits.Reset();
+	GetWorld()->SweepMultiByObjectType(SweepHits, Start, End, FQuat::Identity, SweepObjectParams,
+		FCollisionShape::MakeSphere(Buffers.Radius[Index]), SweepParams);
+
+	return FindFirstValidHit(Index, SweepHits, OutHit);
+}
+
+bool UFPSProjectileSimSubsystem::UpdateAsyncSweep(int32 Index, UFPSAsyncQuerySubsystem* AsyncQuery)
+{
+	FFPSAsyncQueryHandle& Query = Buffers.SweepQuery[Index];
+
+	// 1. 지난 프레임에 요청한 구간의 결과 반영
+	if (Query.IsValid())
+	{
+		const FFPSAsyncQueryResult* Result = AsyncQuery->GetResult(Query);
+		if (!Result && AsyncQuery->GetStatus(Query) != EFPSAsyncQueryStatus::Invalid)
+		{
+			// 아직 진행 중 (예산 초과로 대기) - 스윕하지 않은 구간은 다음 요청에 포함됨
+			return false;
+		}
+
+		FHitResult Hit;
+		const bool bFinished = Result && FindFirstValidHit(Index, Result->Hits, Hit) && ResolveHit(Index, Hit);
+		AsyncQuery->ReleaseQuery(Query);
+
+		if (bFinished)
+		{
+			return true;
+		}
+	}
+
+	// 2. 아직 스윕하지 않은 구간 (마지막 요청 지점 -> 현재 위치) 요청
+	const FVector Start(Buffers.PrevX[Index], Buffers.PrevY[Index], Buffers.PrevZ[Index]);
+	const FVector End(Buffers.PosX[Index], Buffers.PosY[Index], Buffers.PosZ[Index]);
+
+	if (!Start.Equals(End))
+	{
+		PrepareSweepParams(Index);
+		Query = AsyncQuery->SubmitSweepByObjectType(this, Start, End, FCollisionShape::MakeSphere(Buffers.Radius[Index]),
+			SweepObjectParams, SweepParams);
+
+		Buffers.PrevX[Index] = End.X;
+		Buffers.PrevY[Index] = End.Y;
+		Buffers.PrevZ[Index] = End.Z;
+	}
+
+	return false;
+}
+
+bool UFPSProjectileSimSubsystem::FindFirstValidHit(int32 Index, const TArray<FHitResult>& Hits, FHitResult& OutHit) const
+{
+	APawn* ShotInstigator = Buffers.Instigator[Index].Get();
+
+	for (const FHitResult& Hit : Hits)
+	{
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor)
+		{
+			continue;
+		}
+
+		// Owner에 속한 충돌체는 무시 (ex.방어막 안에서 발사)
+		if (ShotInstigator && HitActor->GetOwner() == ShotInstigator)
+		{
+			continue;
+		}
+
+		OutHit = Hit;
+		return true;
+	}
+
+	return false;
+}
+
+void UFPSProjectileSimSubsystem::PrepareSweepParams(int32 Index)
+{
+	SweepParams.ClearIgnoredActors();
+	SweepParams.AddIgnoredActor(Buffers.Instigator[Index].Get());
+	SweepParams.AddIgnoredActor(Buffers.DamageCauser[Index].Get());
+}
+
+bool UFPSProjectileSimSubsystem::ResolveHit(int32 Index, const FHitResult& Hit)
+{
+	AActor* HitActor = Hit.GetActor();
+
+	// Pawn에 충돌: 데미지 적용 (ASC가 없는 Pawn은 발사체 액터와 동일하게 통과)
+	if (HitActor->IsA<APawn>())
+	{
+		const bool bApplied = AFPSProjectile::ApplyDamageEffect(HitActor, Buffers.DamageEffectClass[Index], Buffers.Damage[Index],
+			Buffers.bCritical[Index] != 0, Buffers.Instigator[Index].Get(), Buffers.DamageCauser[Index].Get(), &Hit);
+
+		if (!bApplied)
+		{
+			return false;
+		}
+	}
+
+	// 명중 연출: 프록시가 있으면 프록시 (Blueprint 이벤트 포함), 없으면 클래스 기본값
+	if (GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		if (AFPSProjectile* VisualProxy = Buffers.Proxy[Index].Get())
+		{
+			VisualProxy->SetActorLocation(Hit.Location);
+			VisualProxy->PlayHitEffects(Hit.ImpactPoint);
+			VisualProxy->OnProjectileHit(Hit);
+		}
+		else if (Buffers.ProjectileClass[Index])
+		{
+			Buffers.ProjectileClass[Index].GetDefaultObject()->PlayHitEffectsInWorld(GetWorld(), Hit.ImpactPoint);
+		}
+	}
+
+	return true;
+}
+
+void UFPSProjectileSimSubsystem::UpdateVisualProxies()
+{
+	if (NumVisualProxies == 0)
+	{
+		return;
+	}
+
+	const int32 Count = Buffers.Num();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		AFPSProjectile* VisualProxy = Buffers.Proxy[Index].Get();
+		if (!VisualProxy)
+		{
+			continue;
+		}
+
+		const FVector Location(Buffers.PosX[Index], Buffers.PosY[Index], Buffers.PosZ[Index]);
+		const FVector Velocity(Buffers.VelX[Index], Buffers.VelY[Index], Buffers.VelZ[Index]);
+		VisualProxy->SetActorLocationAndRotation(Location, Velocity.Rotation());
+	}
+}
+
+void UFPSProjectileSimSubsystem::RemoveProjectile(int32 Index)
+{
+	if (Buffers.SweepQuery[Index].IsValid())
+	{
+		if (UFPSAsyncQuerySubsystem* AsyncQuery = GetWorld()->GetSubsystem<UFPSAsyncQuerySubsystem>())
+		{
+			AsyncQuery->ReleaseQuery(Buffers.SweepQuery[Index]);
+		}
+	}
+
+	if (Buffers.Proxy[Index].IsValid())
+	{
+		AFPSProjectile* VisualProxy = Buffers.Proxy[Index].Get();
+		UFPSProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UFPSProjectilePoolSubsystem>();
+
+		if (VisualProxy->IsPooled() && ProjectilePool)
+		{
+			ProjectilePool->ReleaseProjectile(VisualProxy);
+		}
+		else
+		{
+			VisualProxy->Destroy();
+		}
+	}
+
+	if (!Buffers.Proxy[Index].IsExplicitlyNull())
+	{
+		NumVisualProxies--;
+	}
+
+	Buffers.RemoveAtSwap(Index);
+}
@@ -0,0 +1,190 @@
+// FPSProjectileSimSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPS/FPSAsyncQuerySubsystem.h"
+#include "FPSProjectileSimSubsystem.generated.h"
+
+class AFPSProjectile;
+class UGameplayEffect;
+
+/**
+ * 시뮬레이션 발사체 발사 파라미터
+ */
+struct FProjectileSimLaunchParams
+{
+	/** 발사 위치 */
+	FVector Location = FVector::ZeroVector;
+
+	/** 초기 속도 (방향 * 속력) */
+	FVector Velocity = FVector::ZeroVector;
+
+	/** 수명 (초) */
+	float LifeSeconds = 7.0f;
+
+	/** 충돌 반경 */
+	float Radius = 15.0f;
+
+	/** 중력 가속도 Z (WorldGravityZ * GravityScale) */
+	float GravityZ = 0.0f;
+
+	/** 데미지 (크리티컬 반영된 최종값) */
+	float Damage = 0.0f;
+
+	/** 크리티컬 여부 */
+	bool bCritical = false;
+
+	/** 데미지 GameplayEffect 클래스 */
+	TSubclassOf<UGameplayEffect> DamageEffectClass;
+
+	/** 공격자 */
+	APawn* Instigator = nullptr;
+
+	/** 데미지 원인 (무기) */
+	AActor* DamageCauser = nullptr;
+
+	/** 발사체 클래스 (명중 연출 기본값 / 시각 프록시용, 없으면 프록시 없음) */
+	TSubclassOf<AFPSProjectile> ProjectileClass;
+};
+
+/**
+ * 발사체 시뮬레이션 버퍼 (Structure of Arrays)
+ * - 적분 커널이 4개씩 SIMD로 처리할 수 있도록 성분별로 분리
+ * - 모든 배열은 항상 같은 길이를 유지
+ */
+struct FProjectileSimBuffers
+{
+	// 위치 / 이전 위치 (아직 스윕하지 않은 구간의 시작점) / 속도
+	TArray<float> PosX, PosY, PosZ;
+	TArray<float> PrevX, PrevY, PrevZ;
+	TArray<float> VelX, VelY, VelZ;
+
+	// 중력, 남은 수명, 충돌 반경, 데미지
+	TArray<float> GravityZ;
+	TArray<float> LifeRemaining;
+	TArray<float> Radius;
+	TArray<float> Damage;
+
+	// 크리티컬 여부 (0/1)
+	TArray<uint8> bCritical;
+
+	// 판정/연출 참조
+	TArray<TWeakObjectPtr<APawn>> Instigator;
+	TArray<TWeakObjectPtr<AActor>> DamageCauser;
+	TArray<TSubclassOf<UGameplayEffect>> DamageEffectClass;
+	TArray<TSubclassOf<AFPSProjectile>> ProjectileClass;
+	TArray<TWeakObjectPtr<AFPSProjectile>> Proxy;
+
+	// 진행 중인 비동기 스윕 (bUseAsyncSweeps)
+	TArray<FFPSAsyncQueryHandle> SweepQuery;
+
+	int32 Num() const { return PosX.Num(); }
+
+	void Add(const FProjectileSimLaunchParams& Params, AFPSProjectile* InProxy);
+	void RemoveAtSwap(int32 Index);
+	void Empty();
+};
+
+/**
+ * 발사체 시뮬레이션 서브시스템 (월드 단위)
+ * - 비행 중인 모든 시뮬레이션 발사체를 한 번의 패스로 처리
+ *   1) SoA 버퍼를 SIMD 커널로 적분 (위치/속도/수명)
+ *   2) 이전 위치 -> 현재 위치 스윕을 일괄 처리
+ *   3) 명중/수명 만료 항목 제거
+ * - 발사체 액터는 선택적인 시각 프록시 (충돌/이동 컴포넌트 비활성)
+ * - 설정은 DefaultGame.ini의 [/Script/ProjectFPS.FPSProjectileSimSubsystem] 섹션
+ */
+UCLASS(Config = Game)
+class PROJECTFPS_API UFPSProjectileSimSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UTickableWorldSubsystem
+	// ========================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** 시뮬레이션 발사체 발사 (수용 한도 초과 시 false) */
+	bool LaunchProjectile(const FProjectileSimLaunchParams& Params);
+
+	/** 비행 중인 발사체 수 */
+	UFUNCTION(BlueprintPure, Category = "Projectile Simulation")
+	int32 GetLiveProjectileCount() const { return Buffers.Num(); }
+
+	/** 현재 시각 프록시 수 */
+	UFUNCTION(BlueprintPure, Category = "Projectile Simulation")
+	int32 GetVisualProxyCount() const { return NumVisualProxies; }
+
+	// ========================================
+	// Settings (Config)
+	// ========================================
+
+	/** 동시에 시뮬레이션할 최대 발사체 수 */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Simulation", meta = (ClampMin = 1))
+	int32 MaxProjectiles = 8192;
+
+	/** 시각 프록시 사용 여부 (데디케이티드 서버에서는 항상 비활성) */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Simulation")
+	bool bSpawnVisualProxies = true;
+
+	/** 동시에 표시할 최대 시각 프록시 수 (초과분이나 발사체 풀이 가득 찬 경우 프록시 없이 시뮬레이션만) */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Simulation", meta = (ClampMin = 0))
+	int32 MaxVisualProxies = 256;
+
+	/** 스윕을 비동기 쿼리 서비스로 요청 (명중 판정이 1프레임 늦어지는 대신 게임 스레드가 대기하지 않음) */
+	UPROPERTY(Config, EditAnywhere, Category = "Projectile Simulation")
+	bool bUseAsyncSweeps = true;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** SIMD 적분 커널 (반암시적 오일러) */
+	void IntegrateProjectiles(float DeltaTime);
+
+	/** 이전 위치 -> 현재 위치 스윕 (첫 번째 유효 충돌 반환) */
+	bool SweepProjectile(int32 Index, FHitResult& OutHit);
+
+	/** 비동기 스윕 처리: 지난 프레임 결과 반영 후 새 구간 요청 (종료해야 하면 true) */
+	bool UpdateAsyncSweep(int32 Index, UFPSAsyncQuerySubsystem* AsyncQuery);
+
+	/** 충돌 목록에서 첫 번째 유효 충돌 찾기 (Owner 소속 충돌체 제외) */
+	bool FindFirstValidHit(int32 Index, const TArray<FHitResult>& Hits, FHitResult& OutHit) const;
+
+	/** 스윕 파라미터 설정 (Instigator/무기 무시) */
+	void PrepareSweepParams(int32 Index);
+
+	/** 명중 처리 (종료해야 하면 true) */
+	bool ResolveHit(int32 Index, const FHitResult& Hit);
+
+	/** 시각 프록시 위치 갱신 */
+	void UpdateVisualProxies();
+
+	/** 항목 제거 (프록시 반납 포함) */
+	void RemoveProjectile(int32 Index);
+
+	/** 시뮬레이션 버퍼 */
+	FProjectileSimBuffers Buffers;
+
+	/** 이번 프레임 제거 대상 (오름차순) */
+	TArray<int32> PendingRemovals;
+
+	/** 스윕 결과 버퍼 (프레임 간 재사용) */
+	TArray<FHitResult> SweepHits;
+
+	/** 스윕 파라미터 (프레임 간 재사용) */
+	FCollisionQueryParams SweepParams;
+
+	/** 스윕 대상 오브젝트 타입 (발사체 충돌 설정과 동일) */
+	FCollisionObjectQueryParams SweepObjectParams;
+
+	/** 현재 시각 프록시 수 */
+	int32 NumVisualProxies = 0;
+};
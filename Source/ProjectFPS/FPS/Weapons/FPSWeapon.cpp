@@ -1,8 +1,14 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FPSWeapon.h"
+#include "FPS/FPSLog.h"
 #include "FPSWeaponHolder.h"
 #include "FPSProjectile.h"
+#include "FPSProjectilePoolSubsystem.h"
+#include "FPSHitscanSubsystem.h"
+#include "FPSProjectileSimSubsystem.h"
+#include "FPSFireClockSubsystem.h"
+#include "FPS/FPSSpatialHashSubsystem.h"
 #include "FPS/Items/WeaponItemData.h"
 #include "FPS/Components/PickupTriggerComponent.h"
 #include "FPS/FPSCharacter.h"
@@ -10,10 +16,14 @@
 #include "FPS/Components/WeaponSlotComponent.h"
 #include "FPS/Components/InventoryComponent.h"
 #include "FPS/PlayerAttributeSet.h"
+#include "FPS/GameplayEffect_Damage.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/SceneComponent.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
 #include "NiagaraComponent.h"
 #include "NiagaraSystem.h"
+#include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/World.h"
@@ -21,6 +31,10 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
+#include "FPS/FPSGameplayTags.h"
+#include "FPS/FPSStateGate.h"
+#include "FPS/FPSRandomSubsystem.h"
+#include "FPS/FPSEffectPoolSubsystem.h"
 
 AFPSWeapon::AFPSWeapon()
 {
@@ -95,10 +109,14 @@ void AFPSWeapon::BeginPlay()
 	WeaponOwner = Cast<IFPSWeaponHolder>(GetOwner());
 	PawnOwner = Cast<APawn>(GetOwner());
 
+	// 무기별 난수 스트림 (매치 시드 기반, 실행 간 재현 가능)
+	CritStream = &UFPSRandomSubsystem::GetStreamFor(this, FPSRandomStreams::Crit);
+	SpreadStream = &UFPSRandomSubsystem::GetStreamFor(this, FPSRandomStreams::Spread);
+
 	// WeaponItemData 유효성 검사
 	if (!WeaponItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AFPSWeapon::BeginPlay: WeaponItemData가 설정되지 않았습니다! %s"), *GetName());
+		UE_LOG(LogFPSCombat, Warning, TEXT("AFPSWeapon::BeginPlay: WeaponItemData가 설정되지 않았습니다! %s"), *GetName());
 	}
 
 	// HUD 업데이트
@@ -106,14 +124,44 @@ void AFPSWeapon::BeginPlay()
 	{
 		WeaponOwner->UpdateWeaponHUD(WeaponItemData->CurrentAmmo, WeaponItemData->MagazineSize);
 	}
+
+	// 드롭 상태면 픽업 근접 쿼리용 공간 해시 등록 (장착 중에는 등록하지 않음)
+	if (bIsDropped)
+	{
+		if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+		{
+			SpatialHash->Register(this, EFPSSpatialCategory::Pickupable);
+		}
+	}
 }
 
 void AFPSWeapon::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
-	// 활성 타이머 모두 정리
-	if (GetWorld())
+	// 연사 시계 정리
+	if (UWorld* World = GetWorld())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(RefireTimer);
+		if (UFPSFireClockSubsystem* FireClock = World->GetSubsystem<UFPSFireClockSubsystem>())
+		{
+			FireClock->StopClock(this);
+		}
+	}
+
+	UnbindCombatStats();
+
+	if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->Unregister(this);
+	}
+
+	// 난수 스트림 해제
+	CritStream = nullptr;
+	SpreadStream = nullptr;
+	if (UWorld* World = GetWorld())
+	{
+		if (UFPSRandomSubsystem* RandomSubsystem = World->GetSubsystem<UFPSRandomSubsystem>())
+		{
+			RandomSubsystem->ReleaseStreams(this);
+		}
 	}
 
 	Super::EndPlay(EndPlayReason);
@@ -146,7 +194,7 @@ void AFPSWeapon::Tick(float DeltaTime)
 void AFPSWeapon::OnOwnerDestroyed(AActor* DestroyedActor)
 {
 	// 소유자가 파괴됨, 정리 작업
-	UE_LOG(LogTemp, Warning, TEXT("무기 소유자 파괴됨 - 무기도 파괴: %s"), *GetName());
+	UE_LOG(LogFPSCombat, Warning, TEXT("무기 소유자 파괴됨 - 무기도 파괴: %s"), *GetName());
 
 	WeaponOwner = nullptr;
 	PawnOwner = nullptr;
@@ -178,6 +226,19 @@ void AFPSWeapon::ActivateWeapon()
 	// 무기 메시를 소유자에게 부착
 	WeaponOwner->AttachWeaponMeshes(this);
 
+	// 첫 발사 때 스폰 히치가 없도록 발사체 풀 예열
+	const bool bUsesProjectiles = !WeaponItemData || !WeaponItemData->IsHitscan();
+	if (bUsesProjectiles && ProjectileClass && ProjectileClass->IsChildOf(AFPSProjectile::StaticClass()))
+	{
+		if (UFPSProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UFPSProjectilePoolSubsystem>())
+		{
+			ProjectilePool->PrewarmPool(TSubclassOf<AFPSProjectile>(ProjectileClass.Get()));
+		}
+	}
+
+	// 발사 계산용 전투 스탯 캐시
+	BindCombatStats();
+
 	// 무기가 활성화되었음을 소유자에게 알림
 	WeaponOwner->OnWeaponActivated(this);
 
@@ -198,6 +259,9 @@ void AFPSWeapon::DeactivateWeapon()
 	// 현재 발사 중이면 발사 중지
 	StopFiring();
 
+	// 전투 스탯 캐시 해제
+	UnbindCombatStats();
+
 	// 무기가 비활성화되었음을 소유자에게 알림
 	WeaponOwner->OnWeaponDeactivated(this);
 
@@ -214,30 +278,18 @@ void AFPSWeapon::StartFiring()
 	// WeaponItemData 확인
 	if (!WeaponItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StartFiring: WeaponItemData가 null입니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("StartFiring: WeaponItemData가 null입니다"));
 		return;
 	}
 
-	// 리로드 중인지 확인 (AbilitySystemComponent를 통해)
+	// 발사를 막는 상태인지 확인 (ex.리로드 중, 상태 태그 카운트 조회)
 	if (PawnOwner->Implements<UAbilitySystemInterface>())
 	{
-		if (UAbilitySystemComponent* ASC = Cast<IAbilitySystemInterface>(PawnOwner)->GetAbilitySystemComponent())
+		FGameplayTag BlockingTag;
+		if (FPSStateGate::IsBlocked(Cast<IAbilitySystemInterface>(PawnOwner)->GetAbilitySystemComponent(), EFPSGatedAction::Fire, &BlockingTag))
 		{
-			// 모든 활성화 가능한 어빌리티를 확인
-			const TArray<FGameplayAbilitySpec>& Abilities = ASC->GetActivatableAbilities();
-			for (const FGameplayAbilitySpec& Spec : Abilities)
-			{
-				// 활성화된 어빌리티이고 리로드 태그를 가지고 있는지 확인
-				if (Spec.IsActive() && Spec.Ability)
-				{
-					const FGameplayTagContainer& AssetTags = Spec.Ability->GetAssetTags();
-					if (AssetTags.HasTag(FGameplayTag::RequestGameplayTag(FName("Ability.Reload"))))
-					{
-						UE_LOG(LogTemp, Warning, TEXT("StartFiring: 리로드 중이므로 발사 불가"));
-						return;
-					}
-				}
-			}
+			UE_LOG(LogFPSCombat, Verbose, TEXT("%s 불가: %s 상태"), FPSStateGate::GetActionName(EFPSGatedAction::Fire), *BlockingTag.ToString());
+			return;
 		}
 	}
 
@@ -245,7 +297,7 @@ void AFPSWeapon::StartFiring()
 	if (WeaponItemData->IsAmmoEmpty())
 	{
 		// TODO: 빈 무기 사운드/애니메이션 재생
-		UE_LOG(LogTemp, Warning, TEXT("StartFiring: 탄약이 없음"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("StartFiring: 탄약이 없음"));
 		return;
 	}
 
@@ -258,7 +310,7 @@ void AFPSWeapon::StartFiring()
 		if (UAbilitySystemComponent* ASC = Cast<IAbilitySystemInterface>(PawnOwner)->GetAbilitySystemComponent())
 		{
 			// 발사 어빌리티 활성화 시도
-			if (ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(FName("Ability.Fire")))))
+			if (ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(FPSGameplayTags::Ability_Fire)))
 			{
 				// 어빌리티 활성화 성공, 어빌리티가 Fire() 호출 처리
 				return;
@@ -275,11 +327,89 @@ void AFPSWeapon::StopFiring()
 	// 발사 플래그 해제
 	bIsFiring = false;
 
-	// 연사 타이머 정리
-	if (GetWorld())
+	// 연사 시계 정리
+	if (UWorld* World = GetWorld())
+	{
+		if (UFPSFireClockSubsystem* FireClock = World->GetSubsystem<UFPSFireClockSubsystem>())
+		{
+			FireClock->StopClock(this);
+		}
+	}
+
+	// 진행 중인 버스트는 중단으로 종료
+	FinishBurst(false);
+}
+
+bool AFPSWeapon::StartBurst(int32 ShotCount, float Duration, float Cadence)
+{
+	if (ShotCount <= 0 && Duration <= 0.0f)
+	{
+		UE_LOG(LogFPSCombat, Warning, TEXT("StartBurst: 발사 수와 지속 시간이 모두 지정되지 않음"));
+		return false;
+	}
+
+	// 일반 발사(플레이어 입력 등) 중에는 덮어쓰지 않음
+	if (bIsFiring && !bInBurst)
+	{
+		return false;
+	}
+
+	// 진행 중인 버스트는 중단 후 새로 시작
+	if (bInBurst)
+	{
+		StopFiring();
+	}
+
+	bInBurst = true;
+	BurstShotLimit = FMath::Max(ShotCount, 0);
+	BurstShotsFired = 0;
+	BurstCadence = FMath::Max(Cadence, 0.0f);
+	BurstEndTime = Duration > 0.0f ? GetWorld()->GetTimeSeconds() + Duration : TNumericLimits<double>::Max();
+
+	StartFiring();
+
+	// 첫 발로 끝난 버스트는 이미 종료 알림까지 처리됨
+	if (bIsFiring || BurstShotsFired > 0)
+	{
+		return true;
+	}
+
+	// 발사 불가 (탄약 없음/발사 차단 상태 등)
+	bInBurst = false;
+	return false;
+}
+
+void AFPSWeapon::FinishBurst(bool bCompleted)
+{
+	if (!bInBurst)
+	{
+		return;
+	}
+
+	// 발사를 먼저 멈춘 뒤 알림 (콜백에서 바로 다음 버스트를 시작할 수 있도록)
+	bInBurst = false;
+	if (bIsFiring)
+	{
+		StopFiring();
+	}
+
+	OnBurstFinished.Broadcast(this, BurstShotsFired, bCompleted);
+}
+
+bool AFPSWeapon::FinishExpiredBurst(double CurrentTime)
+{
+	if (!bInBurst || CurrentTime <= BurstEndTime)
 	{
-		GetWorld()->GetTimerManager().ClearTimer(RefireTimer);
+		return false;
 	}
+
+	FinishBurst(true);
+	return true;
+}
+
+float AFPSWeapon::GetFireClockInterval() const
+{
+	return (bInBurst && BurstCadence > 0.0f) ? BurstCadence : GetCurrentRefireRate();
 }
 
 void AFPSWeapon::Fire()
@@ -289,21 +419,67 @@ void AFPSWeapon::Fire()
 		return;
 	}
 
-	// 탄약이 있는지 확인
-	if (!WeaponItemData->ConsumeAmmo())
+	if (!FireShot())
 	{
-		StopFiring();
 		return;
 	}
 
 	// 마지막 발사 시간 업데이트
 	TimeOfLastShot = GetWorld()->GetTimeSeconds();
 
+	// 한 발짜리 버스트는 여기서 끝남
+	if (!bIsFiring)
+	{
+		return;
+	}
+
+	// 이후 연사(자동, 버스트) / 쿨다운 알림(반자동)은 연사 시계가 처리 (AttackSpeedMultiplier 반영)
+	if (UFPSFireClockSubsystem* FireClock = GetWorld()->GetSubsystem<UFPSFireClockSubsystem>())
+	{
+		FireClock->StartClock(this, WeaponItemData->bIsAutomatic || bInBurst);
+	}
+}
+
+void AFPSWeapon::FireClockShot(const FFireClockShot& Shot)
+{
+	if (!WeaponOwner || !bIsFiring || !WeaponItemData)
+	{
+		StopFiring();
+		return;
+	}
+
+	// 버스트 시간이 지났으면 이 발사는 하지 않고 종료
+	if (bInBurst && Shot.Timestamp > BurstEndTime)
+	{
+		FinishBurst(true);
+		return;
+	}
+
+	// 프레임 내 실제 발사 시각/총구 위치 기준으로 발사
+	TimeOfLastShot = static_cast<float>(Shot.Timestamp);
+
+	ActiveClockShot = &Shot;
+	FireShot();
+	ActiveClockShot = nullptr;
+}
+
+bool AFPSWeapon::FireShot()
+{
+	// 탄약이 있는지 확인
+	if (!WeaponItemData->ConsumeAmmo())
+	{
+		StopFiring();
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_FPSShotsFired);
+	FPS_INC_COMBAT_COUNTER(ShotsFired);
+
 	// 목표를 향해 발사체 발사
 	FireProjectile(WeaponOwner->GetWeaponTargetLocation());
 
 	// 발사 몽타주 재생
-	if (FiringMontage)
+	if (FiringMontage && bCosmeticsEnabled)
 	{
 		WeaponOwner->PlayFiringMontage(FiringMontage);
 	}
@@ -320,17 +496,13 @@ void AFPSWeapon::Fire()
 	// 크로스헤어 확산 업데이트 (발사 반동)
 	WeaponOwner->UpdateCrosshairFiringSpread(WeaponItemData->CrosshairRecoilSpread);
 
-	// 자동 무기의 연사 처리
-	if (WeaponItemData->bIsAutomatic && bIsFiring)
-	{
-		// 다음 발사 예약 (AttackSpeedMultiplier 반영)
-		GetWorld()->GetTimerManager().SetTimer(RefireTimer, this, &AFPSWeapon::Fire, GetCurrentRefireRate(), false);
-	}
-	else
+	// 버스트: 발사 수를 채우면 종료
+	if (bInBurst && ++BurstShotsFired == BurstShotLimit)
 	{
-		// 반자동 무기의 경우, 쿨다운 알림 예약 (AttackSpeedMultiplier 반영)
-		GetWorld()->GetTimerManager().SetTimer(RefireTimer, this, &AFPSWeapon::FireCooldownExpired, GetCurrentRefireRate(), false);
+		FinishBurst(true);
 	}
+
+	return true;
 }
 
 void AFPSWeapon::FireCooldownExpired()
@@ -344,26 +516,70 @@ void AFPSWeapon::FireCooldownExpired()
 
 void AFPSWeapon::FireProjectile(const FVector& TargetLocation)
 {
-	if (!ProjectileClass || !GetWorld())
+	if (!GetWorld())
+	{
+		return;
+	}
+
+	// 산탄 무기는 발사 방식과 관계없이 펠릿 묶음 하나로 판정 (펠릿마다 액터/시뮬레이션 항목을 만들지 않음)
+	if (WeaponItemData && WeaponItemData->IsPelletWeapon())
+	{
+		FirePelletBundle(TargetLocation);
+		return;
+	}
+
+	// 히트스캔 무기는 발사체 대신 라인 트레이스로 판정
+	if (WeaponItemData && WeaponItemData->IsHitscan())
+	{
+		FireHitscan(TargetLocation);
+		return;
+	}
+
+	if (!ProjectileClass)
+	{
+		return;
+	}
+
+	// 시뮬레이션 발사체는 중앙 서브시스템에서 처리 (처리 불가 시 발사체 액터로 대체)
+	bool bSimulatedLaunched = false;
+	if (WeaponItemData && WeaponItemData->FireMode == EWeaponFireMode::Simulated && FireSimulatedProjectile(TargetLocation, bSimulatedLaunched))
 	{
+		if (bSimulatedLaunched)
+		{
+			FPS_INC_COMBAT_COUNTER(ProjectilesLaunched);
+		}
 		return;
 	}
 
 	// 발사체 트랜스폼 가져오기
 	FTransform ProjectileTransform = CalculateProjectileSpawnTransform(TargetLocation);
 
-	// 발사체 스폰
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	SpawnParams.TransformScaleMethod = ESpawnActorScaleMethod::OverrideRootScale;
-	SpawnParams.Owner = GetOwner();
-	SpawnParams.Instigator = PawnOwner;
+	AActor* Projectile = nullptr;
 
-	AActor* Projectile = GetWorld()->SpawnActor<AActor>(ProjectileClass, ProjectileTransform, SpawnParams);
+	// AFPSProjectile 계열은 풀에서 가져옴 (풀이 거부하면 이번 발사는 생략)
+	UFPSProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UFPSProjectilePoolSubsystem>();
+	if (ProjectilePool && ProjectileClass->IsChildOf(AFPSProjectile::StaticClass()))
+	{
+		Projectile = ProjectilePool->AcquireProjectile(TSubclassOf<AFPSProjectile>(ProjectileClass.Get()), ProjectileTransform, GetOwner(), PawnOwner);
+	}
+	else
+	{
+		// 발사체 스폰
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.TransformScaleMethod = ESpawnActorScaleMethod::OverrideRootScale;
+		SpawnParams.Owner = GetOwner();
+		SpawnParams.Instigator = PawnOwner;
+
+		FPS_INC_COMBAT_COUNTER(ProjectileActorSpawns);
+		Projectile = GetWorld()->SpawnActor<AActor>(ProjectileClass, ProjectileTransform, SpawnParams);
+	}
 
 	// 발사체에 데미지 설정 (크리티컬 계산 포함)
 	if (Projectile)
 	{
+		FPS_INC_COMBAT_COUNTER(ProjectilesLaunched);
+
 		// AFPSProjectile로 캐스팅하여 데미지 설정
 		if (AFPSProjectile* FPSProjectile = Cast<AFPSProjectile>(Projectile))
 		{
@@ -380,10 +596,166 @@ void AFPSWeapon::FireProjectile(const FVector& TargetLocation)
 	// }
 }
 
+void AFPSWeapon::FireHitscan(const FVector& TargetLocation)
+{
+	UFPSHitscanSubsystem* Hitscan = GetWorld()->GetSubsystem<UFPSHitscanSubsystem>();
+	if (!Hitscan || !WeaponItemData)
+	{
+		return;
+	}
+
+	// 총구 위치/방향 (조준 분산 포함)
+	const FTransform MuzzleTransform = CalculateProjectileSpawnTransform(TargetLocation);
+
+	FHitscanShotRequest Shot;
+	Shot.Start = MuzzleTransform.GetLocation();
+	Shot.End = Shot.Start + MuzzleTransform.GetRotation().Vector() * WeaponItemData->WeaponRange;
+	Shot.Damage = CalculateFinalDamage(Shot.bCritical);
+	Shot.DamageEffectClass = GetDamageEffectClass();
+	Shot.Instigator = PawnOwner;
+	Shot.DamageCauser = this;
+
+	// 연출 데이터 (트레이서는 무기 데이터, 명중 이펙트는 발사체 기본값 재사용)
+	Shot.TracerEffect = bCosmeticsEnabled ? WeaponItemData->HitscanTracerEffect : nullptr;
+	Shot.TracerEndParameterName = WeaponItemData->TracerEndParameterName;
+	if (ProjectileClass)
+	{
+		if (const AFPSProjectile* DefaultProjectile = Cast<AFPSProjectile>(ProjectileClass->GetDefaultObject()))
+		{
+			Shot.ImpactParticle = DefaultProjectile->HitParticle;
+			Shot.ImpactSound = DefaultProjectile->HitSound;
+		}
+	}
+
+	// 판정은 프레임 끝의 일괄 트레이스 패스에서 처리
+	Hitscan->QueueShot(Shot);
+
+	SpawnHitscanMuzzleEffect();
+}
+
+void AFPSWeapon::FirePelletBundle(const FVector& TargetLocation)
+{
+	UFPSHitscanSubsystem* Hitscan = GetWorld()->GetSubsystem<UFPSHitscanSubsystem>();
+	if (!Hitscan || !WeaponItemData)
+	{
+		return;
+	}
+
+	// 묶음 중심 방향 (조준 분산 포함)
+	const FTransform MuzzleTransform = CalculateProjectileSpawnTransform(TargetLocation);
+	const FVector CenterDirection = MuzzleTransform.GetRotation().Vector();
+	const float PelletSpreadRad = FMath::DegreesToRadians(WeaponItemData->PelletSpread);
+
+	FHitscanShotRequest Bundle;
+	Bundle.Start = MuzzleTransform.GetLocation();
+	Bundle.End = Bundle.Start + CenterDirection * WeaponItemData->WeaponRange;
+
+	// 펠릿 방향 (원뿔 안에서 균등 분포)
+	Bundle.PelletEnds.Reserve(WeaponItemData->PelletCount);
+	for (int32 PelletIndex = 0; PelletIndex < WeaponItemData->PelletCount; ++PelletIndex)
+	{
+		const FVector PelletDirection = SpreadStream
+			? SpreadStream->VRandCone(CenterDirection, PelletSpreadRad)
+			: FMath::VRandCone(CenterDirection, PelletSpreadRad);
+		Bundle.PelletEnds.Add(Bundle.Start + PelletDirection * WeaponItemData->WeaponRange);
+	}
+
+	// 크리티컬은 발사당 한 번 판정 (데미지는 펠릿당)
+	Bundle.Damage = CalculateFinalDamage(Bundle.bCritical);
+	Bundle.DamageEffectClass = GetDamageEffectClass();
+	Bundle.Instigator = PawnOwner;
+	Bundle.DamageCauser = this;
+
+	// 연출 데이터 (FireHitscan과 동일)
+	Bundle.TracerEffect = bCosmeticsEnabled ? WeaponItemData->HitscanTracerEffect : nullptr;
+	Bundle.TracerEndParameterName = WeaponItemData->TracerEndParameterName;
+	if (ProjectileClass)
+	{
+		if (const AFPSProjectile* DefaultProjectile = Cast<AFPSProjectile>(ProjectileClass->GetDefaultObject()))
+		{
+			Bundle.ImpactParticle = DefaultProjectile->HitParticle;
+			Bundle.ImpactSound = DefaultProjectile->HitSound;
+		}
+	}
+
+	// 펠릿 트레이스 + 대상별 데미지 합산은 프레임 끝의 일괄 패스에서 처리
+	Hitscan->QueueShot(Bundle);
+
+	SpawnHitscanMuzzleEffect();
+}
+
+void AFPSWeapon::SpawnHitscanMuzzleEffect() const
+{
+	// 총구 이펙트 (연출 전용)
+	if (bCosmeticsEnabled && WeaponItemData->HitscanMuzzleEffect && GetNetMode() != NM_DedicatedServer)
+	{
+		USkeletalMeshComponent* MuzzleMesh = (FirstPersonMesh && FirstPersonMesh->IsVisible()) ? FirstPersonMesh.Get() : ThirdPersonMesh.Get();
+		if (MuzzleMesh)
+		{
+			UFPSEffectPoolSubsystem::SpawnNiagaraAttached(WeaponItemData->HitscanMuzzleEffect, MuzzleMesh, MuzzleSocketName,
+				EFPSEffectPriority::High);
+		}
+	}
+}
+
+bool AFPSWeapon::FireSimulatedProjectile(const FVector& TargetLocation, bool& bOutLaunched)
+{
+	bOutLaunched = false;
+
+	UFPSProjectileSimSubsystem* ProjectileSim = GetWorld()->GetSubsystem<UFPSProjectileSimSubsystem>();
+	const AFPSProjectile* DefaultProjectile = Cast<AFPSProjectile>(ProjectileClass->GetDefaultObject());
+	if (!ProjectileSim || !DefaultProjectile)
+	{
+		return false;
+	}
+
+	// 발사체 트랜스폼 가져오기
+	const FTransform ProjectileTransform = CalculateProjectileSpawnTransform(TargetLocation);
+
+	// 이동/충돌 값은 발사체 클래스 기본값에서 가져옴
+	const UProjectileMovementComponent* DefaultMovement = DefaultProjectile->ProjectileMovement;
+	const float LaunchSpeed = DefaultMovement
+		? (DefaultMovement->InitialSpeed > 0.0f ? DefaultMovement->InitialSpeed : DefaultMovement->MaxSpeed)
+		: 3000.0f;
+
+	FProjectileSimLaunchParams Params;
+	Params.Location = ProjectileTransform.GetLocation();
+	Params.Velocity = ProjectileTransform.GetRotation().Vector() * LaunchSpeed;
+	Params.LifeSeconds = DefaultProjectile->LifeSeconds;
+	Params.Radius = DefaultProjectile->CollisionComponent ? DefaultProjectile->CollisionComponent->GetUnscaledSphereRadius() : 15.0f;
+	Params.GravityZ = DefaultMovement ? GetWorld()->GetGravityZ() * DefaultMovement->ProjectileGravityScale : 0.0f;
+	Params.Damage = CalculateFinalDamage(Params.bCritical);
+	Params.DamageEffectClass = GetDamageEffectClass();
+	Params.Instigator = PawnOwner;
+	Params.DamageCauser = this;
+	Params.ProjectileClass = TSubclassOf<AFPSProjectile>(ProjectileClass.Get());
+
+	// 수용 한도를 넘으면 이번 발사는 생략 (발사체 액터로 대체하지 않음)
+	bOutLaunched = ProjectileSim->LaunchProjectile(Params);
+	return true;
+}
+
+TSubclassOf<UGameplayEffect> AFPSWeapon::GetDamageEffectClass() const
+{
+	if (ProjectileClass)
+	{
+		if (const AFPSProjectile* DefaultProjectile = Cast<AFPSProjectile>(ProjectileClass->GetDefaultObject()))
+		{
+			if (DefaultProjectile->DamageEffectClass)
+			{
+				return DefaultProjectile->DamageEffectClass;
+			}
+		}
+	}
+
+	return UGameplayEffect_Damage::StaticClass();
+}
+
 FTransform AFPSWeapon::CalculateProjectileSpawnTransform(const FVector& TargetLocation) const
 {
 	FVector SpawnLocation;
 	FRotator SpawnRotation;
+	bool bAimAtTarget = true;
 
 	// 머즐 소켓 위치 가져오기 시도
 	// 1인칭 메시가 보이는 상태면 1인칭 메시 사용 (플레이어용)
@@ -410,17 +782,42 @@ FTransform AFPSWeapon::CalculateProjectileSpawnTransform(const FVector& TargetLo
 		// 액터 위치와 회전으로 대체
 		SpawnLocation = GetActorLocation();
 		SpawnRotation = GetActorRotation();
+		bAimAtTarget = false;
 
 		// 머즐 오프셋 추가
 		SpawnLocation += SpawnRotation.Vector() * MuzzleOffset;
 	}
 
+	// 연사 시계 발사: 프레임 내 발사 시점의 총구 위치로 보정
+	if (ActiveClockShot)
+	{
+		SpawnLocation = ActiveClockShot->MuzzleLocation;
+
+		if (bAimAtTarget)
+		{
+			SpawnRotation = (TargetLocation - SpawnLocation).GetSafeNormal().Rotation();
+		}
+	}
+
 	// 지정된 경우 조준 분산 적용
 	if (WeaponItemData && WeaponItemData->AccuracySpread > 0.0f)
 	{
+		// Pitch / Yaw 난수를 한 번에 생성
+		float SpreadValues[2];
+		if (SpreadStream)
+		{
+			SpreadStream->FillFRand(SpreadValues);
+		}
+		else
+		{
+			SpreadValues[0] = FMath::FRand();
+			SpreadValues[1] = FMath::FRand();
+		}
+
+		const float Spread = WeaponItemData->AccuracySpread;
 		FRotator VarianceRotation = FRotator(
-			FMath::RandRange(-WeaponItemData->AccuracySpread, WeaponItemData->AccuracySpread),  // Pitch
-			FMath::RandRange(-WeaponItemData->AccuracySpread, WeaponItemData->AccuracySpread),  // Yaw
+			FMath::Lerp(-Spread, Spread, SpreadValues[0]),  // Pitch
+			FMath::Lerp(-Spread, Spread, SpreadValues[1]),  // Yaw
 			0.0f                                          // Roll
 		);
 		SpawnRotation += VarianceRotation;
@@ -429,6 +826,22 @@ FTransform AFPSWeapon::CalculateProjectileSpawnTransform(const FVector& TargetLo
 	return FTransform(SpawnRotation, SpawnLocation);
 }
 
+FVector AFPSWeapon::GetMuzzleLocation() const
+{
+	// CalculateProjectileSpawnTransform과 같은 우선순위 (1인칭 -> 3인칭 -> 액터)
+	if (FirstPersonMesh && FirstPersonMesh->IsVisible() && FirstPersonMesh->DoesSocketExist(MuzzleSocketName))
+	{
+		return FirstPersonMesh->GetSocketLocation(MuzzleSocketName);
+	}
+
+	if (ThirdPersonMesh && ThirdPersonMesh->DoesSocketExist(MuzzleSocketName))
+	{
+		return ThirdPersonMesh->GetSocketLocation(MuzzleSocketName);
+	}
+
+	return GetActorLocation() + GetActorRotation().Vector() * MuzzleOffset;
+}
+
 TSubclassOf<UAnimInstance> AFPSWeapon::GetFirstPersonAnimInstanceClass() const
 {
 	return FirstPersonAnimInstanceClass;
@@ -453,7 +866,7 @@ void AFPSWeapon::SetCurrentAmmo(int32 NewAmmo)
 {
 	if (!WeaponItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SetCurrentAmmo: WeaponItemData가 null입니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("SetCurrentAmmo: WeaponItemData가 null입니다"));
 		return;
 	}
 
@@ -470,7 +883,7 @@ bool AFPSWeapon::ConsumeAmmo(int32 AmmoToConsume)
 {
 	if (!WeaponItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ConsumeAmmo: WeaponItemData가 null입니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("ConsumeAmmo: WeaponItemData가 null입니다"));
 		return false;
 	}
 
@@ -482,7 +895,7 @@ void AFPSWeapon::SetWeaponItemData(UWeaponItemData* ItemData)
 {
 	if (!ItemData)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SetWeaponItemData: ItemData가 null입니다!"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("SetWeaponItemData: ItemData가 null입니다!"));
 		return;
 	}
 
@@ -496,14 +909,14 @@ void AFPSWeapon::SetWeaponItemData(UWeaponItemData* ItemData)
 	if (FirstPersonMesh && ItemData->GetFirstPersonMesh())
 	{
 		FirstPersonMesh->SetSkeletalMesh(ItemData->GetFirstPersonMesh());
-		UE_LOG(LogTemp, Log, TEXT("1인칭 무기 메시 설정: %s"), *ItemData->GetFirstPersonMesh()->GetName());
+		UE_LOG(LogFPSCombat, Log, TEXT("1인칭 무기 메시 설정: %s"), *ItemData->GetFirstPersonMesh()->GetName());
 	}
 
 	// 3인칭 메시 설정 (BaseItemData::WorldSkeletalMesh)
 	if (ThirdPersonMesh && ItemData->GetThirdPersonMesh())
 	{
 		ThirdPersonMesh->SetSkeletalMesh(ItemData->GetThirdPersonMesh());
-		UE_LOG(LogTemp, Log, TEXT("3인칭 무기 메시 설정: %s"), *ItemData->GetThirdPersonMesh()->GetName());
+		UE_LOG(LogFPSCombat, Log, TEXT("3인칭 무기 메시 설정: %s"), *ItemData->GetThirdPersonMesh()->GetName());
 	}
 
 	// HUD 업데이트
@@ -512,7 +925,7 @@ void AFPSWeapon::SetWeaponItemData(UWeaponItemData* ItemData)
 		WeaponOwner->UpdateWeaponHUD(WeaponItemData->CurrentAmmo, WeaponItemData->MagazineSize);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("WeaponItemData 설정됨: %s"), *ItemData->GetItemName());
+	UE_LOG(LogFPSCombat, Log, TEXT("WeaponItemData 설정됨: %s"), *ItemData->GetItemName());
 }
 
 // ========================================
@@ -530,7 +943,7 @@ bool AFPSWeapon::CanBePickedUp(AFPSCharacter* Character)
 	UWeaponSlotComponent* WeaponSlotComp = Character->GetWeaponSlotComponent();
 	if (!WeaponSlotComp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CanBePickedUp: WeaponSlotComponent를 찾을 수 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("CanBePickedUp: WeaponSlotComponent를 찾을 수 없습니다"));
 		return false;
 	}
 
@@ -543,7 +956,7 @@ bool AFPSWeapon::OnPickedUp(AFPSCharacter* Character)
 {
 	if (!Character)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnPickedUp: 장착할 수 없는 상태입니다!"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("OnPickedUp: 장착할 수 없는 상태입니다!"));
 		return false;
 	}
 
@@ -551,7 +964,7 @@ bool AFPSWeapon::OnPickedUp(AFPSCharacter* Character)
 	UWeaponSlotComponent* WeaponSlotComp = Character->GetWeaponSlotComponent();
 	if (!WeaponSlotComp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnPickedUp: WeaponSlotComponent를 찾을 수 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("OnPickedUp: WeaponSlotComponent를 찾을 수 없습니다"));
 		return false;
 	}
 
@@ -576,14 +989,14 @@ bool AFPSWeapon::OnPickedUp(AFPSCharacter* Character)
 		bool bSuccess = WeaponSlotComp->EquipExistingWeaponToSlot(TargetSlot, this);
 		if (bSuccess)
 		{
-			UE_LOG(LogTemp, Log, TEXT("무기 픽업 성공: %s를 %s 슬롯에 장착"),
+			UE_LOG(LogFPSCombat, Log, TEXT("무기 픽업 성공: %s를 %s 슬롯에 장착"),
 				*GetPickupDisplayName(),
 				TargetSlot == EWeaponSlot::Primary ? TEXT("Primary") : TEXT("Secondary"));
 			return true;
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("무기 픽업 실패: %s"), *GetPickupDisplayName());
+			UE_LOG(LogFPSCombat, Warning, TEXT("무기 픽업 실패: %s"), *GetPickupDisplayName());
 			return false;
 		}
 	}
@@ -592,14 +1005,14 @@ bool AFPSWeapon::OnPickedUp(AFPSCharacter* Character)
 	AFPSPlayerCharacter* PlayerCharacter = Cast<AFPSPlayerCharacter>(Character);
 	if (!PlayerCharacter)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnPickedUp: 플레이어가 아니므로 인벤토리에 넣을 수 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("OnPickedUp: 플레이어가 아니므로 인벤토리에 넣을 수 없습니다"));
 		return false;
 	}
 
 	UInventoryComponent* InventoryComp = PlayerCharacter->GetInventoryComponent();
 	if (!InventoryComp)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnPickedUp: InventoryComponent를 찾을 수 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("OnPickedUp: InventoryComponent를 찾을 수 없습니다"));
 		return false;
 	}
 
@@ -608,7 +1021,7 @@ bool AFPSWeapon::OnPickedUp(AFPSCharacter* Character)
 	bool bPlacedInInventory = InventoryComp->AutoPlaceItem(WeaponItemData, OutX, OutY);
 	if (bPlacedInInventory)
 	{
-		UE_LOG(LogTemp, Log, TEXT("무기 픽업 성공: %s를 인벤토리 (%d, %d)에 배치"), *GetPickupDisplayName(), OutX, OutY);
+		UE_LOG(LogFPSCombat, Log, TEXT("무기 픽업 성공: %s를 인벤토리 (%d, %d)에 배치"), *GetPickupDisplayName(), OutX, OutY);
 
 		// 픽업 완료 처리 (Actor 파괴)
 		SetDropped(false);
@@ -617,7 +1030,7 @@ bool AFPSWeapon::OnPickedUp(AFPSCharacter* Character)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("무기 픽업 실패: 인벤토리에 공간이 없습니다"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("무기 픽업 실패: 인벤토리에 공간이 없습니다"));
 		return false;
 	}
 }
@@ -636,18 +1049,34 @@ void AFPSWeapon::SetDropped(bool bNewDropped)
 {
 	bIsDropped = bNewDropped;
 
+	// 드롭된 무기만 픽업 쿼리 대상 (BeginPlay 전이면 BeginPlay에서 등록)
+	if (HasActorBegunPlay())
+	{
+		if (UFPSSpatialHashSubsystem* SpatialHash = UFPSSpatialHashSubsystem::Get(this))
+		{
+			if (bIsDropped)
+			{
+				SpatialHash->Register(this, EFPSSpatialCategory::Pickupable);
+			}
+			else
+			{
+				SpatialHash->Unregister(this);
+			}
+		}
+	}
+
 	// 픽업 트리거 활성화/비활성화
 	if (PickupTrigger)
 	{
 		if (bIsDropped)
 		{
 			PickupTrigger->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-			UE_LOG(LogTemp, Log, TEXT("무기 %s: 드롭 상태로 변경, 픽업 트리거 활성화"), *GetName());
+			UE_LOG(LogFPSCombat, Log, TEXT("무기 %s: 드롭 상태로 변경, 픽업 트리거 활성화"), *GetName());
 		}
 		else
 		{
 			PickupTrigger->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-			UE_LOG(LogTemp, Log, TEXT("무기 %s: 장착 상태로 변경, 픽업 트리거 비활성화"), *GetName());
+			UE_LOG(LogFPSCombat, Log, TEXT("무기 %s: 장착 상태로 변경, 픽업 트리거 비활성화"), *GetName());
 		}
 	}
 
@@ -669,14 +1098,14 @@ void AFPSWeapon::SetWeaponOwner(AActor* WeaponHolder)
 {
 	if (!WeaponHolder)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SetWeaponOwner의 Owner가 null입니다!"));
+		UE_LOG(LogFPSCombat, Warning, TEXT("SetWeaponOwner의 Owner가 null입니다!"));
 		return;
 	}
 
 	IFPSWeaponHolder* Holder = Cast<IFPSWeaponHolder>(WeaponHolder);
 	if (!Holder)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Owner는 IFPSWeaponHolder로 구현되지 않았습니다."));
+		UE_LOG(LogFPSCombat, Warning, TEXT("Owner는 IFPSWeaponHolder로 구현되지 않았습니다."));
 		return;
 	}
 
@@ -698,41 +1127,18 @@ float AFPSWeapon::CalculateFinalDamage(bool& bOutIsCritical) const
 
 	float BaseDamage = static_cast<float>(WeaponItemData->BaseDamage);
 
-	// AbilitySystemComponent 가져오기
-	IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(PawnOwner);
-	if (!ASI)
-	{
-		// GAS가 없으면 기본 데미지 반환
-		return BaseDamage;
-	}
-
-	UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent();
-	if (!ASC)
-	{
-		return BaseDamage;
-	}
-
-	// PlayerAttributeSet 가져오기 (플레이어만 CritChance/CritDamage 보유)
-	const UPlayerAttributeSet* PlayerAttrSet = ASC->GetSet<UPlayerAttributeSet>();
-	if (!PlayerAttrSet)
-	{
-		// 적 AI 등 PlayerAttributeSet 없으면 기본 데미지
-		return BaseDamage;
-	}
-
-	// 크리티컬 확률 가져오기
-	float CritChance = PlayerAttrSet->GetCritChance();
-	float CritDamage = PlayerAttrSet->GetCritDamage();
-
-	// 크리티컬 판정 (난수)
-	float RandomValue = FMath::FRand(); // 0.0 ~ 1.0
-	if (RandomValue < CritChance)
+	// 크리티컬 판정 (난수, 스탯은 캐시된 스냅샷 사용)
+	// PlayerAttributeSet이 없는 소유자는 CritChance = 0이므로 항상 일반 공격
+	float RandomValue = CritStream ? CritStream->FRand() : FMath::FRand(); // 0.0 ~ 1.0
+	if (RandomValue < CombatStats.CritChance)
 	{
 		// 크리티컬 성공!
 		bOutIsCritical = true;
-		float FinalDamage = BaseDamage * CritDamage;
-		UE_LOG(LogTemp, Warning, TEXT("크리티컬 히트! 기본: %.0f → 최종: %.0f (%.0f%%)"),
-			BaseDamage, FinalDamage, CritDamage * 100.0f);
+		float FinalDamage = BaseDamage * CombatStats.CritDamage;
+		INC_DWORD_STAT(STAT_FPSCriticalHits);
+		FPS_INC_COMBAT_COUNTER(CriticalHits);
+		UE_LOG(LogFPSCombat, Verbose, TEXT("크리티컬 히트! 기본: %.0f → 최종: %.0f (%.0f%%)"),
+			BaseDamage, FinalDamage, CombatStats.CritDamage * 100.0f);
 		return FinalDamage;
 	}
 
@@ -747,42 +1153,66 @@ float AFPSWeapon::GetCurrentRefireRate() const
 		return 1.0f;
 	}
 
-	// 기본 연사 간격 (FireRate의 역수)
-	float BaseRefireRate = WeaponItemData->GetRefireRate();
+	// 연사 간격을 AttackSpeedMultiplier로 나눔 (곱하기가 아님!)
+	// 예: BaseRefireRate = 1.0초, AttackSpeedMultiplier = 1.5 → 0.667초 (50% 빠름)
+	return WeaponItemData->GetRefireRate() / CombatStats.AttackSpeedMultiplier;
+}
 
-	// AttackSpeedMultiplier가 없으면 기본값 반환
-	if (!PawnOwner)
-	{
-		return BaseRefireRate;
-	}
+void AFPSWeapon::BindCombatStats()
+{
+	UnbindCombatStats();
 
-	// AbilitySystemComponent 가져오기
 	IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(PawnOwner);
-	if (!ASI)
+	UAbilitySystemComponent* ASC = ASI ? ASI->GetAbilitySystemComponent() : nullptr;
+
+	// PlayerAttributeSet이 없으면 (적 AI 등) 기본값 유지, 델리게이트 등록 불필요
+	if (!ASC || !ASC->GetSet<UPlayerAttributeSet>())
 	{
-		return BaseRefireRate;
+		return;
 	}
 
-	UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent();
-	if (!ASC)
+	CombatStatsASC = ASC;
+	CritChanceChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(UPlayerAttributeSet::GetCritChanceAttribute()).AddUObject(this, &AFPSWeapon::OnCombatStatChanged);
+	CritDamageChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(UPlayerAttributeSet::GetCritDamageAttribute()).AddUObject(this, &AFPSWeapon::OnCombatStatChanged);
+	AttackSpeedChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(UPlayerAttributeSet::GetAttackSpeedMultiplierAttribute()).AddUObject(this, &AFPSWeapon::OnCombatStatChanged);
+
+	RefreshCombatStats();
+}
+
+void AFPSWeapon::UnbindCombatStats()
+{
+	if (UAbilitySystemComponent* ASC = CombatStatsASC.Get())
 	{
-		return BaseRefireRate;
+		ASC->GetGameplayAttributeValueChangeDelegate(UPlayerAttributeSet::GetCritChanceAttribute()).Remove(CritChanceChangedHandle);
+		ASC->GetGameplayAttributeValueChangeDelegate(UPlayerAttributeSet::GetCritDamageAttribute()).Remove(CritDamageChangedHandle);
+		ASC->GetGameplayAttributeValueChangeDelegate(UPlayerAttributeSet::GetAttackSpeedMultiplierAttribute()).Remove(AttackSpeedChangedHandle);
 	}
 
-	// PlayerAttributeSet 가져오기 (플레이어만 AttackSpeedMultiplier 보유)
-	const UPlayerAttributeSet* PlayerAttrSet = ASC->GetSet<UPlayerAttributeSet>();
+	CombatStatsASC.Reset();
+	CritChanceChangedHandle.Reset();
+	CritDamageChangedHandle.Reset();
+	AttackSpeedChangedHandle.Reset();
+
+	CombatStats = FWeaponCombatStats();
+}
+
+void AFPSWeapon::RefreshCombatStats()
+{
+	const UAbilitySystemComponent* ASC = CombatStatsASC.Get();
+	const UPlayerAttributeSet* PlayerAttrSet = ASC ? ASC->GetSet<UPlayerAttributeSet>() : nullptr;
 	if (!PlayerAttrSet)
 	{
-		// 적 AI 등 PlayerAttributeSet 없으면 기본값
-		return BaseRefireRate;
+		CombatStats = FWeaponCombatStats();
+		return;
 	}
 
-	// AttackSpeedMultiplier 가져오기 (1.0 = 기본, 1.5 = 50% 빠름)
-	float AttackSpeedMultiplier = PlayerAttrSet->GetAttackSpeedMultiplier();
-
-	// 연사 간격을 AttackSpeedMultiplier로 나눔 (곱하기가 아님!)
-	// 예: BaseRefireRate = 1.0초, AttackSpeedMultiplier = 1.5 → 0.667초 (50% 빠름)
-	float FinalRefireRate = BaseRefireRate / AttackSpeedMultiplier;
+	CombatStats.CritChance = PlayerAttrSet->GetCritChance();
+	CombatStats.CritDamage = PlayerAttrSet->GetCritDamage();
+	CombatStats.AttackSpeedMultiplier = PlayerAttrSet->GetAttackSpeedMultiplier();
+}
 
-	return FinalRefireRate;
+void AFPSWeapon::OnCombatStatChanged(const FOnAttributeChangeData& Data)
+{
+	// 세 값 중 하나만 바뀌어도 전체 갱신 (값 3개, 변경은 스킬 습득/버프 시에만 발생)
+	RefreshCombatStats();
 }
@@ -18,6 +18,29 @@ class UAnimInstance;
 class UGameplayAbility;
 class UPickupTriggerComponent;
 class UNiagaraComponent;
+class UGameplayEffect;
+class UAbilitySystemComponent;
+class UFPSFireClockSubsystem;
+struct FOnAttributeChangeData;
+struct FFireClockShot;
+class FFPSRandomStream;
+
+/**
+ * 무기 발사 계산용 전투 스탯 스냅샷
+ * - 발사 경로에서는 이 값만 읽음 (ASC/AttributeSet 조회 없음)
+ * - PlayerAttributeSet이 없는 소유자(적 AI)는 기본값 유지
+ */
+struct FWeaponCombatStats
+{
+	/** 크리티컬 확률 (0.0 ~ 1.0) */
+	float CritChance = 0.0f;
+
+	/** 크리티컬 데미지 배율 */
+	float CritDamage = 1.0f;
+
+	/** 공격 속도 배율 (1.0 = 기본) */
+	float AttackSpeedMultiplier = 1.0f;
+};
 
 /**
  * GAS 통합 FPS 무기를 위한 기본 클래스
@@ -30,6 +53,9 @@ class PROJECTFPS_API AFPSWeapon : public AActor, public IPickupable
 {
 	GENERATED_BODY()
 
+	/** 연사 시계가 발사/쿨다운 만료를 직접 호출 */
+	friend class UFPSFireClockSubsystem;
+
 	/** 1인칭 시점 메시 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USkeletalMeshComponent> FirstPersonMesh;
@@ -101,8 +127,22 @@ protected:
 	/** true인 경우, 무기가 현재 발사 중 */
 	bool bIsFiring = false;
 
-	/** 자동 연사 처리용 타이머 */
-	FTimerHandle RefireTimer;
+	/** 발사 연출 (총구 이펙트/트레이서/발사 몽타주) 사용 여부, 멀리 있는 AI는 끔 */
+	bool bCosmeticsEnabled = true;
+
+	/** 버스트 발사 상태 (StartBurst) */
+	bool bInBurst = false;
+	int32 BurstShotLimit = 0;
+	int32 BurstShotsFired = 0;
+	float BurstCadence = 0.0f;
+	double BurstEndTime = 0.0;
+
+	/** 연사 시계가 발생시킨 발사 처리 중이면 해당 발사 정보 (총구 위치 보간용) */
+	const FFireClockShot* ActiveClockShot = nullptr;
+
+	/** 크리티컬 판정 / 조준 분산 난수 스트림 (BeginPlay에서 발급, EndPlay에서 해제) */
+	FFPSRandomStream* CritStream = nullptr;
+	FFPSRandomStream* SpreadStream = nullptr;
 
 	/** AI 인식 시스템 상호작용을 위한 소유자 폰 포인터 캐스트 */
 	TObjectPtr<APawn> PawnOwner;
@@ -160,6 +200,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Weapon")
 	void StopFiring();
 
+	/** 발사 중인지 여부 */
+	UFUNCTION(BlueprintPure, Category="Weapon")
+	bool IsFiring() const { return bIsFiring; }
+
+	/**
+	 * 버스트 발사 시작 (무기가 연사 시계로 직접 진행하고 끝나면 OnBurstFinished 호출)
+	 * - 반자동 무기도 버스트 동안은 연사
+	 * - 시간 제한은 다음 발사 시점에 판정 (종료 알림이 최대 발사 간격 1회만큼 늦을 수 있음)
+	 * - 진행 중인 버스트는 중단(bCompleted = false)하고 새로 시작, 일반 발사 중이면 실패
+	 * @param ShotCount 발사 수 (0 이하면 제한 없음)
+	 * @param Duration 지속 시간 (초, 0 이하면 제한 없음), ShotCount와 둘 중 하나는 지정
+	 * @param Cadence 발사 간격 (초, 0 이하면 무기 연사 간격)
+	 * @return 시작 여부 (탄약 없음/리로드 중 등으로 발사할 수 없으면 알림 없이 false)
+	 */
+	UFUNCTION(BlueprintCallable, Category="Weapon")
+	bool StartBurst(int32 ShotCount, float Duration = 0.0f, float Cadence = 0.0f);
+
+	/** 버스트 발사 중인지 여부 */
+	UFUNCTION(BlueprintPure, Category="Weapon")
+	bool IsInBurst() const { return bInBurst; }
+
+	/** 버스트 종료 시 호출 (bCompleted: 발사 수/시간을 채움, false면 탄약 소진/StopFiring 등으로 중단) */
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnBurstFinished, AFPSWeapon*, Weapon, int32, ShotsFired, bool, bCompleted);
+	UPROPERTY(BlueprintAssignable, Category="Weapon")
+	FOnBurstFinished OnBurstFinished;
+
+	/** AttackSpeedMultiplier를 반영한 실제 연사 간격 반환 */
+	float GetCurrentRefireRate() const;
+
+	/** 발사 연출 사용 여부 설정 (판정/데미지/명중 연출에는 영향 없음) */
+	void SetCosmeticsEnabled(bool bEnabled) { bCosmeticsEnabled = bEnabled; }
+	bool AreCosmeticsEnabled() const { return bCosmeticsEnabled; }
+
 	/** 무기 발사 (GameplayAbility에서 호출) */
 	UFUNCTION(BlueprintCallable, Category="Weapon")
 	virtual void Fire();
@@ -168,21 +241,80 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Weapon")
 	virtual void FireProjectile(const FVector& TargetLocation);
 
+	/** 히트스캔 사격 (FireMode == Hitscan일 때 FireProjectile에서 호출) */
+	UFUNCTION(BlueprintCallable, Category="Weapon")
+	virtual void FireHitscan(const FVector& TargetLocation);
+
+	/**
+	 * 시뮬레이션 발사체 발사 (FireMode == Simulated일 때 FireProjectile에서 호출)
+	 * @param bOutLaunched 실제로 발사되었는지 (수용 한도 초과 시 false, 이 경우 발사는 생략)
+	 * @return 처리 여부 (시뮬레이션을 쓸 수 없으면 false, 호출자가 발사체 액터로 대체)
+	 */
+	virtual bool FireSimulatedProjectile(const FVector& TargetLocation, bool& bOutLaunched);
+
+	/** 산탄 발사 (PelletCount > 1일 때 FireProjectile에서 호출, 펠릿 묶음 하나로 판정) */
+	virtual void FirePelletBundle(const FVector& TargetLocation);
+
+	/** 히트스캔/산탄 총구 이펙트 (연출 전용) */
+	void SpawnHitscanMuzzleEffect() const;
+
 	/** 이 무기가 발사하는 발사체의 생성 트랜스폼 계산 */
 	UFUNCTION(BlueprintPure, Category="Weapon")
 	FTransform CalculateProjectileSpawnTransform(const FVector& TargetLocation) const;
 
+	/** 현재 총구 위치 (머즐 소켓, 없으면 액터 위치 + 오프셋) */
+	FVector GetMuzzleLocation() const;
+
 protected:
 
+	/** 발사 1회 처리 (탄약 소모, 발사체, 몽타주/반동/HUD), 탄약이 없으면 발사 중지 후 false */
+	bool FireShot();
+
+	/** 연사 시계가 발생시킨 자동 연사 발사 */
+	void FireClockShot(const FFireClockShot& Shot);
+
 	/** 반자동 무기 발사 시 연사 속도 시간이 경과했을 때 호출됨 */
 	void FireCooldownExpired();
 
+	/** 연사 시계 발사 간격 (버스트 간격이 지정되어 있으면 그 값, 아니면 GetCurrentRefireRate) */
+	float GetFireClockInterval() const;
+
+	/** 버스트 종료 (발사 중지 후 OnBurstFinished 호출) */
+	void FinishBurst(bool bCompleted);
+
+	/** 지속 시간이 지난 버스트 종료 (연사 시계가 진행할 때마다 호출, 다음 발사 시각까지 기다리지 않음), 종료했으면 true */
+	bool FinishExpiredBurst(double CurrentTime);
+
 	/** 크리티컬 데미지 계산 (CritChance/CritDamage 기반) */
 	/** 최종 데미지 계산 (크리티컬 포함) */
 	float CalculateFinalDamage(bool& bOutIsCritical) const;
 
-	/** AttackSpeedMultiplier를 반영한 실제 연사 간격 반환 */
-	float GetCurrentRefireRate() const;
+	// ========================================
+	// 전투 스탯 캐시
+	// ========================================
+
+	/** 소유자 ASC의 스탯 변경 델리게이트 등록 + 스냅샷 갱신 (ActivateWeapon에서 호출) */
+	void BindCombatStats();
+
+	/** 델리게이트 해제 + 스냅샷 초기화 (DeactivateWeapon/EndPlay에서 호출) */
+	void UnbindCombatStats();
+
+	/** 스냅샷 전체 갱신 */
+	void RefreshCombatStats();
+
+	/** 전투 스탯 Attribute 변경 시 호출 */
+	void OnCombatStatChanged(const FOnAttributeChangeData& Data);
+
+	/** 전투 스탯 스냅샷 */
+	FWeaponCombatStats CombatStats;
+
+	/** 델리게이트를 등록한 ASC */
+	TWeakObjectPtr<UAbilitySystemComponent> CombatStatsASC;
+
+	/** 등록한 델리게이트 핸들 (CritChance / CritDamage / AttackSpeedMultiplier) */
+	FDelegateHandle CritChanceChangedHandle;
+	FDelegateHandle CritDamageChangedHandle;
+	FDelegateHandle AttackSpeedChangedHandle;
 
 public:
 
@@ -222,6 +354,9 @@ public:
 	UFUNCTION(BlueprintPure, Category="Weapon")
 	TSubclassOf<AActor> GetProjectileClass() const { return ProjectileClass; }
 
+	/** 데미지 GameplayEffect 클래스 반환 (발사체 기본값, 없으면 UGameplayEffect_Damage) */
+	TSubclassOf<UGameplayEffect> GetDamageEffectClass() const;
+
 	/** 리로드 애니메이션 몽타주 반환 */
 	UFUNCTION(BlueprintPure, Category="Weapon")
 	UAnimMontage* GetReloadMontage() const { return ReloadMontage; }
@@ -28,7 +28,7 @@ public class ProjectFPS : ModuleRules
 			"Niagara"
         });
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "Json" });
 
 		PublicIncludePaths.AddRange(new string[] {
 			"ProjectFPS",
@@ -7,6 +7,8 @@
 #include "Perception/AIPerceptionComponent.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "AI/Navigation/PathFollowingAgentInterface.h"
+#include "Camera/CameraComponent.h"
+#include "FPS/AI/FPSVisibilityCacheSubsystem.h"
 
 AShooterAIController::AShooterAIController()
 {
@@ -36,6 +38,173 @@ void AShooterAIController::OnPossess(APawn* InPawn)
 	}
 }
 
+void AShooterAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// release any line of sight queries still in flight
+	for (FLineOfSightWatch& Watch : LineOfSightWatches)
+	{
+		ReleaseLineOfSight(Watch);
+	}
+	LineOfSightWatches.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AShooterAIController::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (int32 Index = LineOfSightWatches.Num() - 1; Index >= 0; --Index)
+	{
+		FLineOfSightWatch& Watch = LineOfSightWatches[Index];
+
+		// stop tracing targets that are gone or nobody has asked about recently
+		if (!Watch.Target.IsValid() || Now - Watch.LastRequestTime > LineOfSightRequestTimeout)
+		{
+			ReleaseLineOfSight(Watch);
+			LineOfSightWatches.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		UpdateLineOfSight(Watch);
+	}
+}
+
+bool AShooterAIController::RequestLineOfSight(AActor* Target, int32 NumberOfVerticalChecks)
+{
+	if (!IsValid(Target))
+	{
+		return false;
+	}
+
+	FLineOfSightWatch* Watch = LineOfSightWatches.FindByPredicate([Target](const FLineOfSightWatch& Entry) { return Entry.Target.Get() == Target; });
+	if (!Watch)
+	{
+		Watch = &LineOfSightWatches.AddDefaulted_GetRef();
+		Watch->Target = Target;
+	}
+
+	Watch->NumberOfVerticalChecks = NumberOfVerticalChecks;
+	Watch->LastRequestTime = GetWorld()->GetTimeSeconds();
+
+	return Watch->bHasLineOfSight;
+}
+
+void AShooterAIController::UpdateLineOfSight(FLineOfSightWatch& Watch)
+{
+	AShooterNPC* NPC = Cast<AShooterNPC>(GetPawn());
+	UFPSAsyncQuerySubsystem* AsyncQuery = GetWorld()->GetSubsystem<UFPSAsyncQuerySubsystem>();
+	AActor* Target = Watch.Target.Get();
+
+	// ensure we have a pawn to trace from
+	if (!NPC || !Target || !AsyncQuery)
+	{
+		ReleaseLineOfSight(Watch);
+		Watch.bHasLineOfSight = false;
+		return;
+	}
+
+	// nearby NPCs share recent results through the visibility cache, keyed on the trace origin
+	UFPSVisibilityCacheSubsystem* VisibilityCache = UFPSVisibilityCacheSubsystem::Get(this);
+	const FVector Start = NPC->GetFirstPersonCameraComponent()->GetComponentLocation();
+
+	// resolve the queries submitted on a previous tick
+	if (Watch.NumPendingQueries > 0)
+	{
+		bool bAllResolved = true;
+		bool bAnyUnobstructed = false;
+
+		for (int32 i = 0; i < Watch.NumPendingQueries; ++i)
+		{
+			const FFPSAsyncQueryHandle& Query = Watch.PendingQueries[i];
+
+			if (const FFPSAsyncQueryResult* Result = AsyncQuery->GetResult(Query))
+			{
+				// we only need one unobstructed trace
+				bAnyUnobstructed |= !Result->HasBlockingHit();
+			}
+			else if (AsyncQuery->GetStatus(Query) != EFPSAsyncQueryStatus::Invalid)
+			{
+				bAllResolved = false;
+			}
+		}
+
+		// an unobstructed trace is enough, otherwise wait until every trace is back
+		if (!bAnyUnobstructed && !bAllResolved)
+		{
+			return;
+		}
+
+		ReleaseLineOfSight(Watch);
+		Watch.bHasLineOfSight = bAnyUnobstructed;
+
+		if (VisibilityCache)
+		{
+			VisibilityCache->StoreVisibility(Start, Target, ECC_Visibility, Watch.bHasLineOfSight);
+		}
+
+		// the result we just resolved is fresh, so skip the traces this tick
+		return;
+	}
+
+	// skip the traces if a recent cached result is still fresh
+	if (VisibilityCache)
+	{
+		bool bCachedLineOfSight = false;
+		if (VisibilityCache->FindVisibility(Start, Target, ECC_Visibility, bCachedLineOfSight))
+		{
+			Watch.bHasLineOfSight = bCachedLineOfSight;
+			return;
+		}
+	}
+
+	// get the target's bounding box
+	FVector CenterOfMass, Extent;
+	Target->GetActorBounds(true, CenterOfMass, Extent, false);
+
+	// divide the vertical extent by the number of line of sight checks we'll do
+	const float ExtentZOffset = Extent.Z * 2.0f / FMath::Max(Watch.NumberOfVerticalChecks, 1);
+
+	// ignore the character and target. We want to ensure there's an unobstructed trace not counting them
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShooterLineOfSight), false);
+	QueryParams.AddIgnoredActor(NPC);
+	QueryParams.AddIgnoredActor(Target);
+
+	const int32 NumChecks = FMath::Clamp(Watch.NumberOfVerticalChecks - 1, 1, MaxPendingLineOfSightQueries);
+
+	// submit a new batch of vertically offset traces. The last known result stays valid until they're back
+	for (int32 i = 0; i < NumChecks; ++i)
+	{
+		// calculate the endpoint for the trace
+		const FVector End = CenterOfMass + FVector(0.0f, 0.0f, Extent.Z - ExtentZOffset * i);
+
+		Watch.PendingQueries[Watch.NumPendingQueries++] = AsyncQuery->SubmitLineTrace(this, Start, End, ECC_Visibility, QueryParams);
+	}
+
+	if (VisibilityCache)
+	{
+		VisibilityCache->RecordTraces(NumChecks);
+	}
+}
+
+void AShooterAIController::ReleaseLineOfSight(FLineOfSightWatch& Watch)
+{
+	UFPSAsyncQuerySubsystem* AsyncQuery = GetWorld() ? GetWorld()->GetSubsystem<UFPSAsyncQuerySubsystem>() : nullptr;
+
+	for (int32 i = 0; i < Watch.NumPendingQueries; ++i)
+	{
+		if (AsyncQuery)
+		{
+			AsyncQuery->ReleaseQuery(Watch.PendingQueries[i]);
+		}
+		Watch.PendingQueries[i].Reset();
+	}
+
+	Watch.NumPendingQueries = 0;
+}
+
 void AShooterAIController::OnPawnDeath()
 {
 	// stop movement
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "FPS/FPSAsyncQuerySubsystem.h"
 #include "ShooterAIController.generated.h"
 
 class UStateTreeAIComponent;
@@ -38,6 +39,38 @@ protected:
 	/** Enemy currently being targeted */
 	TObjectPtr<AActor> TargetEnemy;
 
+	/** Time a line of sight target keeps being traced after it was last requested */
+	UPROPERTY(EditAnywhere, Category="Shooter", meta = (ClampMin = 0, Units = "s"))
+	float LineOfSightRequestTimeout = 1.0f;
+
+	/** Max number of vertical checks that can be in flight at once for a single target */
+	static constexpr int32 MaxPendingLineOfSightQueries = 8;
+
+	/** Async line of sight state for a single requested target */
+	struct FLineOfSightWatch
+	{
+		/** Actor being traced against */
+		TWeakObjectPtr<AActor> Target;
+
+		/** Number of vertical checks requested for this target */
+		int32 NumberOfVerticalChecks = 5;
+
+		/** Async line of sight queries submitted on a previous tick */
+		FFPSAsyncQueryHandle PendingQueries[MaxPendingLineOfSightQueries];
+
+		/** Number of valid entries in PendingQueries */
+		int32 NumPendingQueries = 0;
+
+		/** Last resolved line of sight result */
+		bool bHasLineOfSight = false;
+
+		/** Last time this target was requested */
+		double LastRequestTime = 0.0;
+	};
+
+	/** Targets currently being traced for line of sight */
+	TArray<FLineOfSightWatch, TInlineAllocator<2>> LineOfSightWatches;
+
 public:
 
 	/** Called when an AI perception has been updated. StateTree task delegate hook */
@@ -56,6 +89,14 @@ protected:
 	/** Pawn initialization */
 	virtual void OnPossess(APawn* InPawn) override;
 
+	/** Gameplay cleanup */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	/** Updates the line of sight checks against the requested targets */
+	virtual void Tick(float DeltaTime) override;
+
 protected:
 
 	/** Called when the possessed pawn dies */
@@ -73,6 +114,20 @@ public:
 	/** Returns the targeted enemy */
 	AActor* GetCurrentTarget() const { return TargetEnemy; };
 
+	/**
+	 *  Returns the last resolved line of sight result against the passed actor and keeps tracing it for LineOfSightRequestTimeout
+	 *  The traces run asynchronously from Tick, so a newly requested target reports no line of sight until its first batch is back
+	 */
+	bool RequestLineOfSight(AActor* Target, int32 NumberOfVerticalChecks);
+
+protected:
+
+	/** Resolves the pending line of sight queries for a target and submits a new batch once they're back */
+	void UpdateLineOfSight(FLineOfSightWatch& Watch);
+
+	/** Drops any line of sight queries still in flight for a target */
+	void ReleaseLineOfSight(FLineOfSightWatch& Watch);
+
 protected:
 
 	/** Called when the AI perception component updates a perception on a given actor */
@@ -11,11 +11,15 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "FPS/FPSRandomSubsystem.h"
 
 void AShooterNPC::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// acquire this NPC's seeded aim stream so runs are reproducible
+	AimStream = &UFPSRandomSubsystem::GetStreamFor(this, FPSRandomStreams::AIAim);
+
 	// spawn the weapon
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.Owner = this;
@@ -31,6 +35,13 @@ void AShooterNPC::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// release the aim random stream
+	AimStream = nullptr;
+	if (UFPSRandomSubsystem* RandomSubsystem = GetWorld()->GetSubsystem<UFPSRandomSubsystem>())
+	{
+		RandomSubsystem->ReleaseStreams(this);
+	}
 }
 
 float AShooterNPC::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
@@ -87,6 +98,8 @@ FVector AShooterNPC::GetWeaponTargetLocation()
 
 	FVector AimDir, AimTarget = FVector::ZeroVector;
 
+	const float AimVarianceHalfAngleRad = FMath::DegreesToRadians(AimVarianceHalfAngle);
+
 	// do we have an aim target?
 	if (CurrentAimTarget)
 	{
@@ -94,17 +107,18 @@ FVector AShooterNPC::GetWeaponTargetLocation()
 		AimTarget = CurrentAimTarget->GetActorLocation();
 
 		// apply a vertical offset to target head/feet
-		AimTarget.Z += FMath::RandRange(MinAimOffsetZ, MaxAimOffsetZ);
+		AimTarget.Z += AimStream ? AimStream->FRandRange(MinAimOffsetZ, MaxAimOffsetZ) : FMath::FRandRange(MinAimOffsetZ, MaxAimOffsetZ);
 
 		// get the aim direction and apply randomness in a cone
 		AimDir = (AimTarget - AimSource).GetSafeNormal();
-		AimDir = UKismetMathLibrary::RandomUnitVectorInConeInDegrees(AimDir, AimVarianceHalfAngle);
+		AimDir = AimStream ? AimStream->VRandCone(AimDir, AimVarianceHalfAngleRad) : FMath::VRandCone(AimDir, AimVarianceHalfAngleRad);
 
 		
 	} else {
 
 		// no aim target, so just use the camera facing
-		AimDir = UKismetMathLibrary::RandomUnitVectorInConeInDegrees(GetFirstPersonCameraComponent()->GetForwardVector(), AimVarianceHalfAngle);
+		const FVector CameraForward = GetFirstPersonCameraComponent()->GetForwardVector();
+		AimDir = AimStream ? AimStream->VRandCone(CameraForward, AimVarianceHalfAngleRad) : FMath::VRandCone(CameraForward, AimVarianceHalfAngleRad);
 
 	}
 
@@ -10,6 +10,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FPawnDeathDelegate);
 
 class AShooterWeapon;
+class FFPSRandomStream;
 
 /**
  *  A simple AI-controlled shooter game NPC
@@ -75,6 +76,9 @@ protected:
 	/** Actor currently being targeted */
 	TObjectPtr<AActor> CurrentAimTarget;
 
+	/** Seeded aim random stream. Acquired on BeginPlay, released on EndPlay */
+	FFPSRandomStream* AimStream = nullptr;
+
 	/** If true, this character is currently shooting its weapon */
 	bool bIsShooting = false;
 
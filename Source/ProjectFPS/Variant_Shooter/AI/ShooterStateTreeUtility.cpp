@@ -15,7 +15,7 @@ bool FStateTreeLineOfSightToTargetCondition::TestCondition(FStateTreeExecutionCo
 	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
 	// ensure the target is valid
-	if (!IsValid(InstanceData.Target))
+	if (!IsValid(InstanceData.Target) || !InstanceData.Character)
 	{
 		return !InstanceData.bMustHaveLineOfSight;
 	}
@@ -32,41 +32,11 @@ bool FStateTreeLineOfSightToTargetCondition::TestCondition(FStateTreeExecutionCo
 		return !InstanceData.bMustHaveLineOfSight;
 	}
 
-	// get the target's bounding box
-	FVector CenterOfMass, Extent;
-	InstanceData.Target->GetActorBounds(true, CenterOfMass, Extent, false);
+	// the AI Controller owns the async line of sight traces against any target we ask about, we only read its most recently resolved result
+	AShooterAIController* Controller = Cast<AShooterAIController>(InstanceData.Character->GetController());
+	const bool bHasLineOfSight = Controller && Controller->RequestLineOfSight(InstanceData.Target, InstanceData.NumberOfVerticalLineOfSightChecks);
 
-	// divide the vertical extent by the number of line of sight checks we'll do
-	const float ExtentZOffset = Extent.Z * 2.0f / InstanceData.NumberOfVerticalLineOfSightChecks;
-
-	// get the character's camera location as the source for the line checks
-	const FVector Start = InstanceData.Character->GetFirstPersonCameraComponent()->GetComponentLocation();
-
-	// ignore the character and target. We want to ensure there's an unobstructed trace not counting them
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(InstanceData.Character);
-	QueryParams.AddIgnoredActor(InstanceData.Target);
-
-	FHitResult OutHit;
-
-	// run a number of vertically offset line traces to the target location
-	for (int32 i = 0; i < InstanceData.NumberOfVerticalLineOfSightChecks - 1; ++i)
-	{
-		// calculate the endpoint for the trace
-		const FVector End = CenterOfMass + FVector(0.0f, 0.0f, Extent.Z - ExtentZOffset * i);
-
-		InstanceData.Character->GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, QueryParams);
-
-		// is the trace unobstructed?
-		if (!OutHit.bBlockingHit)
-		{
-			// we only need one unobstructed trace, so terminate early
-			return InstanceData.bMustHaveLineOfSight;
-		}
-	}
-
-	// no line of sight found
-	return !InstanceData.bMustHaveLineOfSight;
+	return bHasLineOfSight ? InstanceData.bMustHaveLineOfSight : !InstanceData.bMustHaveLineOfSight;
 }
 
 #if WITH_EDITOR